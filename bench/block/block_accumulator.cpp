@@ -0,0 +1,52 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+using namespace boost::crypto3;
+
+/*!
+ * @brief Encrypts the input through the block accumulator straight into a pre-sized buffer. Time per
+ * octet has to stay flat from kilobytes to a gigabyte.
+ */
+static void encrypt_to_iterator(benchmark::State &state) {
+    std::vector<std::uint8_t> key(16, 0x2b), in(state.range(0), 0x6b), out(in.size());
+
+    for (auto _ : state) {
+        encrypt<block::aes<128>>(in.begin(), in.end(), key, out.begin());
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief Encrypts the input through the block accumulator into a container built from its result
+ */
+static void encrypt_to_range(benchmark::State &state) {
+    std::vector<std::uint8_t> key(16, 0x2b), in(state.range(0), 0x6b);
+
+    for (auto _ : state) {
+        std::vector<std::uint8_t> out = encrypt<block::aes<128>>(in, key);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(encrypt_to_iterator)->RangeMultiplier(32)->Range(1 << 10, 1 << 30)->Unit(benchmark::kMicrosecond);
+BENCHMARK(encrypt_to_range)->RangeMultiplier(32)->Range(1 << 10, 1 << 30)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+template<typename Cipher>
+struct cbc_types {
+    typedef block::modes::cbc<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type encryption_mode;
+    typedef typename mode_type::template bind<typename mode_type::decryption_policy>::type decryption_mode;
+    typedef typename Cipher::block_type block_type;
+};
+
+/*!
+ * @brief Chained encryption, every block depends on the previous one.
+ */
+template<typename Cipher>
+static void cbc_encrypt_blocks(benchmark::State &state) {
+    typedef cbc_types<Cipher> types;
+
+    typename types::encryption_mode mode(bench::make_cipher<Cipher>());
+    std::vector<typename types::block_type> data(state.range(0) / sizeof(typename types::block_type));
+
+    for (auto _ : state) {
+        mode.encrypt_blocks(data.data(), data.data(), data.size());
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief Decryption one block at a time through process_block.
+ */
+template<typename Cipher>
+static void cbc_decrypt_single_block(benchmark::State &state) {
+    typedef cbc_types<Cipher> types;
+
+    typename types::decryption_mode mode(bench::make_cipher<Cipher>());
+    std::vector<typename types::block_type> data(state.range(0) / sizeof(typename types::block_type));
+
+    for (auto _ : state) {
+        for (typename types::block_type &b : data) {
+            b = mode.process_block(b, 0);
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief Decryption bulk path, pipeline_blocks blocks in flight.
+ */
+template<typename Cipher>
+static void cbc_decrypt_blocks(benchmark::State &state) {
+    typedef cbc_types<Cipher> types;
+
+    typename types::decryption_mode mode(bench::make_cipher<Cipher>());
+    std::vector<typename types::block_type> data(state.range(0) / sizeof(typename types::block_type));
+
+    for (auto _ : state) {
+        mode.decrypt_blocks(data.data(), data.data(), data.size());
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(cbc_encrypt_blocks, block::aes<128>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(cbc_decrypt_single_block, block::aes<128>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(cbc_decrypt_blocks, block::aes<128>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(cbc_encrypt_blocks, block::aes<256>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(cbc_decrypt_blocks, block::aes<256>)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+template<typename Cipher>
+struct ctr_types {
+    typedef block::modes::ctr<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type encryption_mode;
+    typedef typename Cipher::block_type block_type;
+    typedef typename Cipher::key_type key_type;
+};
+
+/*!
+ * @brief Counter mode built on single-block encrypt calls, one AES-NI block in flight.
+ */
+template<typename Cipher>
+static void ctr_single_block(benchmark::State &state) {
+    typedef typename ctr_types<Cipher>::block_type block_type;
+
+    Cipher cipher = bench::make_cipher<Cipher>();
+    std::vector<block_type> data(state.range(0) / sizeof(block_type));
+    block_type counter = {0};
+
+    for (auto _ : state) {
+        for (block_type &b : data) {
+            block_type k = cipher.encrypt(counter);
+            for (std::size_t i = 0; i != b.size(); ++i) {
+                b[i] ^= k[i];
+            }
+            for (std::size_t i = counter.size(); i-- && !++counter[i];) {
+            }
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief Counter mode bulk path, eight counter blocks in flight.
+ */
+template<typename Cipher>
+static void ctr_encrypt_blocks(benchmark::State &state) {
+    typedef ctr_types<Cipher> types;
+
+    typename types::encryption_mode mode(bench::make_cipher<Cipher>());
+    std::vector<typename types::block_type> data(state.range(0) / sizeof(typename types::block_type));
+
+    for (auto _ : state) {
+        mode.encrypt_blocks(data.data(), data.data(), data.size());
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief Counter mode through encrypt and the block cipher accumulator.
+ */
+template<typename Cipher>
+static void ctr_accumulator(benchmark::State &state) {
+    typedef typename ctr_types<Cipher>::encryption_mode mode_type;
+
+    Cipher cipher = bench::make_cipher<Cipher>();
+    std::vector<std::uint8_t> data(state.range(0));
+
+    for (auto _ : state) {
+        block::accumulator_set<mode_type> acc((mode_type(cipher)));
+        encrypt<Cipher>(data, acc);
+        benchmark::DoNotOptimize(accumulators::extract::block<mode_type>(acc));
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(ctr_single_block, block::aes<128>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(ctr_encrypt_blocks, block::aes<128>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(ctr_accumulator, block::aes<128>)->RangeMultiplier(16)->Range(1 << 10, 1 << 14);
+BENCHMARK_TEMPLATE(ctr_single_block, block::aes<256>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(ctr_encrypt_blocks, block::aes<256>)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/aes.hpp>
+#include <boost/crypto3/block/kasumi.hpp>
+#include <boost/crypto3/block/shacal2.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+/*!
+ * @brief Per-request setup as done without shared schedules: the key is expanded for every cipher
+ */
+template<typename Cipher>
+static void setup_from_key(benchmark::State &state) {
+    typename Cipher::key_type key = bench::make_key<Cipher>();
+    typename Cipher::block_type block = {};
+
+    for (auto _ : state) {
+        Cipher cipher(key);
+        block = cipher.encrypt(block);
+        benchmark::DoNotOptimize(block);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/*!
+ * @brief Per-request setup with a schedule expanded once and shared by every cipher
+ */
+template<typename Cipher>
+static void setup_from_expanded_key(benchmark::State &state) {
+    std::shared_ptr<const typename Cipher::expanded_key> schedule =
+        std::make_shared<const typename Cipher::expanded_key>(bench::make_key<Cipher>());
+    typename Cipher::block_type block = {};
+
+    for (auto _ : state) {
+        Cipher cipher(schedule);
+        block = cipher.encrypt(block);
+        benchmark::DoNotOptimize(block);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/*!
+ * @brief AES key expansion alone with the backend of the second argument, for both directions or for
+ * encryption only
+ */
+template<typename Cipher>
+static void expand_key(benchmark::State &state) {
+    typename Cipher::key_type key = bench::make_key<Cipher>();
+    block::key_usage usage = static_cast<block::key_usage>(state.range(0));
+    block::rijndael_backend backend = static_cast<block::rijndael_backend>(state.range(1));
+    state.SetLabel(usage == block::key_usage::encryption ? "encryption" : "both");
+
+    if (!Cipher::is_available(backend)) {
+        state.SkipWithError("backend is not available");
+        return;
+    }
+
+    for (auto _ : state) {
+        typename Cipher::expanded_key schedule(key, usage, backend);
+        benchmark::DoNotOptimize(&schedule);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void usage_args(benchmark::internal::Benchmark *b) {
+    const block::rijndael_backend backends[] = {block::rijndael_backend::portable, block::rijndael_backend::bitsliced,
+                                                block::rijndael_backend::aes_ni};
+    for (block::rijndael_backend backend : backends) {
+        b->Args({static_cast<int>(block::key_usage::both), static_cast<int>(backend)});
+        b->Args({static_cast<int>(block::key_usage::encryption), static_cast<int>(backend)});
+    }
+}
+
+BENCHMARK_TEMPLATE(setup_from_key, block::aes<128>);
+BENCHMARK_TEMPLATE(setup_from_expanded_key, block::aes<128>);
+BENCHMARK_TEMPLATE(setup_from_key, block::aes<256>);
+BENCHMARK_TEMPLATE(setup_from_expanded_key, block::aes<256>);
+BENCHMARK_TEMPLATE(setup_from_key, block::kasumi);
+BENCHMARK_TEMPLATE(setup_from_expanded_key, block::kasumi);
+BENCHMARK_TEMPLATE(setup_from_key, block::shacal2<256>);
+BENCHMARK_TEMPLATE(setup_from_expanded_key, block::shacal2<256>);
+
+BENCHMARK_TEMPLATE(expand_key, block::aes<128>)->Apply(usage_args);
+BENCHMARK_TEMPLATE(expand_key, block::aes<256>)->Apply(usage_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+template<typename Cipher>
+struct gcm_types {
+    typedef block::modes::gcm<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type encryption_mode;
+    typedef typename mode_type::template bind<typename mode_type::decryption_policy>::type decryption_mode;
+    typedef typename Cipher::block_type block_type;
+};
+
+static const std::array<std::uint8_t, 12> iv = {0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88};
+
+/*!
+ * @brief Whole message sealed with encrypt_blocks and tag, the AAD is a 13-octet record header
+ */
+template<typename Cipher, typename Mode>
+static void gcm_seal(benchmark::State &state) {
+    typedef typename gcm_types<Cipher>::block_type block_type;
+
+    Cipher cipher = bench::make_cipher<Cipher>();
+    std::vector<block_type> data(state.range(0) / sizeof(block_type));
+    std::array<std::uint8_t, 13> aad = {0};
+
+    for (auto _ : state) {
+        Mode mode(cipher, iv);
+        mode.process_aad(aad);
+        mode.process_blocks(data.data(), data.data(), data.size());
+        benchmark::DoNotOptimize(mode.tag());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+template<typename Cipher>
+static void gcm_encrypt(benchmark::State &state) {
+    gcm_seal<Cipher, typename gcm_types<Cipher>::encryption_mode>(state);
+}
+
+template<typename Cipher>
+static void gcm_decrypt(benchmark::State &state) {
+    gcm_seal<Cipher, typename gcm_types<Cipher>::decryption_mode>(state);
+}
+
+/*!
+ * @brief GHASH alone, dispatched to PCLMULQDQ when available
+ */
+static void ghash_dispatched(benchmark::State &state) {
+    typedef block::detail::ghash::block_type block_type;
+
+    std::vector<block_type> data(state.range(0) / sizeof(block_type));
+    block_type h = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+    for (auto _ : state) {
+        block::detail::ghash hash(h);
+        hash.update(data.data(), data.size());
+        benchmark::DoNotOptimize(hash.digest());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief Portable constant-time GHASH
+ */
+static void ghash_portable(benchmark::State &state) {
+    typedef block::detail::ghash_portable_impl::block_type block_type;
+
+    std::vector<block_type> data(state.range(0) / sizeof(block_type));
+    block_type h = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+    for (auto _ : state) {
+        block_type y = block_type();
+        block::detail::ghash_portable_impl::process_blocks(y, h, data.data(), data.size());
+        benchmark::DoNotOptimize(y);
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(gcm_encrypt, block::aes<128>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(gcm_decrypt, block::aes<128>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(gcm_encrypt, block::aes<256>)->Arg(1 << 16);
+BENCHMARK(ghash_dispatched)->Arg(1 << 16);
+BENCHMARK(ghash_portable)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+using namespace boost::crypto3;
+
+typedef block::aes<128> cipher_type;
+typedef block::modes::isomorphic<cipher_type, block::nop_padding>::bind<block::encryption_policy<cipher_type>>::type
+    ecb_mode_type;
+typedef block::modes::ctr<cipher_type, block::nop_padding> ctr_type;
+typedef ctr_type::bind<ctr_type::encryption_policy>::type ctr_mode_type;
+
+/*!
+ * @brief Reference: the iterator interface reads the input through the accumulator into a separate output
+ */
+static void ecb_iterator(benchmark::State &state) {
+    std::vector<std::uint8_t> key(16, 0x2b), in(state.range(0), 0x6b), out(in.size());
+
+    for (auto _ : state) {
+        encrypt<cipher_type>(in.begin(), in.end(), key, out.begin());
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief In place encryption, the second argument offsets the buffer to check unaligned memory
+ */
+template<typename Mode>
+static void inplace(benchmark::State &state) {
+    cipher_type::key_type key;
+    key.fill(0x2b);
+    Mode mode((cipher_type(key)));
+
+    std::vector<std::uint8_t> buffer(state.range(0) + state.range(1), 0x6b);
+    octet_type *first = buffer.data() + state.range(1);
+
+    for (auto _ : state) {
+        encrypt_inplace<cipher_type>(first, first + state.range(0), mode);
+        benchmark::DoNotOptimize(first);
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(ecb_iterator)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(inplace, ecb_mode_type)->ArgsProduct({{1 << 10, 1 << 15, 1 << 20}, {0, 1}});
+BENCHMARK_TEMPLATE(inplace, ctr_mode_type)->ArgsProduct({{1 << 10, 1 << 15, 1 << 20}, {0, 1}});
+
+BENCHMARK_MAIN();
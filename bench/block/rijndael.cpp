@@ -0,0 +1,178 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/aes.hpp>
+
+using namespace boost::crypto3;
+
+/*!
+ * @brief AES vectors of test/block/data/rijndael.json, every backend is checked against
+ * them before being timed
+ */
+template<std::size_t KeyBits>
+struct rijndael_vector;
+
+template<>
+struct rijndael_vector<128> {
+    constexpr static const char *key = "000102030405060708090a0b0c0d0e0f";
+    constexpr static const char *ciphertext = "69c4e0d86a7b0430d8cdb78070b4c55a";
+};
+
+template<>
+struct rijndael_vector<192> {
+    constexpr static const char *key = "000102030405060708090a0b0c0d0e0f1011121314151617";
+    constexpr static const char *ciphertext = "dda97ca4864cdfe06eaf70a0ec0d7191";
+};
+
+template<>
+struct rijndael_vector<256> {
+    constexpr static const char *key = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f";
+    constexpr static const char *ciphertext = "8ea2b7ca516745bfeafc49904b496089";
+};
+
+template<typename Array>
+static Array from_hex(const std::string &hex) {
+    Array out;
+    for (std::size_t i = 0; i != out.size(); ++i) {
+        out[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+    }
+    return out;
+}
+
+static const char *backend_name(block::rijndael_backend backend) {
+    switch (backend) {
+        case block::rijndael_backend::portable:
+            return "portable";
+        case block::rijndael_backend::bitsliced:
+            return "bitsliced";
+        case block::rijndael_backend::ssse3:
+            return "ssse3";
+        case block::rijndael_backend::aes_ni:
+            return "aes_ni";
+        case block::rijndael_backend::armv8:
+            return "armv8";
+        case block::rijndael_backend::power8:
+            return "power8";
+        default:
+            return "automatic";
+    }
+}
+
+/*!
+ * @brief Constructs the cipher with the backend of the first benchmark argument, returns nothing
+ * and skips the benchmark if it is unavailable or disagrees with the reference vector
+ */
+template<std::size_t KeyBits>
+static std::unique_ptr<block::aes<KeyBits>> make_cipher(benchmark::State &state) {
+    typedef block::aes<KeyBits> cipher_type;
+    typedef rijndael_vector<KeyBits> vector_type;
+
+    block::rijndael_backend backend = static_cast<block::rijndael_backend>(state.range(0));
+    state.SetLabel(backend_name(backend));
+
+    if (!cipher_type::is_available(backend)) {
+        state.SkipWithError("backend is not available");
+        return nullptr;
+    }
+
+    typedef typename cipher_type::key_type key_type;
+    std::unique_ptr<cipher_type> cipher(new cipher_type(from_hex<key_type>(vector_type::key), backend));
+
+    typedef typename cipher_type::block_type block_type;
+    block_type plaintext = from_hex<block_type>("00112233445566778899aabbccddeeff");
+    if (cipher->encrypt(plaintext) != from_hex<block_type>(vector_type::ciphertext) ||
+        cipher->decrypt(cipher->encrypt(plaintext)) != plaintext) {
+        state.SkipWithError("backend disagrees with the reference vector");
+        return nullptr;
+    }
+    return cipher;
+}
+
+/*!
+ * @brief Independent single-block encrypt calls
+ */
+template<std::size_t KeyBits>
+static void rijndael_encrypt(benchmark::State &state) {
+    std::unique_ptr<block::aes<KeyBits>> cipher = make_cipher<KeyBits>(state);
+    if (!cipher) {
+        return;
+    }
+
+    std::vector<typename block::aes<KeyBits>::block_type> data(state.range(1) / 16);
+    for (auto _ : state) {
+        for (auto &b : data) {
+            b = cipher->encrypt(b);
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(1));
+}
+
+template<std::size_t KeyBits>
+static void rijndael_decrypt(benchmark::State &state) {
+    std::unique_ptr<block::aes<KeyBits>> cipher = make_cipher<KeyBits>(state);
+    if (!cipher) {
+        return;
+    }
+
+    std::vector<typename block::aes<KeyBits>::block_type> data(state.range(1) / 16);
+    for (auto _ : state) {
+        for (auto &b : data) {
+            b = cipher->decrypt(b);
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(1));
+}
+
+/*!
+ * @brief Bulk encrypt_blocks, the backend interleaves as many blocks as it is able to
+ */
+template<std::size_t KeyBits>
+static void rijndael_encrypt_blocks(benchmark::State &state) {
+    std::unique_ptr<block::aes<KeyBits>> cipher = make_cipher<KeyBits>(state);
+    if (!cipher) {
+        return;
+    }
+
+    std::vector<typename block::aes<KeyBits>::block_type> data(state.range(1) / 16);
+    for (auto _ : state) {
+        cipher->encrypt_blocks(data.data(), data.data(), data.size());
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(1));
+}
+
+static void backend_args(benchmark::internal::Benchmark *b) {
+    const block::rijndael_backend backends[] = {block::rijndael_backend::portable, block::rijndael_backend::bitsliced,
+                                                block::rijndael_backend::ssse3, block::rijndael_backend::aes_ni,
+                                                block::rijndael_backend::armv8, block::rijndael_backend::power8};
+    for (block::rijndael_backend backend : backends) {
+        b->Args({static_cast<int>(backend), 1 << 14});
+    }
+}
+
+BENCHMARK_TEMPLATE(rijndael_encrypt, 128)->Apply(backend_args);
+BENCHMARK_TEMPLATE(rijndael_decrypt, 128)->Apply(backend_args);
+BENCHMARK_TEMPLATE(rijndael_encrypt_blocks, 128)->Apply(backend_args);
+BENCHMARK_TEMPLATE(rijndael_encrypt, 192)->Apply(backend_args);
+BENCHMARK_TEMPLATE(rijndael_encrypt_blocks, 192)->Apply(backend_args);
+BENCHMARK_TEMPLATE(rijndael_encrypt, 256)->Apply(backend_args);
+BENCHMARK_TEMPLATE(rijndael_encrypt_blocks, 256)->Apply(backend_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,188 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+#include <boost/crypto3/block/kasumi.hpp>
+#include <boost/crypto3/block/md4.hpp>
+#include <boost/crypto3/block/md5.hpp>
+#include <boost/crypto3/block/rijndael.hpp>
+#include <boost/crypto3/block/shacal.hpp>
+#include <boost/crypto3/block/shacal1.hpp>
+#include <boost/crypto3/block/shacal2.hpp>
+
+#include <fixtures.hpp>
+#include <throughput.hpp>
+
+using namespace boost::crypto3;
+
+/*!
+ * @brief Size of the chunks the accumulator is fed with, as a stream reader would do
+ */
+constexpr static const std::size_t chunk_size = 4096;
+
+/*!
+ * @brief Largest sector encrypted by XTS, smaller messages make a single sector
+ */
+constexpr static const std::size_t sector_size = 4096;
+
+/*!
+ * @brief Modes driven through the block cipher accumulator, each one knows how to construct itself
+ */
+template<typename Cipher>
+struct ecb_mode {
+    typedef typename block::modes::isomorphic<Cipher, block::nop_padding>::template bind<
+        block::encryption_policy<Cipher>>::type type;
+
+    static type make() {
+        return type(bench::make_cipher<Cipher>());
+    }
+};
+
+template<typename Cipher>
+struct cbc_mode {
+    typedef block::modes::cbc<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type type;
+
+    static type make() {
+        return type(bench::make_cipher<Cipher>(), typename Cipher::block_type());
+    }
+};
+
+template<typename Cipher>
+struct ctr_mode {
+    typedef block::modes::ctr<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type type;
+
+    static type make() {
+        return type(bench::make_cipher<Cipher>(), typename Cipher::block_type());
+    }
+};
+
+template<typename Cipher>
+struct gcm_mode {
+    typedef block::modes::gcm<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type type;
+
+    static type make() {
+        return type(bench::make_cipher<Cipher>(), bench::make_message(12));
+    }
+};
+
+/*!
+ * @brief Cipher API, independent encrypt calls over the message split into blocks
+ */
+template<typename Cipher>
+static void block_encrypt(benchmark::State &state) {
+    typedef typename Cipher::block_type block_type;
+
+    Cipher cipher = bench::make_cipher<Cipher>();
+    std::vector<block_type> data(std::max<std::size_t>(1, state.range(0) / (Cipher::block_bits / CHAR_BIT)));
+
+    bench::run(state, data.size() * Cipher::block_bits / CHAR_BIT, [&]() {
+        for (block_type &b : data) {
+            b = cipher.encrypt(b);
+        }
+        benchmark::DoNotOptimize(data.data());
+    });
+}
+
+/*!
+ * @brief Range API, the whole message encrypted in electronic codebook with a single call
+ */
+template<typename Cipher>
+static void block_range(benchmark::State &state) {
+    constexpr static const std::size_t block_octets = Cipher::block_bits / CHAR_BIT;
+
+    std::vector<std::uint8_t> input = bench::make_message(state.range(0)), key = bench::make_message(Cipher::key_bits / CHAR_BIT);
+    // The last block is padded, so the output may be longer than the message
+    std::vector<std::uint8_t> output((input.size() + block_octets - 1) / block_octets * block_octets);
+
+    bench::run(state, input.size(), [&]() {
+        encrypt<Cipher>(input, key, output.begin());
+        benchmark::DoNotOptimize(output.data());
+    });
+}
+
+/*!
+ * @brief Accumulator API, the message streamed into the mode accumulator chunk by chunk
+ */
+template<typename Cipher, template<typename> class Mode>
+static void block_accumulator(benchmark::State &state) {
+    typedef typename Mode<Cipher>::type mode_type;
+
+    std::vector<std::uint8_t> input = bench::make_message(state.range(0));
+
+    bench::run(state, input.size(), [&]() {
+        block::accumulator_set<mode_type> acc(Mode<Cipher>::make());
+        for (std::size_t i = 0; i < input.size(); i += chunk_size) {
+            const std::uint8_t *chunk = input.data() + i;
+            encrypt<Cipher>(boost::make_iterator_range(chunk, chunk + std::min(chunk_size, input.size() - i)), acc);
+        }
+        auto out = accumulators::extract::block<mode_type>(acc);
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+/*!
+ * @brief XTS processes whole data units in place rather than streams
+ */
+template<typename Cipher>
+static void block_xts_sectors(benchmark::State &state) {
+    typedef block::modes::xts<Cipher> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type xts_mode;
+
+    xts_mode mode(bench::make_cipher<Cipher>(), bench::make_cipher<Cipher>());
+    std::vector<std::uint8_t> data = bench::make_message(state.range(0));
+    std::size_t size = std::min(sector_size, data.size());
+
+    bench::run(state, data.size(), [&]() {
+        mode.encrypt_sectors(0, size, data.data(), data.data(), data.size() / size);
+        benchmark::DoNotOptimize(data.data());
+    });
+}
+
+#define CRYPTO3_BLOCK_SUITE(...)                                                              \
+    BENCHMARK_TEMPLATE(block_encrypt, __VA_ARGS__)->Apply(bench::message_sizes);               \
+    BENCHMARK_TEMPLATE(block_range, __VA_ARGS__)->Apply(bench::message_sizes);                 \
+    BENCHMARK_TEMPLATE(block_accumulator, __VA_ARGS__, ecb_mode)->Apply(bench::message_sizes)
+
+#define CRYPTO3_BLOCK_MODE_SUITE(...)                                                         \
+    BENCHMARK_TEMPLATE(block_accumulator, __VA_ARGS__, cbc_mode)->Apply(bench::message_sizes); \
+    BENCHMARK_TEMPLATE(block_accumulator, __VA_ARGS__, ctr_mode)->Apply(bench::message_sizes); \
+    BENCHMARK_TEMPLATE(block_accumulator, __VA_ARGS__, gcm_mode)->Apply(bench::message_sizes); \
+    BENCHMARK_TEMPLATE(block_xts_sectors, __VA_ARGS__)->Apply(bench::message_sizes)
+
+CRYPTO3_BLOCK_SUITE(block::aes<128>);
+CRYPTO3_BLOCK_SUITE(block::aes<192>);
+CRYPTO3_BLOCK_SUITE(block::aes<256>);
+CRYPTO3_BLOCK_SUITE(block::rijndael<256, 256>);
+CRYPTO3_BLOCK_SUITE(block::kasumi);
+CRYPTO3_BLOCK_SUITE(block::md4);
+CRYPTO3_BLOCK_SUITE(block::md5);
+CRYPTO3_BLOCK_SUITE(block::shacal2<256>);
+CRYPTO3_BLOCK_SUITE(block::shacal2<512>);
+
+// SHACAL-0 and SHACAL-1 keys are not constructed from octets, so only the cipher API applies
+BENCHMARK_TEMPLATE(block_encrypt, block::shacal)->Apply(bench::message_sizes);
+BENCHMARK_TEMPLATE(block_encrypt, block::shacal1)->Apply(bench::message_sizes);
+
+CRYPTO3_BLOCK_MODE_SUITE(block::aes<128>);
+CRYPTO3_BLOCK_MODE_SUITE(block::aes<256>);
+
+BENCHMARK_MAIN();
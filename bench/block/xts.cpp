@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+template<typename Cipher>
+struct xts_types {
+    typedef block::modes::xts<Cipher> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type xts_mode;
+};
+
+/*!
+ * @brief Encrypts a 1 MiB run of sectors, the arguments are the sector size and the thread count,
+ * 0 standing for the hardware concurrency
+ */
+template<typename Cipher>
+static void xts_encrypt_sectors(benchmark::State &state) {
+    typename xts_types<Cipher>::xts_mode mode(bench::make_cipher<Cipher>(), bench::make_cipher<Cipher>(0x80), state.range(1));
+
+    std::size_t sector_size = state.range(0);
+    std::size_t sectors = (1 << 20) / sector_size;
+    std::vector<std::uint8_t> data(sectors * sector_size);
+
+    std::uint64_t sector = 0;
+    for (auto _ : state) {
+        mode.encrypt_sectors(sector, sector_size, data.data(), data.data(), sectors);
+        sector += sectors;
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * sectors);
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * data.size());
+}
+
+template<typename Cipher>
+static void xts_decrypt_sectors(benchmark::State &state) {
+    typename xts_types<Cipher>::xts_mode mode(bench::make_cipher<Cipher>(), bench::make_cipher<Cipher>(0x80), state.range(1));
+
+    std::size_t sector_size = state.range(0);
+    std::size_t sectors = (1 << 20) / sector_size;
+    std::vector<std::uint8_t> data(sectors * sector_size);
+
+    for (auto _ : state) {
+        mode.decrypt_sectors(0, sector_size, data.data(), data.data(), sectors);
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * sectors);
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * data.size());
+}
+
+BENCHMARK_TEMPLATE(xts_encrypt_sectors, block::aes<128>)->ArgsProduct({{512, 4096}, {1, 0}});
+BENCHMARK_TEMPLATE(xts_decrypt_sectors, block::aes<128>)->ArgsProduct({{512, 4096}, {1, 0}});
+BENCHMARK_TEMPLATE(xts_encrypt_sectors, block::aes<256>)->ArgsProduct({{512, 4096}, {1, 0}});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/codec/algorithm/encode.hpp>
+#include <boost/crypto3/codec/algorithm/decode.hpp>
+
+#include <boost/crypto3/codec/base.hpp>
+
+using namespace boost::crypto3;
+
+typedef codec::detail::base_policy<58> policy_type;
+
+static std::vector<std::uint8_t> make_payload(std::size_t size) {
+    std::vector<std::uint8_t> payload(size);
+    for (std::size_t i = 0; i != size; ++i) {
+        payload[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    }
+    return payload;
+}
+
+/*!
+ * @brief Radix conversion alone, the latency of a single key or address formatting.
+ */
+static void base58_encode_block(benchmark::State &state) {
+    std::vector<std::uint8_t> payload = make_payload(state.range(0));
+    policy_type::decoded_block_type block(payload.begin(), payload.end());
+
+    for (auto _ : state) {
+        policy_type::encoded_block_type encoded = policy_type::encode_block(block);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief Radix conversion alone, the latency of a single key or address parsing.
+ */
+static void base58_decode_block(benchmark::State &state) {
+    std::vector<std::uint8_t> payload = make_payload(state.range(0));
+    policy_type::decoded_block_type block(payload.begin(), payload.end());
+    policy_type::encoded_block_type encoded = policy_type::encode_block(block);
+    std::reverse(encoded.begin(), encoded.end());
+
+    for (auto _ : state) {
+        policy_type::decoded_block_type decoded = policy_type::decode_block(encoded);
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief encode<base58> of a contiguous payload into a string, accumulator included.
+ */
+static void base58_encode(benchmark::State &state) {
+    std::vector<std::uint8_t> payload = make_payload(state.range(0));
+
+    for (auto _ : state) {
+        std::string encoded = encode<codec::base58>(payload);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief decode<base58> of an encoded payload into a vector, accumulator included.
+ */
+static void base58_decode(benchmark::State &state) {
+    std::vector<std::uint8_t> payload = make_payload(state.range(0));
+    std::string encoded = encode<codec::base58>(payload);
+
+    for (auto _ : state) {
+        std::vector<std::uint8_t> decoded = decode<codec::base58>(encoded);
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief Full conversion into a caller provided buffer, leading zeros included, nothing allocated.
+ */
+static void base58_encode_buffer(benchmark::State &state) {
+    std::vector<std::uint8_t> payload = make_payload(state.range(0));
+    std::vector<std::uint8_t> encoded(codec::base58::encoded_size(payload.size()));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codec::base58::encode(payload.data(), payload.size(), encoded.data()));
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+// Key and address sizes first, then lengths past the stack buffer of the limb arithmetic
+#define BASE58_BENCHMARK_LENGTHS \
+    Arg(20)->Arg(25)->Arg(32)->Arg(33)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Arg(4096)
+
+BENCHMARK(base58_encode_block)->BASE58_BENCHMARK_LENGTHS;
+BENCHMARK(base58_decode_block)->BASE58_BENCHMARK_LENGTHS;
+BENCHMARK(base58_encode_buffer)->BASE58_BENCHMARK_LENGTHS;
+BENCHMARK(base58_encode)->BASE58_BENCHMARK_LENGTHS;
+BENCHMARK(base58_decode)->BASE58_BENCHMARK_LENGTHS;
+
+BENCHMARK_MAIN();
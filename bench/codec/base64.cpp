@@ -0,0 +1,115 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/codec/algorithm/encode.hpp>
+#include <boost/crypto3/codec/algorithm/decode.hpp>
+
+#include <boost/crypto3/codec/base.hpp>
+
+using namespace boost::crypto3;
+
+typedef codec::detail::base_policy<64> policy_type;
+
+static std::vector<std::uint8_t> make_payload(std::size_t size) {
+    std::vector<std::uint8_t> payload(size);
+    for (std::size_t i = 0; i != size; ++i) {
+        payload[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    }
+    return payload;
+}
+
+/*!
+ * @brief Bulk encoder alone, the backend picked by the first argument.
+ */
+static void base64_encode_blocks(benchmark::State &state) {
+    codec::base64_backend backend = static_cast<codec::base64_backend>(state.range(0));
+    if (!boost::crypto3::detail::is_simd_backend_available(backend)) {
+        state.SkipWithError("backend is not available");
+        return;
+    }
+
+    std::size_t n = state.range(1) / 3;
+    std::vector<std::uint8_t> in = make_payload(n * 3), out(n * 4);
+
+    for (auto _ : state) {
+        policy_type::encode_blocks(in.data(), out.data(), n, backend);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * n * 3);
+}
+
+/*!
+ * @brief Bulk decoder alone, the backend picked by the first argument.
+ */
+static void base64_decode_blocks(benchmark::State &state) {
+    codec::base64_backend backend = static_cast<codec::base64_backend>(state.range(0));
+    if (!boost::crypto3::detail::is_simd_backend_available(backend)) {
+        state.SkipWithError("backend is not available");
+        return;
+    }
+
+    std::size_t n = state.range(1) / 3;
+    std::vector<std::uint8_t> in(n * 4), out = make_payload(n * 3);
+    policy_type::encode_blocks(out.data(), in.data(), n, codec::base64_backend::portable);
+
+    for (auto _ : state) {
+        policy_type::decode_blocks(in.data(), out.data(), n, backend);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * n * 3);
+}
+
+/*!
+ * @brief encode<base64> of a contiguous payload into a string, accumulator included.
+ */
+static void base64_encode(benchmark::State &state) {
+    std::vector<std::uint8_t> payload = make_payload(state.range(0));
+
+    for (auto _ : state) {
+        std::string encoded = encode<codec::base64>(payload);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief decode<base64> of an encoded payload into a vector, accumulator included.
+ */
+static void base64_decode(benchmark::State &state) {
+    std::vector<std::uint8_t> payload = make_payload(state.range(0));
+    std::string encoded = encode<codec::base64>(payload);
+
+    for (auto _ : state) {
+        std::vector<std::uint8_t> decoded = decode<codec::base64>(encoded);
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(base64_encode_blocks)
+    ->ArgsProduct({{static_cast<int>(codec::base64_backend::portable), static_cast<int>(codec::base64_backend::ssse3),
+                    static_cast<int>(codec::base64_backend::avx2)},
+                   {1 << 10, 1 << 16, 1 << 20}});
+BENCHMARK(base64_decode_blocks)
+    ->ArgsProduct({{static_cast<int>(codec::base64_backend::portable), static_cast<int>(codec::base64_backend::ssse3),
+                    static_cast<int>(codec::base64_backend::avx2)},
+                   {1 << 10, 1 << 16, 1 << 20}});
+BENCHMARK(base64_encode)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(base64_decode)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
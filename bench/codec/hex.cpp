@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/codec/algorithm/encode.hpp>
+#include <boost/crypto3/codec/algorithm/decode.hpp>
+
+#include <boost/crypto3/codec/hex.hpp>
+
+#include <boost/crypto3/detail/static_digest.hpp>
+
+using namespace boost::crypto3;
+
+typedef codec::detail::hex_policy<codec::mode::lower> policy_type;
+
+static std::vector<std::uint8_t> make_payload(std::size_t size) {
+    std::vector<std::uint8_t> payload(size);
+    for (std::size_t i = 0; i != size; ++i) {
+        payload[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    }
+    return payload;
+}
+
+/*!
+ * @brief Bulk encoder alone, the backend picked by the first argument.
+ */
+static void hex_encode_blocks(benchmark::State &state) {
+    codec::hex_backend backend = static_cast<codec::hex_backend>(state.range(0));
+    if (!detail::is_simd_backend_available(backend)) {
+        state.SkipWithError("backend is not available");
+        return;
+    }
+
+    std::size_t n = state.range(1);
+    std::vector<std::uint8_t> in = make_payload(n), out(n * 2);
+
+    for (auto _ : state) {
+        policy_type::encode_blocks(in.data(), out.data(), n, backend);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * n);
+}
+
+/*!
+ * @brief Bulk validating decoder alone, the backend picked by the first argument.
+ */
+static void hex_decode_blocks(benchmark::State &state) {
+    codec::hex_backend backend = static_cast<codec::hex_backend>(state.range(0));
+    if (!detail::is_simd_backend_available(backend)) {
+        state.SkipWithError("backend is not available");
+        return;
+    }
+
+    std::size_t n = state.range(1);
+    std::vector<std::uint8_t> in(n * 2), out = make_payload(n);
+    policy_type::encode_blocks(out.data(), in.data(), n, codec::hex_backend::portable);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(policy_type::decode_blocks(in.data(), out.data(), n, backend));
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * n);
+}
+
+/*!
+ * @brief encode<hex> of a contiguous payload into a string, accumulator included.
+ */
+static void hex_encode(benchmark::State &state) {
+    std::vector<std::uint8_t> payload = make_payload(state.range(0));
+
+    for (auto _ : state) {
+        std::string encoded = encode<codec::hex<codec::mode::lower>>(payload);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief decode<hex> of an encoded payload into a vector, accumulator included.
+ */
+static void hex_decode(benchmark::State &state) {
+    std::vector<std::uint8_t> payload = make_payload(state.range(0));
+    std::string encoded = encode<codec::hex<codec::mode::lower>>(payload);
+
+    for (auto _ : state) {
+        std::vector<std::uint8_t> decoded = decode<codec::hex<codec::mode::lower>>(encoded);
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief std::to_string of a 256-bit digest, the usual logging path.
+ */
+static void hex_static_digest_to_string(benchmark::State &state) {
+    static_digest<256> d;
+    std::vector<std::uint8_t> payload = make_payload(d.size());
+    std::copy(payload.begin(), payload.end(), d.begin());
+
+    for (auto _ : state) {
+        std::string s = std::to_string(d);
+        benchmark::DoNotOptimize(s.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * d.size());
+}
+
+BENCHMARK(hex_encode_blocks)
+    ->ArgsProduct({{static_cast<int>(codec::hex_backend::portable), static_cast<int>(codec::hex_backend::ssse3),
+                    static_cast<int>(codec::hex_backend::avx2)},
+                   {32, 1 << 10, 1 << 16, 1 << 20}});
+BENCHMARK(hex_decode_blocks)
+    ->ArgsProduct({{static_cast<int>(codec::hex_backend::portable), static_cast<int>(codec::hex_backend::ssse3),
+                    static_cast<int>(codec::hex_backend::avx2)},
+                   {32, 1 << 10, 1 << 16, 1 << 20}});
+BENCHMARK(hex_encode)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(hex_decode)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(hex_static_digest_to_string);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <boost/crypto3/codec/algorithm/encode.hpp>
+#include <boost/crypto3/codec/algorithm/decode.hpp>
+#include <boost/crypto3/codec/adaptor/coded.hpp>
+
+#include <boost/crypto3/codec/base.hpp>
+#include <boost/crypto3/codec/hex.hpp>
+
+#include <throughput.hpp>
+
+using namespace boost::crypto3;
+using namespace boost::crypto3::codec;
+
+/*!
+ * @brief Size of the chunks the accumulator is fed with, as a stream reader would do
+ */
+constexpr static const std::size_t chunk_size = 4096;
+
+/*!
+ * @brief Base58 treats the whole message as a single number, so its cost is quadratic in the
+ * message size and the suite stops at 4 KiB for it
+ */
+static void base58_message_sizes(benchmark::internal::Benchmark *b) {
+    b->RangeMultiplier(16)->Range(bench::min_message_size, 4096);
+}
+
+/*!
+ * @brief Range API, the whole message encoded with a single call
+ */
+template<typename Codec>
+static void codec_encode_range(benchmark::State &state) {
+    std::vector<std::uint8_t> input = bench::make_message(state.range(0));
+
+    bench::run(state, input.size(), [&]() {
+        std::vector<std::uint8_t> out = encode<Codec>(input);
+        benchmark::DoNotOptimize(out.data());
+    });
+}
+
+/*!
+ * @brief Range API, the encoding of the message decoded back with a single call. Throughput is
+ * given in decoded octets, so it compares to the encoding one.
+ */
+template<typename Codec>
+static void codec_decode_range(benchmark::State &state) {
+    std::vector<std::uint8_t> input = bench::make_message(state.range(0));
+    std::vector<std::uint8_t> encoded = encode<Codec>(input);
+
+    bench::run(state, input.size(), [&]() {
+        std::vector<std::uint8_t> out = decode<Codec>(encoded);
+        benchmark::DoNotOptimize(out.data());
+    });
+}
+
+/*!
+ * @brief Accumulator API, the message streamed into the encoder accumulator chunk by chunk
+ */
+template<typename Codec>
+static void codec_encode_accumulator(benchmark::State &state) {
+    typedef typename Codec::stream_encoder_type codec_mode;
+
+    std::vector<std::uint8_t> input = bench::make_message(state.range(0));
+
+    bench::run(state, input.size(), [&]() {
+        codec::accumulator_set<codec_mode> acc;
+        for (std::size_t i = 0; i < input.size(); i += chunk_size) {
+            const std::uint8_t *chunk = input.data() + i;
+            encode<Codec>(boost::make_iterator_range(chunk, chunk + std::min(chunk_size, input.size() - i)), acc);
+        }
+        auto out = accumulators::extract::codec<codec_mode>(acc);
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+/*!
+ * @brief Adaptor API, the message piped through adaptors::encoded
+ */
+template<typename Codec>
+static void codec_encode_adaptor(benchmark::State &state) {
+    std::vector<std::uint8_t> input = bench::make_message(state.range(0));
+
+    bench::run(state, input.size(), [&]() {
+        std::vector<std::uint8_t> out = input | adaptors::encoded<Codec>;
+        benchmark::DoNotOptimize(out.data());
+    });
+}
+
+#define CRYPTO3_CODEC_SUITE(sizes, ...)                                            \
+    BENCHMARK_TEMPLATE(codec_encode_range, __VA_ARGS__)->Apply(sizes);             \
+    BENCHMARK_TEMPLATE(codec_decode_range, __VA_ARGS__)->Apply(sizes);             \
+    BENCHMARK_TEMPLATE(codec_encode_accumulator, __VA_ARGS__)->Apply(sizes);       \
+    BENCHMARK_TEMPLATE(codec_encode_adaptor, __VA_ARGS__)->Apply(sizes)
+
+CRYPTO3_CODEC_SUITE(bench::message_sizes, hex<mode::upper>);
+CRYPTO3_CODEC_SUITE(bench::message_sizes, hex<mode::lower>);
+CRYPTO3_CODEC_SUITE(bench::message_sizes, base<32>);
+CRYPTO3_CODEC_SUITE(base58_message_sizes, base<58>);
+CRYPTO3_CODEC_SUITE(bench::message_sizes, base<64>);
+
+BENCHMARK_MAIN();
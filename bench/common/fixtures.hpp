@@ -0,0 +1,41 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BENCH_FIXTURES_HPP
+#define CRYPTO3_BENCH_FIXTURES_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+    namespace crypto3 {
+        namespace bench {
+            /*!
+             * @brief Key of the cipher made of consecutive values starting with first
+             */
+            template<typename Cipher>
+            typename Cipher::key_type make_key(std::uint8_t first = 0) {
+                typename Cipher::key_type key;
+                for (std::size_t i = 0; i != key.size(); ++i) {
+                    key[i] = static_cast<typename Cipher::key_type::value_type>(first + i);
+                }
+                return key;
+            }
+
+            /*!
+             * @brief Cipher keyed with make_key
+             */
+            template<typename Cipher>
+            Cipher make_cipher(std::uint8_t first = 0) {
+                return Cipher(make_key<Cipher>(first));
+            }
+        }    // namespace bench
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BENCH_FIXTURES_HPP
@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BENCH_THROUGHPUT_HPP
+#define CRYPTO3_BENCH_THROUGHPUT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/predef/architecture.h>
+
+#include <benchmark/benchmark.h>
+
+#if BOOST_ARCH_X86
+#include <x86intrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace bench {
+            /*!
+             * @brief Smallest and largest message of the suites, every size in between is a power of 16
+             */
+            constexpr static const std::int64_t min_message_size = 16;
+            constexpr static const std::int64_t max_message_size = std::int64_t(64) << 20;
+
+            /*!
+             * @brief Reads the processor cycle counter, the time stamp counter on x86 and the virtual
+             * counter on ARMv8. Both tick at a constant rate, which matches the core clock unless
+             * frequency scaling is on.
+             * @return 0 where no counter is available, in which case cycles per byte are not reported
+             */
+            inline std::uint64_t cycle_count() {
+#if BOOST_ARCH_X86
+                return __rdtsc();
+#elif BOOST_ARCH_ARM && defined(__aarch64__)
+                std::uint64_t v;
+                __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(v));
+                return v;
+#else
+                return 0;
+#endif
+            }
+
+            /*!
+             * @brief Applies the message sizes of the suites, 16 B to 64 MiB
+             */
+            inline void message_sizes(benchmark::internal::Benchmark *b) {
+                b->RangeMultiplier(16)->Range(min_message_size, max_message_size);
+            }
+
+            /*!
+             * @brief Deterministic message of the given size, the same for every run and commit
+             */
+            inline std::vector<std::uint8_t> make_message(std::size_t size) {
+                std::vector<std::uint8_t> m(size);
+                for (std::size_t i = 0; i != size; ++i) {
+                    m[i] = static_cast<std::uint8_t>(i * 13 + i / 251);
+                }
+                return m;
+            }
+
+            /*!
+             * @brief Runs the benchmark loop over f, which processes bytes octets per call, and reports
+             * bytes_per_second along with the "cycles/byte" counter, both exported to JSON
+             */
+            template<typename F>
+            inline void run(benchmark::State &state, std::size_t bytes, F f) {
+                std::uint64_t start = cycle_count();
+                for (auto _ : state) {
+                    f();
+                }
+                std::uint64_t cycles = cycle_count() - start;
+
+                std::int64_t total = std::int64_t(state.iterations()) * std::int64_t(bytes);
+                state.SetBytesProcessed(total);
+                if (cycles && total) {
+                    state.counters["cycles/byte"] = double(cycles) / double(total);
+                }
+            }
+        }    // namespace bench
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BENCH_THROUGHPUT_HPP
@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+
+#include <boost/crypto3/hash/blake2b.hpp>
+#include <boost/crypto3/hash/blake2b_tree.hpp>
+
+using namespace boost::crypto3;
+
+constexpr static const std::size_t message_size = 64 << 20;
+
+static const std::vector<std::uint8_t> &message() {
+    static const std::vector<std::uint8_t> m(message_size, 0x5a);
+    return m;
+}
+
+/*!
+ * @brief Sequential BLAKE2b over the same message as the scalability baseline.
+ */
+static void blake2b_sequential(benchmark::State &state) {
+    hashes::blake2b<512>::digest_type d;
+
+    for (auto _ : state) {
+        d = hash<hashes::blake2b<512>>(message());
+        benchmark::DoNotOptimize(d);
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * message_size);
+}
+
+/*!
+ * @brief BLAKE2bp on range(0) threads.
+ */
+static void blake2bp_threads(benchmark::State &state) {
+    hashes::blake2bp<512> hasher(state.range(0));
+    hashes::blake2bp<512>::digest_type d;
+
+    for (auto _ : state) {
+        d = hasher(message());
+        benchmark::DoNotOptimize(d);
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * message_size);
+}
+
+/*!
+ * @brief BLAKE2b tree with fanout 4, unlimited depth and 64 KiB leaves on range(0) threads.
+ */
+static void blake2b_tree_threads(benchmark::State &state) {
+    hashes::blake2b_tree<512> hasher(4, 255, 65536, state.range(0));
+    hashes::blake2b_tree<512>::digest_type d;
+
+    for (auto _ : state) {
+        d = hasher(message());
+        benchmark::DoNotOptimize(d);
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * message_size);
+}
+
+static void thread_counts(benchmark::internal::Benchmark *b) {
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    for (int threads = 1; threads < cores; threads *= 2) {
+        b->Arg(threads);
+    }
+    b->Arg(cores > 1 ? cores : 1);
+}
+
+BENCHMARK(blake2b_sequential)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(blake2bp_threads)->Apply(thread_counts)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(blake2b_tree_threads)->Apply(thread_counts)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
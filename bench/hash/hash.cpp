@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+
+#include <boost/crypto3/hash/blake2b.hpp>
+#include <boost/crypto3/hash/sha1.hpp>
+#include <boost/crypto3/hash/sha2.hpp>
+#include <boost/crypto3/hash/sha3.hpp>
+
+using namespace boost::crypto3;
+
+/*!
+ * @brief Hashes a contiguous buffer, which is processed block by block straight from memory.
+ */
+template<typename Hash>
+static void hash_contiguous(benchmark::State &state) {
+    std::vector<std::uint8_t> input(state.range(0), 0x5a);
+
+    for (auto _ : state) {
+        typename Hash::digest_type d = hash<Hash>(input);
+        benchmark::DoNotOptimize(d);
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief Hashes a non-contiguous random access range, which is fed to the hash value by value.
+ */
+template<typename Hash>
+static void hash_by_value(benchmark::State &state) {
+    std::deque<std::uint8_t> input(state.range(0), 0x5a);
+
+    for (auto _ : state) {
+        typename Hash::digest_type d = hash<Hash>(input.begin(), input.end());
+        benchmark::DoNotOptimize(d);
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+#define CRYPTO3_HASH_BENCHMARK(...)                                                \
+    BENCHMARK_TEMPLATE(hash_contiguous, __VA_ARGS__)->RangeMultiplier(16)->Range(64, 1 << 20); \
+    BENCHMARK_TEMPLATE(hash_by_value, __VA_ARGS__)->RangeMultiplier(16)->Range(64, 1 << 20)
+
+CRYPTO3_HASH_BENCHMARK(hashes::sha1);
+CRYPTO3_HASH_BENCHMARK(hashes::sha2<256>);
+CRYPTO3_HASH_BENCHMARK(hashes::sha2<512>);
+CRYPTO3_HASH_BENCHMARK(hashes::blake2b<512>);
+CRYPTO3_HASH_BENCHMARK(hashes::sha3<256>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <sys/statvfs.h>
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+#include <boost/crypto3/hash/algorithm/hash_file.hpp>
+
+#include <boost/crypto3/hash/blake2b.hpp>
+#include <boost/crypto3/hash/sha2.hpp>
+
+#include <throughput.hpp>
+
+using namespace boost::crypto3;
+
+/*!
+ * @brief Buffer size of the stdio loop, a common choice of stream readers
+ */
+constexpr static const std::size_t stdio_buffer_size = 1 << 16;
+
+/*!
+ * @brief Input files, written once per size into $TMPDIR (/tmp by default) and removed on exit.
+ * Runs after the first one find the file in the page cache, so these are warm cache figures.
+ */
+class input_files {
+public:
+    ~input_files() {
+        for (const auto &f : files) {
+            std::remove(f.second.c_str());
+        }
+    }
+
+    /*!
+     * @return Path of a file of size octets, empty if there is no room for it
+     */
+    const std::string &get(std::size_t size) {
+        auto it = files.find(size);
+        if (it != files.end()) {
+            return it->second;
+        }
+
+        const char *dir = std::getenv("TMPDIR");
+        std::string path = std::string(dir ? dir : "/tmp") + "/crypto3_hash_file_" + std::to_string(::getpid()) +
+                           "_" + std::to_string(size);
+
+        struct statvfs fs;
+        if (::statvfs(dir ? dir : "/tmp", &fs) != 0 || std::uint64_t(fs.f_bavail) * fs.f_frsize < 2 * size) {
+            return none;
+        }
+
+        std::vector<std::uint8_t> chunk = bench::make_message(stdio_buffer_size);
+        std::FILE *f = std::fopen(path.c_str(), "wb");
+        for (std::size_t written = 0; f && written < size; written += chunk.size()) {
+            std::fwrite(chunk.data(), 1, std::min(chunk.size(), size - written), f);
+        }
+        if (!f || std::fclose(f) != 0) {
+            std::remove(path.c_str());
+            return none;
+        }
+        return files[size] = path;
+    }
+
+private:
+    std::map<std::size_t, std::string> files;
+    std::string none;
+} files;
+
+/*!
+ * @brief hash_file, memory-mapped with readahead advice
+ */
+template<typename Hash>
+static void hash_file_mapped(benchmark::State &state) {
+    const std::string &path = files.get(state.range(0));
+    if (path.empty()) {
+        state.SkipWithError("not enough room for the input file");
+        return;
+    }
+
+    hashes::file_hash_stats stats;
+    bench::run(state, state.range(0), [&]() {
+        typename Hash::digest_type d = hash_file<Hash>(path, stats);
+        benchmark::DoNotOptimize(d);
+    });
+    state.counters["mapped"] = stats.mapped;
+}
+
+/*!
+ * @brief fread loop feeding an accumulator set, the way files are hashed without hash_file
+ */
+template<typename Hash>
+static void hash_file_stdio(benchmark::State &state) {
+    const std::string &path = files.get(state.range(0));
+    if (path.empty()) {
+        state.SkipWithError("not enough room for the input file");
+        return;
+    }
+
+    std::vector<std::uint8_t> buffer(stdio_buffer_size);
+    bench::run(state, state.range(0), [&]() {
+        accumulator_set<Hash> acc;
+        std::FILE *f = std::fopen(path.c_str(), "rb");
+        std::size_t n;
+        while ((n = std::fread(buffer.data(), 1, buffer.size(), f)) != 0) {
+            hash<Hash>(boost::make_iterator_range(buffer.data(), buffer.data() + n), acc);
+        }
+        std::fclose(f);
+        typename Hash::digest_type d = accumulators::extract::hash<Hash>(acc);
+        benchmark::DoNotOptimize(d);
+    });
+}
+
+/*!
+ * @brief 1 MiB, 16 MiB, 256 MiB, 1 GiB and 10 GiB, files the disk has no room for are skipped
+ */
+static void file_sizes(benchmark::internal::Benchmark *b) {
+    for (std::int64_t size : {std::int64_t(1) << 20, std::int64_t(16) << 20, std::int64_t(256) << 20,
+                              std::int64_t(1) << 30, std::int64_t(10) << 30}) {
+        b->Arg(size);
+    }
+    b->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(hash_file_mapped, hashes::sha2<256>)->Apply(file_sizes);
+BENCHMARK_TEMPLATE(hash_file_stdio, hashes::sha2<256>)->Apply(file_sizes);
+BENCHMARK_TEMPLATE(hash_file_mapped, hashes::blake2b<512>)->Apply(file_sizes);
+BENCHMARK_TEMPLATE(hash_file_stdio, hashes::blake2b<512>)->Apply(file_sizes);
+
+BENCHMARK_MAIN();
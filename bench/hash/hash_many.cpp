@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+#include <boost/crypto3/hash/algorithm/hash_many.hpp>
+
+#include <boost/crypto3/hash/sha2.hpp>
+#include <boost/crypto3/hash/sha3.hpp>
+#include <boost/crypto3/hash/shake.hpp>
+
+using namespace boost::crypto3;
+
+constexpr static const std::size_t messages_count = 64;
+
+static std::vector<std::vector<std::uint8_t>> make_messages(std::size_t size) {
+    std::vector<std::vector<std::uint8_t>> messages(messages_count);
+    for (std::size_t i = 0; i != messages.size(); ++i) {
+        messages[i].assign(size, static_cast<std::uint8_t>(i));
+    }
+    return messages;
+}
+
+/*!
+ * @brief Hashes messages_count messages of range(0) octets one after another.
+ */
+template<typename Hash>
+static void hash_messages_sequential(benchmark::State &state) {
+    std::vector<std::vector<std::uint8_t>> messages = make_messages(state.range(0));
+    std::vector<typename Hash::digest_type> out(messages.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i != messages.size(); ++i) {
+            out[i] = hash<Hash>(messages[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * messages.size());
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * messages.size() * state.range(0));
+}
+
+/*!
+ * @brief Hashes messages_count messages of range(0) octets with hash_many.
+ */
+template<typename Hash>
+static void hash_messages_many(benchmark::State &state) {
+    std::vector<std::vector<std::uint8_t>> messages = make_messages(state.range(0));
+    std::vector<typename Hash::digest_type> out(messages.size());
+
+    for (auto _ : state) {
+        hash_many<Hash>(messages, out.begin());
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * messages.size());
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * messages.size() * state.range(0));
+}
+
+#define CRYPTO3_HASH_MANY_BENCHMARK(...)                                                                \
+    BENCHMARK_TEMPLATE(hash_messages_sequential, __VA_ARGS__)->RangeMultiplier(4)->Range(32, 4096); \
+    BENCHMARK_TEMPLATE(hash_messages_many, __VA_ARGS__)->RangeMultiplier(4)->Range(32, 4096)
+
+CRYPTO3_HASH_MANY_BENCHMARK(hashes::sha2<256>);
+CRYPTO3_HASH_MANY_BENCHMARK(hashes::sha3<256>);
+CRYPTO3_HASH_MANY_BENCHMARK(hashes::sha3<512>);
+CRYPTO3_HASH_MANY_BENCHMARK(hashes::shake<128>);
+
+BENCHMARK_MAIN();
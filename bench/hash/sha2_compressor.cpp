@@ -0,0 +1,57 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/shacal2.hpp>
+
+#include <boost/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <boost/crypto3/hash/detail/state_adder.hpp>
+#include <boost/crypto3/hash/detail/sha2/sha2_compressor.hpp>
+
+using namespace boost::crypto3;
+
+template<std::size_t Version>
+using davies_meyer_sha2_compressor = hashes::davies_meyer_compressor<block::shacal2<Version>, hashes::detail::state_adder>;
+
+/*!
+ * @brief Runs the compression function over range(0) blocks.
+ */
+template<typename Compressor>
+static void compress_blocks(benchmark::State &state) {
+    typedef typename Compressor::word_type word_type;
+    typedef typename Compressor::state_type state_type;
+    typedef typename Compressor::block_type block_type;
+
+    std::vector<block_type> blocks(state.range(0));
+    for (std::size_t i = 0; i != blocks.size(); ++i) {
+        for (std::size_t j = 0; j != Compressor::block_words; ++j) {
+            blocks[i][j] = word_type(i * Compressor::block_words + j);
+        }
+    }
+    state_type s = {};
+
+    for (auto _ : state) {
+        for (const block_type &block : blocks) {
+            Compressor::process_block(s, block);
+        }
+        benchmark::DoNotOptimize(s);
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0) * Compressor::block_bits / 8);
+}
+
+BENCHMARK_TEMPLATE(compress_blocks, davies_meyer_sha2_compressor<256>)->RangeMultiplier(16)->Range(1, 1 << 12);
+BENCHMARK_TEMPLATE(compress_blocks, hashes::detail::sha2_compressor<256>)->RangeMultiplier(16)->Range(1, 1 << 12);
+BENCHMARK_TEMPLATE(compress_blocks, davies_meyer_sha2_compressor<512>)->RangeMultiplier(16)->Range(1, 1 << 12);
+BENCHMARK_TEMPLATE(compress_blocks, hashes::detail::sha2_compressor<512>)->RangeMultiplier(16)->Range(1, 1 << 12);
+
+BENCHMARK_MAIN();
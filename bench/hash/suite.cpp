@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+#include <boost/crypto3/hash/adaptor/hashed.hpp>
+
+#include <boost/crypto3/hash/blake2b.hpp>
+#include <boost/crypto3/hash/keccak.hpp>
+#include <boost/crypto3/hash/md4.hpp>
+#include <boost/crypto3/hash/md5.hpp>
+#include <boost/crypto3/hash/ripemd.hpp>
+#include <boost/crypto3/hash/sha.hpp>
+#include <boost/crypto3/hash/sha1.hpp>
+#include <boost/crypto3/hash/sha2.hpp>
+#include <boost/crypto3/hash/sha3.hpp>
+#include <boost/crypto3/hash/shake.hpp>
+#include <boost/crypto3/hash/tiger.hpp>
+
+#include <throughput.hpp>
+
+using namespace boost::crypto3;
+
+/*!
+ * @brief Size of the chunks the accumulator is fed with, as a stream reader would do
+ */
+constexpr static const std::size_t chunk_size = 4096;
+
+/*!
+ * @brief Range API, the whole message hashed with a single call
+ */
+template<typename Hash>
+static void hash_range(benchmark::State &state) {
+    std::vector<std::uint8_t> input = bench::make_message(state.range(0));
+
+    bench::run(state, input.size(), [&]() {
+        typename Hash::digest_type d = hash<Hash>(input);
+        benchmark::DoNotOptimize(d);
+    });
+}
+
+/*!
+ * @brief Accumulator API, the message streamed into an accumulator set chunk by chunk
+ */
+template<typename Hash>
+static void hash_accumulator(benchmark::State &state) {
+    std::vector<std::uint8_t> input = bench::make_message(state.range(0));
+
+    bench::run(state, input.size(), [&]() {
+        accumulator_set<Hash> acc;
+        for (std::size_t i = 0; i < input.size(); i += chunk_size) {
+            const std::uint8_t *chunk = input.data() + i;
+            hash<Hash>(boost::make_iterator_range(chunk, chunk + std::min(chunk_size, input.size() - i)), acc);
+        }
+        typename Hash::digest_type d = accumulators::extract::hash<Hash>(acc);
+        benchmark::DoNotOptimize(d);
+    });
+}
+
+/*!
+ * @brief Adaptor API, the message piped through adaptors::hashed
+ */
+template<typename Hash>
+static void hash_adaptor(benchmark::State &state) {
+    std::vector<std::uint8_t> input = bench::make_message(state.range(0));
+
+    bench::run(state, input.size(), [&]() {
+        typename Hash::digest_type d = input | adaptors::hashed<Hash>;
+        benchmark::DoNotOptimize(d);
+    });
+}
+
+#define CRYPTO3_HASH_SUITE(...)                                                    \
+    BENCHMARK_TEMPLATE(hash_range, __VA_ARGS__)->Apply(bench::message_sizes);       \
+    BENCHMARK_TEMPLATE(hash_accumulator, __VA_ARGS__)->Apply(bench::message_sizes); \
+    BENCHMARK_TEMPLATE(hash_adaptor, __VA_ARGS__)->Apply(bench::message_sizes)
+
+CRYPTO3_HASH_SUITE(hashes::md4);
+CRYPTO3_HASH_SUITE(hashes::md5);
+CRYPTO3_HASH_SUITE(hashes::ripemd<128>);
+CRYPTO3_HASH_SUITE(hashes::ripemd<160>);
+CRYPTO3_HASH_SUITE(hashes::ripemd<256>);
+CRYPTO3_HASH_SUITE(hashes::ripemd<320>);
+CRYPTO3_HASH_SUITE(hashes::sha);
+CRYPTO3_HASH_SUITE(hashes::sha1);
+CRYPTO3_HASH_SUITE(hashes::sha2<224>);
+CRYPTO3_HASH_SUITE(hashes::sha2<256>);
+CRYPTO3_HASH_SUITE(hashes::sha2<384>);
+CRYPTO3_HASH_SUITE(hashes::sha2<512>);
+CRYPTO3_HASH_SUITE(hashes::sha3<224>);
+CRYPTO3_HASH_SUITE(hashes::sha3<256>);
+CRYPTO3_HASH_SUITE(hashes::sha3<384>);
+CRYPTO3_HASH_SUITE(hashes::sha3<512>);
+CRYPTO3_HASH_SUITE(hashes::keccak_1600<224>);
+CRYPTO3_HASH_SUITE(hashes::keccak_1600<256>);
+CRYPTO3_HASH_SUITE(hashes::keccak_1600<384>);
+CRYPTO3_HASH_SUITE(hashes::keccak_1600<512>);
+CRYPTO3_HASH_SUITE(hashes::shake<128>);
+CRYPTO3_HASH_SUITE(hashes::shake<256>);
+CRYPTO3_HASH_SUITE(hashes::blake2b<224>);
+CRYPTO3_HASH_SUITE(hashes::blake2b<256>);
+CRYPTO3_HASH_SUITE(hashes::blake2b<384>);
+CRYPTO3_HASH_SUITE(hashes::blake2b<512>);
+CRYPTO3_HASH_SUITE(hashes::tiger<192>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+
+#include <boost/crypto3/stream/chacha20_poly1305.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+/*!
+ * @brief Raw keystream application, the backend picked by the first argument.
+ */
+static void chacha20_process_blocks(benchmark::State &state) {
+    stream::chacha20_backend backend = static_cast<stream::chacha20_backend>(state.range(0));
+    if (!stream::chacha20::is_available(backend)) {
+        state.SkipWithError("backend is not available");
+        return;
+    }
+
+    stream::chacha20 cipher(bench::make_key<stream::chacha20>(), backend);
+    stream::chacha20::nonce_type nonce = {0};
+    std::vector<stream::chacha20::block_type> data(state.range(1) / sizeof(stream::chacha20::block_type));
+
+    for (auto _ : state) {
+        cipher.process_blocks(nonce, 0, data.data(), data.data(), data.size());
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(1));
+}
+
+/*!
+ * @brief Keystream mode over contiguous octets in place.
+ */
+static void chacha20_inplace(benchmark::State &state) {
+    typedef stream::modes::keystream<stream::chacha20> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+
+    stream::chacha20 cipher(bench::make_key<stream::chacha20>());
+    std::vector<std::uint8_t> nonce(12);
+    std::vector<std::uint8_t> data(state.range(0));
+
+    for (auto _ : state) {
+        encryption_mode mode(cipher, nonce);
+        encrypt_inplace<stream::chacha20>(data, mode);
+        benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+/*!
+ * @brief AEAD_CHACHA20_POLY1305 sealing in place, ciphertext and tag.
+ */
+static void chacha20_poly1305_seal(benchmark::State &state) {
+    typedef stream::chacha20_poly1305::bind<stream::chacha20_poly1305::encryption_policy>::type encryption_mode;
+
+    stream::chacha20 cipher(bench::make_key<stream::chacha20>());
+    std::vector<std::uint8_t> nonce(12);
+    std::vector<std::uint8_t> aad(16);
+    std::vector<std::uint8_t> data(state.range(0));
+
+    for (auto _ : state) {
+        encryption_mode mode(cipher, nonce);
+        mode.process_aad(aad);
+        encrypt_inplace<stream::chacha20>(data, mode);
+        benchmark::DoNotOptimize(mode.tag());
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(chacha20_process_blocks)
+    ->ArgsProduct({{static_cast<int>(stream::chacha20_backend::portable),
+                    static_cast<int>(stream::chacha20_backend::sse2),
+                    static_cast<int>(stream::chacha20_backend::avx2)},
+                   {1 << 10, 1 << 14, 1 << 20}});
+BENCHMARK(chacha20_inplace)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(chacha20_poly1305_seal)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
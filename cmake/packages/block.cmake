@@ -77,6 +77,13 @@ list(APPEND ${CURRENT_PROJECT_NAME}_PUBLIC_HEADERS
      include/nil/crypto3/block/detail/pack.hpp
      include/nil/crypto3/block/detail/digest.hpp
 
+     include/nil/crypto3/detail/hex.hpp
+     include/nil/crypto3/detail/simd_backend.hpp
+     include/nil/crypto3/detail/hex/hex_impl.hpp
+     include/nil/crypto3/detail/hex/hex_ssse3_impl.hpp
+     include/nil/crypto3/detail/hex/hex_avx2_impl.hpp
+     include/nil/crypto3/detail/secure_zero.hpp
+
      include/nil/crypto3/block/detail/exploder.hpp
      include/nil/crypto3/block/detail/imploder.hpp
      include/nil/crypto3/block/detail/state_adder.hpp
@@ -88,24 +95,20 @@ list(APPEND ${CURRENT_PROJECT_NAME}_UNGROUPED_SOURCES)
 if(CRYPTO3_BLOCK_AES)
     list(APPEND ${CURRENT_PROJECT_NAME}_RIJNDAEL_HEADERS
          include/nil/crypto3/block/rijndael.hpp
+         include/nil/crypto3/block/detail/rijndael/rijndael_backend.hpp
          include/nil/crypto3/block/detail/rijndael/rijndael_functions.hpp
          include/nil/crypto3/block/detail/rijndael/rijndael_impl.hpp
+         include/nil/crypto3/block/detail/rijndael/rijndael_bitsliced_impl.hpp
          include/nil/crypto3/block/detail/rijndael/rijndael_policy.hpp
          )
 
     add_definitions(-D${CMAKE_UPPER_WORKSPACE_NAME}_HAS_RIJNDAEL)
 
     if(${CMAKE_TARGET_ARCHITECTURE} STREQUAL "x86_64" OR ${CMAKE_TARGET_ARCHITECTURE} STREQUAL "x86")
-        if(SSE2_FOUND)
-            list(APPEND ${CURRENT_PROJECT_NAME}_RIJNDAEL_HEADERS
-                 include/nil/crypto3/block/detail/rijndael/rijndael_ni_impl.hpp
-                 )
-
-        elseif(SSSE3_FOUND)
-            list(APPEND ${CURRENT_PROJECT_NAME}_RIJNDAEL_HEADERS
-                 include/nil/crypto3/block/detail/rijndael/rijndael_ssse3_impl.hpp
-                 )
-        endif()
+        list(APPEND ${CURRENT_PROJECT_NAME}_RIJNDAEL_HEADERS
+             include/nil/crypto3/block/detail/rijndael/rijndael_ni_impl.hpp
+             include/nil/crypto3/block/detail/rijndael/rijndael_ssse3_impl.hpp
+             )
     elseif(${CMAKE_TARGET_ARCHITECTURE} STREQUAL "armv8")
         list(APPEND ${CURRENT_PROJECT_NAME}_RIJNDAEL_HEADERS
              include/nil/crypto3/block/detail/rijndael/rijndael_armv8_impl.hpp)
@@ -467,16 +470,9 @@ add_library(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE)
 
 set_target_properties(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} PROPERTIES EXPORT_NAME ${CURRENT_PROJECT_NAME})
 
-if(${CMAKE_TARGET_ARCHITECTURE} STREQUAL "x86_64" OR ${CMAKE_TARGET_ARCHITECTURE} STREQUAL "x86")
-    if(SSE2_FOUND)
-        target_compile_definitions(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE "${CMAKE_UPPER_WORKSPACE_NAME}_HAS_RIJNDAEL_NI")
-        target_compile_options(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE "-maes;-mpclmul;-mssse3")
-    elseif(SSSE3_FOUND)
-        target_compile_definitions(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE
-                                   "${CMAKE_UPPER_WORKSPACE_NAME}_HAS_RIJNDAEL_SSSE3")
-        target_compile_options(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE "-maes;-mpclmul;-mssse3")
-    endif()
-elseif(${CMAKE_TARGET_ARCHITECTURE} STREQUAL "armv8")
+# x86 Rijndael backends are compiled with per-function target attributes and selected at runtime through cpuid,
+# so no instruction set flags are imposed on the consumers
+if(${CMAKE_TARGET_ARCHITECTURE} STREQUAL "armv8")
     target_compile_definitions(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE "${CMAKE_UPPER_WORKSPACE_NAME}_HAS_RIJNDAEL_ARMV8")
 elseif(${CMAKE_TARGET_ARCHITECTURE} STREQUAL "ppc64")
     target_compile_definitions(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE
@@ -21,8 +21,21 @@ option(BUILD_TESTS "Build unit tests" FALSE)
 
 list(APPEND ${CURRENT_PROJECT_NAME}_PUBLIC_HEADERS
      include/nil/crypto3/codec/detail/base_policy.hpp
+     include/nil/crypto3/codec/detail/codec_traits.hpp
      include/nil/crypto3/codec/detail/hex_policy.hpp
 
+     include/nil/crypto3/codec/detail/base58/base58_impl.hpp
+
+     include/nil/crypto3/codec/detail/base64/base64_impl.hpp
+     include/nil/crypto3/codec/detail/base64/base64_ssse3_impl.hpp
+     include/nil/crypto3/codec/detail/base64/base64_avx2_impl.hpp
+
+     include/nil/crypto3/detail/hex.hpp
+     include/nil/crypto3/detail/simd_backend.hpp
+     include/nil/crypto3/detail/hex/hex_impl.hpp
+     include/nil/crypto3/detail/hex/hex_ssse3_impl.hpp
+     include/nil/crypto3/detail/hex/hex_avx2_impl.hpp
+
      include/nil/crypto3/detail/exploder.hpp
      include/nil/crypto3/detail/unbounded_shift.hpp
      include/nil/crypto3/detail/imploder.hpp
@@ -22,6 +22,8 @@ endif()
 
 cm_find_package(${CMAKE_WORKSPACE_NAME}_block)
 
+cm_find_package(Threads REQUIRED)
+
 option(BUILD_WITH_CCACHE "Build with ccache usage" TRUE)
 option(BUILD_TESTS "Build unit tests" FALSE)
 
@@ -34,7 +36,8 @@ set_target_properties(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} PROPERTIES
 target_link_libraries(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE
                       ${CMAKE_WORKSPACE_NAME}::block
 
-                      ${Boost_LIBRARIES})
+                      ${Boost_LIBRARIES}
+                      Threads::Threads)
 
 target_include_directories(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE
                            "$<BUILD_INTERFACE:${CMAKE_CURRENT_SOURCE_DIR}/include>"
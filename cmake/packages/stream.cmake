@@ -0,0 +1,68 @@
+#---------------------------------------------------------------------------#
+# Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+#
+# Distributed under the Boost Software License, Version 1.0
+# See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt
+#---------------------------------------------------------------------------#
+
+if(NOT CMAKE_WORKSPACE_NAME OR NOT ("${CMAKE_WORKSPACE_NAME}" STREQUAL "crypto3"))
+    cm_workspace(crypto3)
+endif()
+
+cm_project(stream WORKSPACE_NAME ${CMAKE_WORKSPACE_NAME} LANGUAGES C CXX)
+
+cm_find_package(CM)
+include(CMDeploy)
+include(CMSetupVersion)
+
+if(NOT Boost_CONTAINER_FOUND OR NOT Boost_FOUND)
+    cm_find_package(Boost REQUIRED COMPONENTS container)
+endif()
+
+cm_find_package(${CMAKE_WORKSPACE_NAME}_block)
+
+option(BUILD_WITH_CCACHE "Build with ccache usage" TRUE)
+option(BUILD_TESTS "Build unit tests" FALSE)
+
+list(APPEND ${CURRENT_PROJECT_NAME}_PUBLIC_HEADERS
+     include/boost/crypto3/stream/chacha20.hpp
+     include/boost/crypto3/stream/chacha20_poly1305.hpp
+     include/boost/crypto3/stream/poly1305.hpp
+
+     include/boost/crypto3/stream/detail/cipher_modes.hpp
+
+     include/boost/crypto3/stream/detail/chacha20/chacha20_backend.hpp
+     include/boost/crypto3/stream/detail/chacha20/chacha20_impl.hpp
+
+     include/boost/crypto3/stream/detail/poly1305/poly1305_impl.hpp)
+
+if(${CMAKE_TARGET_ARCHITECTURE} STREQUAL "x86_64" OR ${CMAKE_TARGET_ARCHITECTURE} STREQUAL "x86")
+    list(APPEND ${CURRENT_PROJECT_NAME}_PUBLIC_HEADERS
+         include/boost/crypto3/stream/detail/chacha20/chacha20_sse2_impl.hpp
+         include/boost/crypto3/stream/detail/chacha20/chacha20_avx2_impl.hpp)
+endif()
+
+list(APPEND ${CURRENT_PROJECT_NAME}_HEADERS
+     ${${CURRENT_PROJECT_NAME}_PUBLIC_HEADERS})
+
+cm_setup_version(VERSION 0.1.0 PREFIX ${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME})
+
+add_library(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE)
+set_target_properties(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} PROPERTIES
+                      EXPORT_NAME ${CURRENT_PROJECT_NAME})
+
+target_link_libraries(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE
+                      ${CMAKE_WORKSPACE_NAME}::block
+
+                      ${Boost_LIBRARIES})
+
+target_include_directories(${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME} INTERFACE
+                           "$<BUILD_INTERFACE:${CMAKE_CURRENT_SOURCE_DIR}/include>"
+                           "$<BUILD_INTERFACE:${CMAKE_BINARY_DIR}/include>"
+
+                           ${Boost_INCLUDE_DIR})
+
+cm_deploy(TARGETS ${CMAKE_WORKSPACE_NAME}_${CURRENT_PROJECT_NAME}
+          INCLUDE include
+          NAMESPACE ${CMAKE_WORKSPACE_NAME}::)
@@ -28,9 +28,13 @@
 #include <boost/crypto3/block/accumulators/parameters/bits.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 #include <boost/crypto3/block/detail/cipher_modes.hpp>
+#include <boost/crypto3/block/detail/cipher_traits.hpp>
 
 #include <boost/crypto3/block/cipher.hpp>
 
+#include <algorithm>
+#include <array>
+
 namespace boost {
     namespace crypto3 {
         namespace accumulators {
@@ -53,6 +57,7 @@ namespace boost {
 
                     constexpr static const std::size_t value_bits = sizeof(typename block_type::value_type) * CHAR_BIT;
                     constexpr static const std::size_t block_values = block_bits / value_bits;
+                    constexpr static const std::size_t value_octets = value_bits / octet_bits;
 
                     typedef ::boost::crypto3::detail::injector<endian_type, value_bits, block_values, block_bits>
                         injector_type;
@@ -62,7 +67,7 @@ namespace boost {
 
                     template<typename Args>
                     block_impl(const Args &args) :
-                        total_seen(0), filled(false), mode(args[boost::accumulators::sample]) {
+                        total_seen(0), blocks_seen(0), filled(false), mode(args[boost::accumulators::sample]) {
                     }
 
                     template<typename ArgumentPack>
@@ -72,21 +77,95 @@ namespace boost {
                     }
 
                     inline result_type result(boost::accumulators::dont_care) const {
+                        result_type res = dgst;
+
+                        end_message(res,
+                                    std::integral_constant<bool, block::detail::has_final_blocks<mode_type>::value>());
+
+                        authenticate(res, std::integral_constant<bool, block::detail::is_authenticated_mode<
+                                                                           mode_type>::value>());
+
+                        return res;
+                    }
+
+                    /*!
+                     * @brief Makes room for the output of a message of the given amount of octets, so the
+                     * output of its blocks is appended without reallocations
+                     */
+                    inline void reserve(std::size_t octets) {
+                        dgst.reserve(octets / (block_bits / octet_bits) * block_values * value_octets);
+                    }
+
+                    /*!
+                     * @brief Moves the output of the blocks processed so far to out, result returns the rest
+                     * of the message only. Lets callers stream the output without accumulating it.
+                     */
+                    template<typename OutputIterator>
+                    inline OutputIterator take(OutputIterator out) {
+                        out = std::copy(dgst.begin(), dgst.end(), out);
+                        dgst.clear();
+                        return out;
+                    }
+
+                protected:
+                    /*!
+                     * @brief Modes with a variable amount of final output, e.g. padding ones, write up to
+                     * final_blocks blocks and report how many values of them belong to the message
+                     */
+                    inline void end_message(result_type &res, std::true_type) const {
                         using namespace ::boost::crypto3::detail;
 
-                        result_type res = dgst;
+                        std::array<block_type, mode_type::final_blocks> processed_blocks;
+                        std::size_t values = mode.end_message(cache, total_seen, processed_blocks.data());
+
+                        std::size_t offset = res.size();
+                        res.resize(offset + values * value_octets);
+
+                        for (std::size_t i = 0; values != 0; ++i) {
+                            std::size_t count = values < block_values ? values : block_values;
+                            pack<endian_type, endian_type, value_bits, octet_bits>(
+                                processed_blocks[i].begin(), processed_blocks[i].begin() + count, res.begin() + offset);
+                            offset += count * value_octets;
+                            values -= count;
+                        }
+                    }
+
+                    inline void end_message(result_type &res, std::false_type) const {
+                        using namespace ::boost::crypto3::detail;
 
                         block_type processed_block = mode.end_message(cache, total_seen);
 
-                        res = ::boost::crypto3::resize<block_bits>(res, res.size() + block_values);
+                        std::size_t values = block_values;
+                        if (mode_type::length_preserving) {
+                            // Stream modes output exactly as many values as they received
+                            std::size_t cached_bits = total_seen % block_bits;
+                            if (!total_seen) {
+                                values = 0;
+                            } else if (cached_bits) {
+                                values = cached_bits / value_bits + (cached_bits % value_bits ? 1 : 0);
+                            }
+                        }
+
+                        res.resize(res.size() + values * value_octets);
 
                         pack<endian_type, endian_type, value_bits, octet_bits>(
-                            processed_block.begin(), processed_block.end(), res.end() - block_values);
+                            processed_block.begin(), processed_block.begin() + values,
+                            res.end() - values * value_octets);
+                    }
 
-                        return res;
+                    inline void authenticate(result_type &, std::false_type) const {
+                    }
+
+                    /*!
+                     * @brief Authenticated modes append the tag to the output or verify it
+                     */
+                    inline void authenticate(result_type &res, std::true_type) const {
+                        constexpr static const std::size_t tag_octets = mode_type::appended_tag_bits / octet_bits;
+
+                        res.resize(res.size() + tag_octets);
+                        mode.end_authentication(cache, total_seen, res.end() - tag_octets);
                     }
 
-                protected:
                     inline void resolve_type(const block_type &value, std::size_t bits) {
                         process(value, bits == 0 ? block_bits : bits);
                     }
@@ -99,18 +178,24 @@ namespace boost {
                         using namespace ::boost::crypto3::detail;
 
                         block_type processed_block;
-                        if (dgst.empty()) {
+                        if (!blocks_seen) {
                             processed_block = mode.begin_message(cache, total_seen);
                         } else {
                             processed_block = mode.process_block(cache, total_seen);
                         }
 
-                        dgst = ::boost::crypto3::resize<block_bits>(dgst, dgst.size() + block_values);
+                        filled = false;
 
-                        pack<endian_type, endian_type, value_bits, octet_bits>(
-                            processed_block.begin(), processed_block.end(), dgst.end() - block_values);
+                        // Modes holding blocks back output nothing for the first of them
+                        if (blocks_seen++ < block::detail::output_delay_blocks<mode_type>::value) {
+                            return;
+                        }
 
-                        filled = false;
+                        // Grows in place, the capacity is kept across take calls
+                        dgst.resize(dgst.size() + block_values * value_octets);
+
+                        pack<endian_type, endian_type, value_bits, octet_bits>(
+                            processed_block.begin(), processed_block.end(), dgst.end() - block_values * value_octets);
                     }
 
                     inline void process(const block_type &value, std::size_t value_seen) {
@@ -166,7 +251,7 @@ namespace boost {
                             } else {
                                 // The incoming value is not a full block
                                 std::move(value.begin(),
-                                          value.begin() + value_seen / word_bits + (value_seen % word_bits ? 1 : 0),
+                                          value.begin() + value_seen / value_bits + (value_seen % value_bits ? 1 : 0),
                                           cache.begin());
                             }
                         }
@@ -220,6 +305,7 @@ namespace boost {
 
                     bool filled;
                     std::size_t total_seen;
+                    std::size_t blocks_seen;
                     block_type cache;
                     result_type dgst;
                 };
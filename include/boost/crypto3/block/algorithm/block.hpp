@@ -9,7 +9,12 @@
 #ifndef CRYPTO3_BLOCK_ALGORITHM_HPP
 #define CRYPTO3_BLOCK_ALGORITHM_HPP
 
+#include <boost/exception/exception.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <climits>
 #include <cstdint>
+#include <exception>
 
 namespace boost {
     namespace crypto3 {
@@ -28,6 +33,76 @@ namespace boost {
                 constexpr static const size_type block_words = cipher_type::block_words;
                 typedef typename cipher_type::block_type block_type;
             };
+
+            /*!
+             * @brief Thrown when the padding of a decrypted message is malformed or the message is
+             * too short for the padding scheme
+             */
+            struct padding_error : virtual boost::exception, virtual std::exception {};
+
+            /*!
+             * @brief PKCS#7 padding (RFC 5652, 6.3). The message is extended by 1 to block_bytes octets,
+             * each equal to their count, so a message of whole blocks gets an extra block.
+             * @tparam Cipher Block cipher with octet blocks
+             */
+            template<typename Cipher>
+            struct pkcs7_padding {
+                typedef std::size_t size_type;
+
+                typedef Cipher cipher_type;
+
+                constexpr static const size_type block_bits = cipher_type::block_bits;
+                constexpr static const size_type block_words = cipher_type::block_words;
+                typedef typename cipher_type::block_type block_type;
+
+                constexpr static const size_type block_bytes = block_bits / CHAR_BIT;
+
+                static_assert(sizeof(typename block_type::value_type) == 1 && block_bytes < 256,
+                              "PKCS#7 padding requires a cipher with octet blocks of at most 255 octets");
+
+                /*!
+                 * @brief Fills the block past its first used octets with the padding
+                 */
+                static void pad(block_type &block, std::size_t used) {
+                    for (std::size_t i = used; i != block_bytes; ++i) {
+                        block[i] = static_cast<typename block_type::value_type>(block_bytes - used);
+                    }
+                }
+
+                /*!
+                 * @brief Returns the amount of message octets of the last block. The padding is
+                 * checked without branching on the octets.
+                 */
+                static std::size_t unpad(const block_type &block) {
+                    std::size_t n = block[block_bytes - 1];
+                    unsigned bad = (n == 0) | (n > block_bytes);
+                    for (std::size_t i = 0; i != block_bytes; ++i) {
+                        unsigned in_padding = i >= block_bytes - n;
+                        bad |= in_padding & (block[i] != n);
+                    }
+                    if (bad) {
+                        BOOST_THROW_EXCEPTION(padding_error());
+                    }
+                    return block_bytes - n;
+                }
+            };
+
+            /*!
+             * @brief Ciphertext stealing, CBC-CS3 of the NIST SP 800-38A addendum (RFC 3962).
+             * The output is as long as the input, which has to be at least one block long.
+             * The last two ciphertext blocks are always swapped, the last one is truncated.
+             * @tparam Cipher Block cipher
+             */
+            template<typename Cipher>
+            struct cts_padding {
+                typedef std::size_t size_type;
+
+                typedef Cipher cipher_type;
+
+                constexpr static const size_type block_bits = cipher_type::block_bits;
+                constexpr static const size_type block_words = cipher_type::block_words;
+                typedef typename cipher_type::block_type block_type;
+            };
         }    // namespace block
 
         /*!
@@ -19,6 +19,7 @@
 #include <boost/crypto3/block/cipher_key.hpp>
 
 #include <boost/crypto3/block/detail/cipher_modes.hpp>
+#include <boost/crypto3/block/detail/inplace_processor.hpp>
 
 namespace boost {
     namespace crypto3 {
@@ -183,7 +184,7 @@ namespace boost {
             typedef block::detail::ref_cipher_impl<OutputAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(r, acc);
+            return EncrypterImpl(r, std::forward<OutputAccumulator>(acc));
         }
 
         /*!
@@ -458,6 +459,87 @@ namespace boost {
 
             return EncrypterImpl(r, CipherAccumulator(EncryptionMode(BlockCipher(key.key))));
         }
+
+        /*!
+         * @brief Encrypts the octets of [first, last) in place with the mode, e.g. a CTR or CBC one. The mode
+         * keeps its state, so a message may be encrypted by several calls. Only the last call of a message
+         * may end with a partial block, and only in length preserving modes. Modes padding the message, e.g. CBC
+         * with PKCS#7, or stealing ciphertext do not compile, they are driven through the accumulator instead.
+         *
+         * @ingroup block_algorithms
+         *
+         * @tparam BlockCipher
+         * @tparam Mode Mode bound to its policy
+         *
+         * @param first
+         * @param last
+         * @param mode
+         *
+         * @throw std::invalid_argument The length does not fit the mode
+         */
+        template<typename BlockCipher, typename Mode>
+        void encrypt_inplace(octet_type *first, octet_type *last, Mode &mode) {
+            BOOST_STATIC_ASSERT((std::is_same<typename Mode::cipher_type, BlockCipher>::value));
+
+            block::detail::inplace_processor<Mode>::encrypt(mode, first, last - first);
+        }
+
+        /*!
+         * @brief Encrypts a contiguous range of octets, e.g. std::vector<std::uint8_t>, in place with the mode
+         *
+         * @ingroup block_algorithms
+         *
+         * @tparam BlockCipher
+         * @tparam MutableRange
+         * @tparam Mode Mode bound to its policy
+         *
+         * @param r
+         * @param mode
+         *
+         * @return r
+         */
+        template<typename BlockCipher, typename MutableRange, typename Mode,
+                 typename = typename std::enable_if<detail::is_range<MutableRange>::value &&
+                                                    !detail::is_range<Mode>::value>::type>
+        MutableRange &encrypt_inplace(MutableRange &r, Mode &mode) {
+            typedef typename MutableRange::iterator iterator;
+            BOOST_STATIC_ASSERT(detail::is_contiguous_iterator<iterator>::value &&
+                                sizeof(typename std::iterator_traits<iterator>::value_type) == 1);
+
+            std::size_t n = std::distance(r.begin(), r.end());
+            if (n) {
+                octet_type *first = reinterpret_cast<octet_type *>(&*r.begin());
+                encrypt_inplace<BlockCipher>(first, first + n, mode);
+            }
+            return r;
+        }
+
+        /*!
+         * @brief Encrypts a contiguous range of octets in place block by block with the key, the length
+         * has to be a multiple of the block size
+         *
+         * @ingroup block_algorithms
+         *
+         * @tparam BlockCipher
+         * @tparam MutableRange
+         * @tparam KeySinglePassRange
+         *
+         * @param r
+         * @param key
+         *
+         * @return r
+         */
+        template<typename BlockCipher, typename MutableRange, typename KeySinglePassRange,
+                 typename = typename std::enable_if<detail::is_range<MutableRange>::value &&
+                                                    detail::is_range<KeySinglePassRange>::value>::type,
+                 typename = void>
+        MutableRange &encrypt_inplace(MutableRange &r, const KeySinglePassRange &key) {
+            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
+                block::encryption_policy<BlockCipher>>::type EncryptionMode;
+
+            EncryptionMode mode(BlockCipher(block::cipher_key<BlockCipher>(key).key));
+            return encrypt_inplace<BlockCipher>(r, mode);
+        }
     }    // namespace crypto3
 }    // namespace boost
 
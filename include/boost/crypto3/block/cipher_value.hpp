@@ -36,7 +36,7 @@ namespace boost {
                     typedef typename accumulator_type::mode_type mode_type;
                     typedef typename mode_type::cipher_type cipher_type;
 
-                    ref_cipher_impl(const accumulator_set_type &acc) : accumulator_set(acc) {
+                    ref_cipher_impl(accumulator_set_type &&acc) : accumulator_set(acc) {
                     }
 
                     accumulator_set_type &accumulator_set;
@@ -51,7 +51,8 @@ namespace boost {
                     typedef typename accumulator_type::mode_type mode_type;
                     typedef typename mode_type::cipher_type cipher_type;
 
-                    value_cipher_impl(const accumulator_set_type &acc) : accumulator_set(acc) {
+                    value_cipher_impl(accumulator_set_type &&acc) :
+                        accumulator_set(std::forward<accumulator_set_type>(acc)) {
                     }
 
                     mutable accumulator_set_type accumulator_set;
@@ -71,8 +72,8 @@ namespace boost {
                         result_type;
 
                     template<typename SinglePassRange>
-                    range_cipher_impl(const SinglePassRange &range, const accumulator_set_type &ise) :
-                        CipherStateImpl(ise) {
+                    range_cipher_impl(const SinglePassRange &range, accumulator_set_type &&ise) :
+                        CipherStateImpl(std::forward<accumulator_set_type>(ise)) {
                         BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SinglePassRange>));
 
                         typedef
@@ -83,12 +84,14 @@ namespace boost {
                             std::numeric_limits<value_type>::digits + std::numeric_limits<value_type>::is_signed>::type
                             stream_processor;
 
+                        reserve(range.begin(), range.end(), std::numeric_limits<value_type>::digits +
+                                                                std::numeric_limits<value_type>::is_signed);
                         stream_processor(this->accumulator_set)(range.begin(), range.end());
                     }
 
                     template<typename InputIterator>
-                    range_cipher_impl(InputIterator first, InputIterator last, const accumulator_set_type &ise) :
-                        CipherStateImpl(ise) {
+                    range_cipher_impl(InputIterator first, InputIterator last, accumulator_set_type &&ise) :
+                        CipherStateImpl(std::forward<accumulator_set_type>(ise)) {
                         BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<InputIterator>));
 
                         typedef typename std::iterator_traits<InputIterator>::value_type value_type;
@@ -98,6 +101,8 @@ namespace boost {
                             std::numeric_limits<value_type>::digits + std::numeric_limits<value_type>::is_signed>::type
                             stream_processor;
 
+                        reserve(first, last,
+                                std::numeric_limits<value_type>::digits + std::numeric_limits<value_type>::is_signed);
                         stream_processor(this->accumulator_set)(first, last);
                     }
 
@@ -123,14 +128,14 @@ namespace boost {
                     operator OutputRange() const {
                         result_type result =
                             boost::accumulators::extract_result<accumulator_type>(this->accumulator_set);
-                        return OutputRange(result.cbegin(), result.cend());
+                        return OutputRange(result.data(), result.data() + result.size());
                     }
 
                     operator result_type() const {
                         return boost::accumulators::extract_result<accumulator_type>(this->accumulator_set);
                     }
 
-                    operator accumulator_set_type() const {
+                    operator accumulator_set_type &() const {
                         return this->accumulator_set;
                     }
 
@@ -143,8 +148,33 @@ namespace boost {
                     }
 
 #endif
+
+                private:
+                    /*!
+                     * @brief Inputs of a known length have the whole output reserved up front
+                     */
+                    template<typename InputIterator>
+                    void reserve(InputIterator first, InputIterator last, std::size_t value_bits) {
+                        reserve(first, last, value_bits,
+                                typename std::iterator_traits<InputIterator>::iterator_category());
+                    }
+
+                    template<typename InputIterator>
+                    void reserve(InputIterator first, InputIterator last, std::size_t value_bits,
+                                 std::forward_iterator_tag) {
+                        boost::accumulators::find_accumulator<accumulator_type>(this->accumulator_set)
+                            .reserve(std::distance(first, last) * value_bits / octet_bits);
+                    }
+
+                    template<typename InputIterator>
+                    void reserve(InputIterator, InputIterator, std::size_t, std::input_iterator_tag) {
+                    }
                 };
 
+                /*!
+                 * @brief Streams the output into the iterator every chunk_blocks blocks, so the accumulator
+                 * never holds more than a chunk of it
+                 */
                 template<typename CipherStateImpl, typename OutputIterator>
                 struct itr_cipher_impl : public CipherStateImpl {
                 private:
@@ -162,9 +192,11 @@ namespace boost {
                     typedef typename boost::mpl::apply<accumulator_set_type, accumulator_type>::type::result_type
                         result_type;
 
+                    constexpr static const std::size_t chunk_blocks = 4096;
+
                     template<typename SinglePassRange>
-                    itr_cipher_impl(const SinglePassRange &range, OutputIterator out, const accumulator_set_type &ise) :
-                        CipherStateImpl(ise), out(std::move(out)) {
+                    itr_cipher_impl(const SinglePassRange &range, OutputIterator out, accumulator_set_type &&ise) :
+                        CipherStateImpl(std::forward<accumulator_set_type>(ise)), out(std::move(out)) {
                         BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SinglePassRange>));
 
                         typedef
@@ -175,13 +207,13 @@ namespace boost {
                             std::numeric_limits<value_type>::digits + std::numeric_limits<value_type>::is_signed>::type
                             stream_processor;
 
-                        stream_processor(this->accumulator_set)(range.begin(), range.end());
+                        process<stream_processor>(range.begin(), range.end());
                     }
 
                     template<typename InputIterator>
                     itr_cipher_impl(InputIterator first, InputIterator last, OutputIterator out,
-                                    const accumulator_set_type &ise) :
-                        CipherStateImpl(ise),
+                                    accumulator_set_type &&ise) :
+                        CipherStateImpl(std::forward<accumulator_set_type>(ise)),
                         out(std::move(out)) {
                         BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<InputIterator>));
 
@@ -192,7 +224,7 @@ namespace boost {
                             std::numeric_limits<value_type>::digits + std::numeric_limits<value_type>::is_signed>::type
                             stream_processor;
 
-                        stream_processor(this->accumulator_set)(first, last);
+                        process<stream_processor>(first, last);
                     }
 
                     operator OutputIterator() const {
@@ -201,6 +233,21 @@ namespace boost {
 
                         return std::move(result.cbegin(), result.cend(), out);
                     }
+
+                private:
+                    template<typename StreamProcessor, typename InputIterator>
+                    void process(InputIterator first, InputIterator last) {
+                        auto &acc = boost::accumulators::find_accumulator<accumulator_type>(this->accumulator_set);
+
+                        StreamProcessor stream_processor(this->accumulator_set);
+                        for (std::size_t seen = 0; first != last; ++first) {
+                            stream_processor(*first);
+                            if (++seen == chunk_blocks * StreamProcessor::block_values) {
+                                out = acc.take(out);
+                                seen = 0;
+                            }
+                        }
+                    }
                 };
             }    // namespace detail
         }        // namespace block
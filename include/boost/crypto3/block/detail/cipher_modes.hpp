@@ -10,11 +10,50 @@
 #ifndef CRYPTO3_CIPHER_MODES_HPP
 #define CRYPTO3_CIPHER_MODES_HPP
 
+#include <boost/crypto3/detail/octet.hpp>
+#include <boost/crypto3/detail/parallel_for.hpp>
 #include <boost/crypto3/detail/stream_endian.hpp>
 
+#include <boost/crypto3/block/algorithm/block.hpp>
+
+#include <boost/crypto3/block/detail/cipher_traits.hpp>
+#include <boost/crypto3/block/detail/gcm/ghash.hpp>
+#include <boost/crypto3/block/detail/xts/xts_tweak.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/exception/exception.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/static_assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
 namespace boost {
     namespace crypto3 {
         namespace block {
+            /*!
+             * @brief Thrown when the authentication tag of a message does not match
+             */
+            struct authentication_error : virtual boost::exception, virtual std::exception {};
+
+            /*!
+             * @brief Thrown when a message would need more counter blocks than the mode has left.
+             * Wrapping the counter around would reuse the keystream under the same IV.
+             */
+            struct counter_exhausted : virtual boost::exception, virtual std::exception {};
+
             namespace detail {
 
                 template<typename Cipher, typename Padding>
@@ -88,6 +127,12 @@ namespace boost {
                     constexpr static const size_type block_words = policy_type::block_words;
                     constexpr static const size_type word_bits = cipher_type::word_bits;
 
+                    /*!
+                     * @brief Whether the output is as long as the input, i.e. the last partial block
+                     * is not expanded to a whole one
+                     */
+                    constexpr static const bool length_preserving = false;
+
                     isomorphic(const cipher_type &cipher) : cipher(cipher) {
                     }
 
@@ -103,8 +148,1034 @@ namespace boost {
                         return policy_type::end_message(cipher, plaintext);
                     }
 
+                    /*!
+                     * @brief Encrypts n independent blocks, in and out may be the same
+                     */
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n) const {
+                        encrypt_blocks(in, out, n,
+                                       std::integral_constant<bool,
+                                                              has_encrypt_blocks<cipher_type, block_type>::value>());
+                    }
+
+                    /*!
+                     * @brief Decrypts n independent blocks, in and out may be the same
+                     */
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n) const {
+                        decrypt_blocks(in, out, n,
+                                       std::integral_constant<bool,
+                                                              has_decrypt_blocks<cipher_type, block_type>::value>());
+                    }
+
+                protected:
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n, std::true_type) const {
+                        cipher.encrypt_blocks(in, out, n);
+                    }
+
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n, std::false_type) const {
+                        for (; n; --n) {
+                            *out++ = cipher.encrypt(*in++);
+                        }
+                    }
+
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n, std::true_type) const {
+                        cipher.decrypt_blocks(in, out, n);
+                    }
+
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n, std::false_type) const {
+                        for (; n; --n) {
+                            *out++ = cipher.decrypt(*in++);
+                        }
+                    }
+
+                    cipher_type cipher;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct ctr_policy : public isomorphic_policy<Cipher, Padding> { };
+
+                /*!
+                 * @brief Counter mode (NIST SP 800-38A). The keystream is the encryption of the
+                 * consecutive values of the counter block, incremented as a big-endian integer.
+                 * Counter blocks are encrypted pipeline_blocks at a time, so ciphers providing
+                 * encrypt_blocks keep that many blocks in flight. Encryption and decryption are
+                 * the same operation, the last partial block is truncated to the input length.
+                 */
+                template<typename Policy>
+                class ctr {
+                    typedef Policy policy_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    constexpr static const bool length_preserving = true;
+
+                    constexpr static const size_type pipeline_blocks = 8;
+
+                    /*!
+                     * @param cipher Keyed block cipher
+                     * @param iv Initial counter block
+                     */
+                    ctr(const cipher_type &cipher, const block_type &iv = block_type()) :
+                        cipher(cipher), counter(iv), keystream_used(pipeline_blocks) {
+                    }
+
+                    block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
+                        return process_block(plaintext, total_seen);
+                    }
+
+                    block_type process_block(const block_type &plaintext, std::size_t /*total_seen*/) {
+                        if (keystream_used == pipeline_blocks) {
+                            generate_keystream(keystream.data(), pipeline_blocks);
+                            keystream_used = 0;
+                        }
+                        return xor_block(plaintext, keystream[keystream_used++]);
+                    }
+
+                    block_type end_message(const block_type &plaintext, std::size_t /*total_seen*/) const {
+                        return xor_block(plaintext, keystream_used == pipeline_blocks ? cipher.encrypt(counter) :
+                                                                                        keystream[keystream_used]);
+                    }
+
+                    /*!
+                     * @brief Encrypts n whole blocks, in and out may be the same
+                     */
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        for (; n && keystream_used != pipeline_blocks; --n) {
+                            *out++ = xor_block(*in++, keystream[keystream_used++]);
+                        }
+
+                        for (; n >= pipeline_blocks; n -= pipeline_blocks) {
+                            std::array<block_type, pipeline_blocks> pad;
+                            generate_keystream(pad.data(), pipeline_blocks);
+                            for (const block_type &k : pad) {
+                                *out++ = xor_block(*in++, k);
+                            }
+                        }
+
+                        if (n) {
+                            generate_keystream(keystream.data(), pipeline_blocks);
+                            for (keystream_used = 0; keystream_used != n; ++keystream_used) {
+                                *out++ = xor_block(*in++, keystream[keystream_used]);
+                            }
+                        }
+                    }
+
+                    /*!
+                     * @brief Decrypts n whole blocks, which is the same as encrypting them
+                     */
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        encrypt_blocks(in, out, n);
+                    }
+
+                protected:
+                    void generate_keystream(block_type *out, std::size_t n) {
+                        block_type counters[pipeline_blocks];
+                        for (std::size_t i = 0; i != n; ++i) {
+                            counters[i] = counter;
+                            increment(counter);
+                        }
+                        encrypt_blocks(counters, out, n,
+                                       std::integral_constant<bool,
+                                                              has_encrypt_blocks<cipher_type, block_type>::value>());
+                    }
+
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n, std::true_type) const {
+                        cipher.encrypt_blocks(in, out, n);
+                    }
+
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n, std::false_type) const {
+                        for (; n; --n) {
+                            *out++ = cipher.encrypt(*in++);
+                        }
+                    }
+
+                    static inline void increment(block_type &block) {
+                        for (std::size_t i = block.size(); i-- && !++block[i];) {
+                        }
+                    }
+
+                    static inline block_type xor_block(const block_type &a, const block_type &b) {
+                        block_type c;
+                        for (std::size_t i = 0; i != c.size(); ++i) {
+                            c[i] = a[i] ^ b[i];
+                        }
+                        return c;
+                    }
+
+                    cipher_type cipher;
+                    block_type counter;
+                    std::array<block_type, pipeline_blocks> keystream;
+                    std::size_t keystream_used;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct cbc_encryption_policy : public isomorphic_policy<Cipher, Padding> {
+                    constexpr static const bool encrypting = true;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct cbc_decryption_policy : public isomorphic_policy<Cipher, Padding> {
+                    constexpr static const bool encrypting = false;
+                };
+
+                /*!
+                 * @brief Cipher block chaining mode (NIST SP 800-38A). Every plaintext block is XORed
+                 * with the previous ciphertext block, held by the mode, before being encrypted. The
+                 * encryption is sequential, the decryption of a run of blocks is not, so decrypt_blocks
+                 * decrypts pipeline_blocks at a time through the cipher's decrypt_blocks.
+                 *
+                 * The padding is applied by the block accumulator at the end of the message:
+                 * nop_padding expects whole blocks and throws padding_error on a partial last one,
+                 * pkcs7_padding extends the message and strips the
+                 * extension on decryption, cts_padding steals ciphertext to keep the message length
+                 * and holds the last processed block back until the message end.
+                 */
+                template<typename Policy>
+                class cbc {
+                    typedef Policy policy_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    constexpr static const bool stealing = std::is_same<padding_type, cts_padding<cipher_type>>::value;
+
+                    constexpr static const bool length_preserving = stealing;
+
+                    constexpr static const size_type pipeline_blocks = 8;
+
+                    /*!
+                     * @brief At most two blocks are emitted on the message end: the last one and
+                     * the PKCS#7 extension, or the swapped pair of ciphertext stealing
+                     */
+                    constexpr static const size_type final_blocks = 2;
+                    constexpr static const size_type delayed_blocks = stealing ? 1 : 0;
+
+                    /*!
+                     * @param cipher Keyed block cipher
+                     * @param iv Initialization vector
+                     */
+                    cbc(const cipher_type &cipher, const block_type &iv = block_type()) :
+                        cipher(cipher), chain(iv), pending() {
+                    }
+
+                    block_type begin_message(const block_type &block, std::size_t total_seen) {
+                        if (stealing && !policy_type::encrypting) {
+                            pending = block;
+                            return block_type();
+                        }
+                        return process_block(block, total_seen);
+                    }
+
+                    block_type process_block(const block_type &block, std::size_t /*total_seen*/) {
+                        return process_block(block, std::integral_constant<bool, policy_type::encrypting>());
+                    }
+
+                    /*!
+                     * @brief Processes the last, possibly partial block and writes the rest of the output
+                     * @return Amount of block values written to out
+                     */
+                    std::size_t end_message(const block_type &last, std::size_t total_seen, block_type *out) const {
+                        constexpr static const std::size_t value_bits =
+                            sizeof(typename block_type::value_type) * CHAR_BIT;
+
+                        std::size_t cached_bits = total_seen % block_bits;
+                        std::size_t values = !total_seen   ? 0 :
+                                             !cached_bits ? std::tuple_size<block_type>::value :
+                                                            (cached_bits + value_bits - 1) / value_bits;
+
+                        return end_message(last, total_seen, values, out, padding_type(),
+                                           std::integral_constant<bool, policy_type::encrypting>());
+                    }
+
+                    /*!
+                     * @brief Encrypts n whole blocks without padding, in and out may be the same.
+                     * Not to be mixed with the accumulator interface under ciphertext stealing.
+                     */
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        for (; n; --n) {
+                            chain = cipher.encrypt(xor_block(*in++, chain));
+                            *out++ = chain;
+                        }
+                    }
+
+                    /*!
+                     * @brief Decrypts n whole blocks without padding, in and out may be the same.
+                     * Not to be mixed with the accumulator interface under ciphertext stealing.
+                     */
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        while (n) {
+                            std::size_t count = n < pipeline_blocks ? n : pipeline_blocks;
+
+                            std::array<block_type, pipeline_blocks + 1> ciphertext;
+                            ciphertext[0] = chain;
+                            std::copy(in, in + count, ciphertext.begin() + 1);
+
+                            decrypt_blocks(in, out, count,
+                                           std::integral_constant<
+                                               bool, has_decrypt_blocks<cipher_type, block_type>::value>());
+                            for (std::size_t i = 0; i != count; ++i) {
+                                out[i] = xor_block(out[i], ciphertext[i]);
+                            }
+
+                            chain = ciphertext[count];
+                            in += count;
+                            out += count;
+                            n -= count;
+                        }
+                    }
+
+                protected:
+                    block_type process_block(const block_type &plaintext, std::true_type) {
+                        block_type out = pending;
+                        chain = cipher.encrypt(xor_block(plaintext, chain));
+                        pending = chain;
+                        return stealing ? out : chain;
+                    }
+
+                    block_type process_block(const block_type &ciphertext, std::false_type) {
+                        if (stealing) {
+                            block_type out = xor_block(cipher.decrypt(pending), chain);
+                            chain = pending;
+                            pending = ciphertext;
+                            return out;
+                        }
+                        block_type out = xor_block(cipher.decrypt(ciphertext), chain);
+                        chain = ciphertext;
+                        return out;
+                    }
+
+                    std::size_t end_message(const block_type &last, std::size_t /*total_seen*/, std::size_t values,
+                                            block_type *out, const nop_padding<cipher_type> &, std::true_type) const {
+                        if (!values) {
+                            return 0;
+                        }
+                        if (values != last.size()) {
+                            BOOST_THROW_EXCEPTION(padding_error());
+                        }
+                        out[0] = cipher.encrypt(xor_block(last, chain));
+                        return last.size();
+                    }
+
+                    std::size_t end_message(const block_type &last, std::size_t /*total_seen*/, std::size_t values,
+                                            block_type *out, const nop_padding<cipher_type> &,
+                                            std::false_type) const {
+                        if (!values) {
+                            return 0;
+                        }
+                        if (values != last.size()) {
+                            BOOST_THROW_EXCEPTION(padding_error());
+                        }
+                        out[0] = xor_block(cipher.decrypt(last), chain);
+                        return last.size();
+                    }
+
+                    std::size_t end_message(const block_type &last, std::size_t /*total_seen*/, std::size_t values,
+                                            block_type *out, const pkcs7_padding<cipher_type> &,
+                                            std::true_type) const {
+                        block_type block = last;
+                        if (values == block.size()) {
+                            out[0] = cipher.encrypt(xor_block(block, chain));
+                            pkcs7_padding<cipher_type>::pad(block, 0);
+                            out[1] = cipher.encrypt(xor_block(block, out[0]));
+                            return 2 * block.size();
+                        }
+                        pkcs7_padding<cipher_type>::pad(block, values);
+                        out[0] = cipher.encrypt(xor_block(block, chain));
+                        return block.size();
+                    }
+
+                    std::size_t end_message(const block_type &last, std::size_t /*total_seen*/, std::size_t values,
+                                            block_type *out, const pkcs7_padding<cipher_type> &,
+                                            std::false_type) const {
+                        if (values != last.size()) {
+                            BOOST_THROW_EXCEPTION(padding_error());
+                        }
+                        out[0] = xor_block(cipher.decrypt(last), chain);
+                        return pkcs7_padding<cipher_type>::unpad(out[0]);
+                    }
+
+                    std::size_t end_message(const block_type &last, std::size_t total_seen, std::size_t values,
+                                            block_type *out, const cts_padding<cipher_type> &,
+                                            std::true_type) const {
+                        if (!total_seen) {
+                            return 0;
+                        }
+                        if (total_seen < block_bits) {
+                            BOOST_THROW_EXCEPTION(padding_error());
+                        }
+
+                        block_type block = last;
+                        std::fill(block.begin() + values, block.end(), 0);
+                        out[0] = cipher.encrypt(xor_block(block, chain));
+                        if (total_seen == block_bits) {
+                            return block.size();
+                        }
+
+                        // The last block is stolen from the previous ciphertext, which goes after it
+                        out[1] = pending;
+                        return block.size() + values;
+                    }
+
+                    std::size_t end_message(const block_type &last, std::size_t total_seen, std::size_t values,
+                                            block_type *out, const cts_padding<cipher_type> &,
+                                            std::false_type) const {
+                        if (!total_seen) {
+                            return 0;
+                        }
+                        if (total_seen < block_bits) {
+                            BOOST_THROW_EXCEPTION(padding_error());
+                        }
+                        if (total_seen == block_bits) {
+                            out[0] = xor_block(cipher.decrypt(last), chain);
+                            return last.size();
+                        }
+
+                        // The held back block is the swapped last one, its decryption completes the
+                        // truncated previous ciphertext block
+                        block_type stolen = cipher.decrypt(pending), previous = last;
+                        for (std::size_t i = 0; i != values; ++i) {
+                            out[1][i] = stolen[i] ^ last[i];
+                        }
+                        std::copy(stolen.begin() + values, stolen.end(), previous.begin() + values);
+                        out[0] = xor_block(cipher.decrypt(previous), chain);
+                        return last.size() + values;
+                    }
+
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n, std::true_type) const {
+                        cipher.decrypt_blocks(in, out, n);
+                    }
+
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n, std::false_type) const {
+                        for (; n; --n) {
+                            *out++ = cipher.decrypt(*in++);
+                        }
+                    }
+
+                    static inline block_type xor_block(const block_type &a, const block_type &b) {
+                        block_type c;
+                        for (std::size_t i = 0; i != c.size(); ++i) {
+                            c[i] = a[i] ^ b[i];
+                        }
+                        return c;
+                    }
+
+                    cipher_type cipher;
+                    block_type chain, pending;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct xts_policy : public isomorphic_policy<Cipher, Padding> { };
+
+                /*!
+                 * @brief XEX-based tweaked codebook mode with ciphertext stealing (IEEE 1619, NIST
+                 * SP 800-38E) for storage encrypted by sectors. Every sector is an independent data
+                 * unit, the tweak of its first block is the tweak cipher encryption of the sector
+                 * number and is multiplied by x for every following block. A sector is at least a
+                 * block long, a trailing partial block steals ciphertext from the previous one.
+                 *
+                 * Blocks of a sector are independent, so they are passed to the cipher
+                 * pipeline_blocks at a time. Runs of sectors at least min_octets_per_thread long per
+                 * part may be split across threads, either started by every call or taken from the
+                 * caller's executor.
+                 */
+                template<typename Policy>
+                class xts {
+                    typedef Policy policy_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    constexpr static const size_type block_bytes = block_bits / CHAR_BIT;
+
+                    BOOST_STATIC_ASSERT_MSG(block_bits == 128, "XTS is defined for 128-bit block ciphers only");
+
+                    constexpr static const size_type pipeline_blocks = 8;
+
+                    /*!
+                     * @brief IEEE 1619 limits a data unit to 2^20 blocks
+                     */
+                    constexpr static const std::size_t max_sector_bytes = block_bytes << 20;
+
+                    /*!
+                     * @brief Amount of octets worth starting another thread for
+                     */
+                    constexpr static const std::size_t min_octets_per_thread = 16384;
+
+                    /*!
+                     * @param cipher Block cipher keyed with the data key
+                     * @param tweak_cipher Block cipher keyed with the tweak key
+                     * @param threads Maximal amount of threads, 0 stands for the hardware concurrency. They
+                     * are started and joined by every call splitting a run of sectors.
+                     */
+                    xts(const cipher_type &cipher, const cipher_type &tweak_cipher, std::size_t threads = 1) :
+                        xts(cipher, tweak_cipher, bulk_executor(), threads) {
+                    }
+
+                    /*!
+                     * @param executor Thread pool runs of sectors are split across instead of threads
+                     * started for every call
+                     * @param parts Maximal amount of parts a run of sectors is split into, 0 stands for the
+                     * hardware concurrency
+                     */
+                    xts(const cipher_type &cipher, const cipher_type &tweak_cipher, const bulk_executor &executor,
+                        std::size_t parts) :
+                        cipher(cipher), tweak_cipher(tweak_cipher), executor(executor),
+                        threads(parts ? parts : (std::max)(1U, std::thread::hardware_concurrency())) {
+                    }
+
+                    /*!
+                     * @brief Encrypts n consecutive sectors numbered from sector, in and out may be the same
+                     * @param sector Number of the first sector
+                     * @param sector_size Sector length in octets, a block to max_sector_bytes
+                     */
+                    void encrypt_sectors(std::uint64_t sector, std::size_t sector_size, const octet_type *in,
+                                         octet_type *out, std::size_t n) const {
+                        process_sectors(sector, sector_size, in, out, n, true);
+                    }
+
+                    /*!
+                     * @brief Decrypts n consecutive sectors numbered from sector, in and out may be the same
+                     */
+                    void decrypt_sectors(std::uint64_t sector, std::size_t sector_size, const octet_type *in,
+                                         octet_type *out, std::size_t n) const {
+                        process_sectors(sector, sector_size, in, out, n, false);
+                    }
+
+                protected:
+                    void process_sectors(std::uint64_t sector, std::size_t sector_size, const octet_type *in,
+                                         octet_type *out, std::size_t n, bool encrypting) const {
+                        if (sector_size < block_bytes || sector_size > max_sector_bytes) {
+                            BOOST_THROW_EXCEPTION(std::invalid_argument("XTS sector size is out of range"));
+                        }
+
+                        std::size_t parts =
+                            (std::min)(threads, (std::max)(std::size_t(1), n * sector_size / min_octets_per_thread));
+
+                        ::boost::crypto3::detail::parallel_for(executor, parts, parts, [&](std::size_t part) {
+                            for (std::size_t i = n * part / parts; i != n * (part + 1) / parts; ++i) {
+                                process_sector(sector + i, in + i * sector_size, out + i * sector_size, sector_size,
+                                               encrypting);
+                            }
+                        });
+                    }
+
+                    void process_sector(std::uint64_t sector, const octet_type *in, octet_type *out, std::size_t size,
+                                        bool encrypting) const {
+                        // The sector number is a little-endian 128-bit integer
+                        block_type t = block_type();
+                        for (std::size_t i = 0; i != sizeof(sector); ++i) {
+                            t[i] = static_cast<octet_type>(sector >> (i * CHAR_BIT));
+                        }
+                        xts_tweak tweak(tweak_cipher.encrypt(t));
+
+                        std::size_t tail = size % block_bytes;
+                        std::size_t whole = size / block_bytes - (tail ? 1 : 0);
+
+                        std::array<block_type, pipeline_blocks> buffer, tweaks;
+                        while (whole) {
+                            std::size_t count = whole < pipeline_blocks ? whole : pipeline_blocks;
+
+                            tweak.whiten(in, buffer.data(), tweaks.data(), count);
+                            process_blocks(buffer.data(), count, encrypting);
+                            tweak.unwhiten(buffer.data(), tweaks.data(), out, count);
+
+                            in += count * block_bytes;
+                            out += count * block_bytes;
+                            whole -= count;
+                        }
+
+                        if (tail) {
+                            // Tweaks of the last full and the partial blocks, decryption uses them swapped
+                            const octet_type zeros[2 * block_bytes] = {};
+                            tweak.whiten(zeros, buffer.data(), tweaks.data(), 2);
+                            const block_type &first = tweaks[encrypting ? 0 : 1], &second = tweaks[encrypting ? 1 : 0];
+
+                            block_type stolen, last;
+                            std::memcpy(stolen.data(), in, block_bytes);
+                            process_block(stolen, first, encrypting);
+
+                            last = stolen;
+                            std::memcpy(last.data(), in + block_bytes, tail);
+                            std::memcpy(out + block_bytes, stolen.data(), tail);
+                            process_block(last, second, encrypting);
+                            std::memcpy(out, last.data(), block_bytes);
+                        }
+                    }
+
+                    void process_block(block_type &block, const block_type &t, bool encrypting) const {
+                        for (std::size_t i = 0; i != block_bytes; ++i) {
+                            block[i] ^= t[i];
+                        }
+                        process_blocks(&block, 1, encrypting);
+                        for (std::size_t i = 0; i != block_bytes; ++i) {
+                            block[i] ^= t[i];
+                        }
+                    }
+
+                    void process_blocks(block_type *blocks, std::size_t n, bool encrypting) const {
+                        if (encrypting) {
+                            encrypt_blocks(blocks, n,
+                                           std::integral_constant<
+                                               bool, has_encrypt_blocks<cipher_type, block_type>::value>());
+                        } else {
+                            decrypt_blocks(blocks, n,
+                                           std::integral_constant<
+                                               bool, has_decrypt_blocks<cipher_type, block_type>::value>());
+                        }
+                    }
+
+                    void encrypt_blocks(block_type *blocks, std::size_t n, std::true_type) const {
+                        cipher.encrypt_blocks(blocks, blocks, n);
+                    }
+
+                    void encrypt_blocks(block_type *blocks, std::size_t n, std::false_type) const {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            blocks[i] = cipher.encrypt(blocks[i]);
+                        }
+                    }
+
+                    void decrypt_blocks(block_type *blocks, std::size_t n, std::true_type) const {
+                        cipher.decrypt_blocks(blocks, blocks, n);
+                    }
+
+                    void decrypt_blocks(block_type *blocks, std::size_t n, std::false_type) const {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            blocks[i] = cipher.decrypt(blocks[i]);
+                        }
+                    }
+
+                    cipher_type cipher, tweak_cipher;
+                    bulk_executor executor;
+                    std::size_t threads;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct gcm_encryption_policy : public isomorphic_policy<Cipher, Padding> {
+                    constexpr static const bool encrypting = true;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct gcm_decryption_policy : public isomorphic_policy<Cipher, Padding> {
+                    constexpr static const bool encrypting = false;
+                };
+
+                /*!
+                 * @brief Galois/Counter mode (NIST SP 800-38D). The payload is encrypted in counter
+                 * mode starting from the incremented pre-counter block, the associated data and the
+                 * ciphertext are authenticated with GHASH. Keystream is generated pipeline_blocks
+                 * at a time and the ciphertext is hashed in runs of the same length, so AES-NI and
+                 * PCLMULQDQ both work on eight independent blocks per batch.
+                 *
+                 * Associated data is passed with process_aad before the payload. Through the block
+                 * accumulator the encryption appends the tag to the ciphertext, the decryption
+                 * checks the tag given on construction and throws authentication_error on mismatch.
+                 */
+                template<typename Policy>
+                class gcm {
+                    typedef Policy policy_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    constexpr static const bool length_preserving = true;
+
+                    constexpr static const size_type pipeline_blocks = ghash::aggregated_blocks;
+
+                    constexpr static const size_type tag_bits = 128;
+                    typedef std::array<std::uint8_t, tag_bits / 8> tag_type;
+
+                    /*!
+                     * @brief Tag bits the accumulator appends to its output, the decryption appends none
+                     */
+                    constexpr static const size_type appended_tag_bits = policy_type::encrypting ? tag_bits : 0;
+
+                    BOOST_STATIC_ASSERT_MSG((std::is_same<block_type, ghash::block_type>::value),
+                                            "GCM requires a cipher with 128-bit octet blocks");
+
+                    /*!
+                     * @brief SP 800-38D limits the payload to 2^32 - 2 blocks
+                     */
+                    constexpr static const std::uint64_t max_blocks = (std::uint64_t(1) << 32) - 2;
+
+                    /*!
+                     * @param cipher Keyed block cipher
+                     * @param iv Initialization vector, 96 bits are recommended
+                     * @throws std::invalid_argument if iv is empty
+                     */
+                    template<typename IvRange>
+                    gcm(const cipher_type &cipher, const IvRange &iv) :
+                        cipher(cipher), hash(cipher.encrypt(block_type())), blocks_left(max_blocks),
+                        keystream_used(pipeline_blocks), aad_used(0), aad_octets(0), text_octets(0),
+                        expected_tag_octets(0) {
+                        schedule_iv(boost::begin(iv), boost::end(iv));
+                    }
+
+                    /*!
+                     * @param cipher Keyed block cipher
+                     * @param iv Initialization vector, 96 bits are recommended
+                     * @param tag Tag the decrypted message is expected to have, 4 to 16 octets
+                     * @throws std::invalid_argument if iv is empty or tag is out of range
+                     */
+                    template<typename IvRange, typename TagRange>
+                    gcm(const cipher_type &cipher, const IvRange &iv, const TagRange &tag) : gcm(cipher, iv) {
+                        for (auto it = boost::begin(tag); it != boost::end(tag); ++it) {
+                            if (expected_tag_octets == expected_tag.size()) {
+                                BOOST_THROW_EXCEPTION(std::invalid_argument("GCM tag is longer than 16 octets"));
+                            }
+                            expected_tag[expected_tag_octets++] = static_cast<std::uint8_t>(*it);
+                        }
+                        if (expected_tag_octets < 4) {
+                            BOOST_THROW_EXCEPTION(std::invalid_argument("GCM tag is shorter than 4 octets"));
+                        }
+                    }
+
+                    /*!
+                     * @brief Amount of whole blocks the payload may still take
+                     */
+                    std::uint64_t available_blocks() const {
+                        return blocks_left;
+                    }
+
+                    /*!
+                     * @brief Absorbs associated data, may be called several times before the payload
+                     */
+                    template<typename InputIterator>
+                    void process_aad(InputIterator first, InputIterator last) {
+                        BOOST_ASSERT_MSG(!text_octets && keystream_used == pipeline_blocks,
+                                         "Associated data has to precede the payload");
+
+                        for (; first != last; ++first, ++aad_octets) {
+                            aad_block[aad_used++] = static_cast<std::uint8_t>(*first);
+                            if (aad_used == aad_block.size()) {
+                                hash.update(&aad_block, 1);
+                                aad_used = 0;
+                            }
+                        }
+                    }
+
+                    template<typename SinglePassRange>
+                    void process_aad(const SinglePassRange &r) {
+                        process_aad(boost::begin(r), boost::end(r));
+                    }
+
+                    block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
+                        return process_block(plaintext, total_seen);
+                    }
+
+                    block_type process_block(const block_type &input, std::size_t /*total_seen*/) {
+                        block_type output;
+                        process_blocks(&input, &output, 1);
+                        return output;
+                    }
+
+                    block_type end_message(const block_type &input, std::size_t /*total_seen*/) const {
+                        if (!blocks_left) {
+                            BOOST_THROW_EXCEPTION(counter_exhausted());
+                        }
+                        return xor_block(input, keystream_used == pipeline_blocks ? cipher.encrypt(counter) :
+                                                                                    keystream[keystream_used]);
+                    }
+
+                    /*!
+                     * @brief Encrypts or decrypts, depending on the policy, n whole blocks. In and out
+                     * may be the same.
+                     * @throws counter_exhausted if the payload would exceed max_blocks, the mode is left as
+                     * it was
+                     */
+                    void process_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        if (n > blocks_left) {
+                            BOOST_THROW_EXCEPTION(counter_exhausted());
+                        }
+                        blocks_left -= n;
+
+                        finish_aad();
+                        text_octets += n * ghash::block_bytes;
+
+                        for (; n && keystream_used != pipeline_blocks; --n) {
+                            absorb_input(in, 1);
+                            *out = xor_block(*in++, keystream[keystream_used++]);
+                            absorb_output(out++, 1);
+                        }
+
+                        for (; n >= pipeline_blocks; n -= pipeline_blocks) {
+                            std::array<block_type, pipeline_blocks> pad;
+                            generate_keystream(pad.data());
+                            absorb_input(in, pipeline_blocks);
+                            for (std::size_t i = 0; i != pipeline_blocks; ++i) {
+                                out[i] = xor_block(in[i], pad[i]);
+                            }
+                            absorb_output(out, pipeline_blocks);
+                            in += pipeline_blocks;
+                            out += pipeline_blocks;
+                        }
+
+                        if (n) {
+                            generate_keystream(keystream.data());
+                            absorb_input(in, n);
+                            for (keystream_used = 0; keystream_used != n; ++keystream_used) {
+                                out[keystream_used] = xor_block(in[keystream_used], keystream[keystream_used]);
+                            }
+                            absorb_output(out, n);
+                        }
+                    }
+
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        BOOST_STATIC_ASSERT_MSG(policy_type::encrypting, "Decryption mode can not encrypt");
+                        process_blocks(in, out, n);
+                    }
+
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        BOOST_STATIC_ASSERT_MSG(!policy_type::encrypting, "Encryption mode can not decrypt");
+                        process_blocks(in, out, n);
+                    }
+
+                    /*!
+                     * @brief Tag of the message, total_seen bits long, which ends with the partial block last
+                     * following the whole blocks already processed
+                     */
+                    tag_type tag(const block_type &last, std::size_t total_seen) const {
+                        std::size_t last_octets = (total_seen + 7) / 8 - text_octets;
+                        BOOST_ASSERT(last_octets <= ghash::block_bytes);
+
+                        ghash h = hash;
+                        if (aad_used) {
+                            h.update(aad_block.data(), aad_used);
+                        }
+                        if (last_octets) {
+                            block_type ciphertext = policy_type::encrypting ? end_message(last, total_seen) : last;
+                            h.update(ciphertext.data(), last_octets);
+                        }
+
+                        block_type lengths;
+                        store_be(lengths.data(), std::uint64_t(aad_octets) * 8);
+                        store_be(lengths.data() + 8, std::uint64_t(text_octets + last_octets) * 8);
+                        h.update(&lengths, 1);
+
+                        block_type s = xor_block(h.digest(), tag_mask);
+                        tag_type t;
+                        std::copy(s.begin(), s.end(), t.begin());
+                        return t;
+                    }
+
+                    /*!
+                     * @brief Tag of the message made of the whole blocks already processed
+                     */
+                    tag_type tag() const {
+                        return tag(block_type(), text_octets * 8);
+                    }
+
+                    /*!
+                     * @brief Compares the tag of the message with the expected one in constant time,
+                     * a truncated expected tag is compared with the prefix of the tag
+                     */
+                    template<typename TagRange>
+                    bool verify(const TagRange &expected, const block_type &last, std::size_t total_seen) const {
+                        tag_type t = tag(last, total_seen);
+                        std::size_t n = 0;
+                        std::uint8_t diff = 0;
+                        for (auto it = boost::begin(expected); it != boost::end(expected); ++it, ++n) {
+                            if (n == t.size()) {
+                                return false;
+                            }
+                            diff |= t[n] ^ static_cast<std::uint8_t>(*it);
+                        }
+                        return n >= 4 && !diff;
+                    }
+
+                    template<typename TagRange>
+                    bool verify(const TagRange &expected) const {
+                        return verify(expected, block_type(), text_octets * 8);
+                    }
+
+                    /*!
+                     * @brief Writes the appended_tag_bits of the tag, the decryption checks the expected
+                     * tag instead and throws authentication_error when it does not match
+                     */
+                    template<typename OutputIterator>
+                    OutputIterator end_authentication(const block_type &last, std::size_t total_seen,
+                                                      OutputIterator out) const {
+                        if (policy_type::encrypting) {
+                            tag_type t = tag(last, total_seen);
+                            return std::copy(t.begin(), t.end(), out);
+                        }
+
+                        if (!verify(boost::make_iterator_range(expected_tag.begin(),
+                                                               expected_tag.begin() + expected_tag_octets),
+                                    last, total_seen)) {
+                            BOOST_THROW_EXCEPTION(authentication_error());
+                        }
+                        return out;
+                    }
+
                 protected:
+                    template<typename InputIterator>
+                    void schedule_iv(InputIterator first, InputIterator last) {
+                        std::uint8_t iv[ghash::block_bytes];
+                        std::size_t iv_octets = 0;
+                        ghash h = hash;
+
+                        for (; first != last; ++first) {
+                            iv[iv_octets++ % ghash::block_bytes] = static_cast<std::uint8_t>(*first);
+                            if (iv_octets % ghash::block_bytes == 0) {
+                                h.update(iv, ghash::block_bytes);
+                            }
+                        }
+
+                        if (iv_octets == 12) {
+                            // J0 = IV || 0^31 || 1
+                            std::copy(iv, iv + 12, counter.begin());
+                            store_be32(counter.data() + 12, 1);
+                        } else {
+                            // J0 = GHASH(IV || 0^s || 0^64 || [len(IV)]_64)
+                            if (!iv_octets) {
+                                BOOST_THROW_EXCEPTION(std::invalid_argument("GCM IV is empty"));
+                            }
+                            h.update(iv, iv_octets % ghash::block_bytes);
+                            block_type lengths = block_type();
+                            store_be(lengths.data() + 8, std::uint64_t(iv_octets) * 8);
+                            h.update(&lengths, 1);
+                            counter = h.digest();
+                        }
+
+                        tag_mask = cipher.encrypt(counter);
+                        increment(counter);
+                    }
+
+                    void finish_aad() {
+                        if (aad_used) {
+                            hash.update(aad_block.data(), aad_used);
+                            aad_used = 0;
+                        }
+                    }
+
+                    void absorb_input(const block_type *blocks, std::size_t n) {
+                        if (!policy_type::encrypting) {
+                            hash.update(blocks, n);
+                        }
+                    }
+
+                    void absorb_output(const block_type *blocks, std::size_t n) {
+                        if (policy_type::encrypting) {
+                            hash.update(blocks, n);
+                        }
+                    }
+
+                    void generate_keystream(block_type *out) {
+                        block_type counters[pipeline_blocks];
+                        for (std::size_t i = 0; i != pipeline_blocks; ++i) {
+                            counters[i] = counter;
+                            increment(counter);
+                        }
+                        encrypt_counters(counters, out,
+                                         std::integral_constant<bool,
+                                                                has_encrypt_blocks<cipher_type, block_type>::value>());
+                    }
+
+                    void encrypt_counters(const block_type *in, block_type *out, std::true_type) const {
+                        cipher.encrypt_blocks(in, out, pipeline_blocks);
+                    }
+
+                    void encrypt_counters(const block_type *in, block_type *out, std::false_type) const {
+                        for (std::size_t i = 0; i != pipeline_blocks; ++i) {
+                            out[i] = cipher.encrypt(in[i]);
+                        }
+                    }
+
+                    /*!
+                     * @brief inc32, only the rightmost 32 bits of the counter block are incremented
+                     */
+                    static inline void increment(block_type &block) {
+                        for (std::size_t i = block.size(); i-- != block.size() - 4 && !++block[i];) {
+                        }
+                    }
+
+                    static inline block_type xor_block(const block_type &a, const block_type &b) {
+                        block_type c;
+                        for (std::size_t i = 0; i != c.size(); ++i) {
+                            c[i] = a[i] ^ b[i];
+                        }
+                        return c;
+                    }
+
+                    static inline void store_be(std::uint8_t *p, std::uint64_t x) {
+                        for (std::size_t i = 8; i--; x >>= 8) {
+                            p[i] = static_cast<std::uint8_t>(x);
+                        }
+                    }
+
+                    static inline void store_be32(std::uint8_t *p, std::uint32_t x) {
+                        for (std::size_t i = 4; i--; x >>= 8) {
+                            p[i] = static_cast<std::uint8_t>(x);
+                        }
+                    }
+
                     cipher_type cipher;
+                    ghash hash;
+                    block_type counter, tag_mask;
+                    std::uint64_t blocks_left;
+                    std::array<block_type, pipeline_blocks> keystream;
+                    std::size_t keystream_used;
+                    block_type aad_block;
+                    std::size_t aad_used;
+                    std::uint64_t aad_octets, text_octets;
+                    tag_type expected_tag;
+                    std::size_t expected_tag_octets;
                 };
             }    // namespace detail
 
@@ -123,6 +1194,82 @@ namespace boost {
                         typedef detail::isomorphic<Policy> type;
                     };
                 };
+
+                /*!
+                 * @brief Counter mode, turns the cipher into a stream cipher
+                 * @tparam Cipher Block cipher
+                 * @tparam Padding Unused, counter mode does not pad the input
+                 */
+                template<typename Cipher, template<typename> class Padding>
+                struct ctr {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::ctr_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::ctr_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::ctr<Policy> type;
+                    };
+                };
+
+                /*!
+                 * @brief Cipher block chaining mode
+                 * @tparam Cipher Block cipher
+                 * @tparam Padding nop_padding, pkcs7_padding or cts_padding
+                 */
+                template<typename Cipher, template<typename> class Padding>
+                struct cbc {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::cbc_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::cbc_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::cbc<Policy> type;
+                    };
+                };
+
+                /*!
+                 * @brief XTS mode for sector-level storage encryption, takes a data and a tweak cipher
+                 * keyed with distinct halves of the XTS key
+                 * @tparam Cipher Block cipher with 128-bit blocks
+                 */
+                template<typename Cipher>
+                struct xts {
+                    typedef Cipher cipher_type;
+                    typedef nop_padding<Cipher> padding_type;
+
+                    typedef detail::xts_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::xts_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::xts<Policy> type;
+                    };
+                };
+
+                /*!
+                 * @brief Galois/Counter mode, authenticated encryption with associated data
+                 * @tparam Cipher Block cipher with 128-bit blocks
+                 * @tparam Padding Unused, the payload is not padded
+                 */
+                template<typename Cipher, template<typename> class Padding>
+                struct gcm {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::gcm_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::gcm_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::gcm<Policy> type;
+                    };
+                };
             }    // namespace modes
         }        // namespace block
     }            // namespace crypto3
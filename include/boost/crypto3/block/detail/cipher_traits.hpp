@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_CIPHER_TRAITS_HPP
+#define CRYPTO3_BLOCK_CIPHER_TRAITS_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief has_encrypt_blocks trait checks whether the cipher (or its implementation)
+                 * is able to encrypt several independent blocks with a single call, i.e. provides
+                 * encrypt_blocks(const block_type *, block_type *, std::size_t, Args...). Modes
+                 * with independent blocks use it to keep several blocks in flight, and fall back
+                 * to an encrypt loop otherwise.
+                 *
+                 * @tparam Cipher
+                 * @tparam BlockType Block type of the cipher
+                 * @tparam Args Additional arguments, e.g. the key schedule for implementations
+                 */
+                template<typename Cipher, typename BlockType, typename... Args>
+                struct has_encrypt_blocks {
+                private:
+                    template<typename C>
+                    static auto test(int) -> decltype(std::declval<const C &>().encrypt_blocks(
+                                                          std::declval<const BlockType *>(),
+                                                          std::declval<BlockType *>(), std::declval<std::size_t>(),
+                                                          std::declval<Args>()...),
+                                                      std::true_type());
+
+                    template<typename C>
+                    static std::false_type test(...);
+
+                public:
+                    constexpr static const bool value = decltype(test<Cipher>(0))::value;
+                };
+
+                /*!
+                 * @brief has_decrypt_blocks trait checks whether the cipher (or its implementation)
+                 * is able to decrypt several independent blocks with a single call, the counterpart
+                 * of has_encrypt_blocks used by modes with parallel decryption, e.g. CBC.
+                 *
+                 * @tparam Cipher
+                 * @tparam BlockType Block type of the cipher
+                 * @tparam Args Additional arguments, e.g. the key schedule for implementations
+                 */
+                template<typename Cipher, typename BlockType, typename... Args>
+                struct has_decrypt_blocks {
+                private:
+                    template<typename C>
+                    static auto test(int) -> decltype(std::declval<const C &>().decrypt_blocks(
+                                                          std::declval<const BlockType *>(),
+                                                          std::declval<BlockType *>(), std::declval<std::size_t>(),
+                                                          std::declval<Args>()...),
+                                                      std::true_type());
+
+                    template<typename C>
+                    static std::false_type test(...);
+
+                public:
+                    constexpr static const bool value = decltype(test<Cipher>(0))::value;
+                };
+
+                /*!
+                 * @brief is_authenticated_mode trait checks whether the mode produces an authentication
+                 * tag, i.e. defines appended_tag_bits and end_authentication
+                 *
+                 * @tparam Mode
+                 */
+                template<typename Mode>
+                struct is_authenticated_mode {
+                private:
+                    template<typename M>
+                    static auto test(int) -> decltype(M::appended_tag_bits, std::true_type());
+
+                    template<typename M>
+                    static std::false_type test(...);
+
+                public:
+                    constexpr static const bool value = decltype(test<Mode>(0))::value;
+                };
+
+                /*!
+                 * @brief has_final_blocks trait checks whether the mode finishes the message with a
+                 * variable amount of output, i.e. defines final_blocks, the most blocks it emits, and
+                 * end_message(last, total_seen, out) returning the amount of values written to out.
+                 * Padding modes use it to extend, truncate or strip the message.
+                 *
+                 * @tparam Mode
+                 */
+                template<typename Mode>
+                struct has_final_blocks {
+                private:
+                    template<typename M>
+                    static auto test(int) -> decltype(M::final_blocks, std::true_type());
+
+                    template<typename M>
+                    static std::false_type test(...);
+
+                public:
+                    constexpr static const bool value = decltype(test<Mode>(0))::value;
+                };
+
+                /*!
+                 * @brief output_delay_blocks trait holds the amount of blocks the mode keeps before
+                 * producing output, process_block returns the output of that many blocks before.
+                 * Modes rewriting the tail of the message (e.g. ciphertext stealing) define
+                 * delayed_blocks, others output every block immediately.
+                 *
+                 * @tparam Mode
+                 */
+                template<typename Mode>
+                struct output_delay_blocks {
+                private:
+                    template<typename M>
+                    static auto test(int) -> std::integral_constant<std::size_t, M::delayed_blocks>;
+
+                    template<typename M>
+                    static std::integral_constant<std::size_t, 0> test(...);
+
+                public:
+                    constexpr static const std::size_t value = decltype(test<Mode>(0))::value;
+                };
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLOCK_CIPHER_TRAITS_HPP
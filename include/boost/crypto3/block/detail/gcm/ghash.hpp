@@ -0,0 +1,134 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_GHASH_HPP
+#define CRYPTO3_BLOCK_GHASH_HPP
+
+#include <boost/crypto3/block/detail/gcm/ghash_impl.hpp>
+#include <boost/crypto3/block/detail/gcm/ghash_clmul_impl.hpp>
+
+#include <boost/crypto3/detail/secure_zero.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief GHASH universal hash of NIST SP 800-38D. Blocks are buffered until
+                 * aggregated_blocks of them can be multiplied with a single reduction. PCLMULQDQ is
+                 * used when the processor has it, the portable constant-time implementation otherwise.
+                 */
+                class ghash {
+                public:
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    constexpr static const std::size_t block_bytes = 16;
+                    constexpr static const std::size_t aggregated_blocks = 8;
+
+                    /*!
+                     * @param h Hash subkey, the encryption of the all-zero block
+                     */
+                    explicit ghash(const block_type &h) : h(h), y(), buffered(0), clmul(false) {
+#ifdef CRYPTO3_BLOCK_HAS_GHASH_CLMUL
+                        clmul = ghash_clmul_impl::is_available();
+                        if (clmul) {
+                            ghash_clmul_impl::schedule_key(h, powers);
+                        }
+#endif
+                    }
+
+                    ~ghash() {
+                        ::boost::crypto3::detail::secure_zero(h.data(), h.size());
+#ifdef CRYPTO3_BLOCK_HAS_GHASH_CLMUL
+                        for (block_type &p : powers) {
+                            ::boost::crypto3::detail::secure_zero(p.data(), p.size());
+                        }
+#endif
+                    }
+
+                    /*!
+                     * @brief Absorbs n whole blocks
+                     */
+                    void update(const block_type *blocks, std::size_t n) {
+                        if (buffered) {
+                            for (; n && buffered != aggregated_blocks; --n) {
+                                buffer[buffered++] = *blocks++;
+                            }
+                            if (buffered != aggregated_blocks) {
+                                return;
+                            }
+                            process_blocks(buffer.data(), aggregated_blocks);
+                            buffered = 0;
+                        }
+
+                        std::size_t whole = n - n % aggregated_blocks;
+                        process_blocks(blocks, whole);
+
+                        for (blocks += whole, n -= whole; n; --n) {
+                            buffer[buffered++] = *blocks++;
+                        }
+                    }
+
+                    /*!
+                     * @brief Absorbs n octets, the last partial block is padded with zeros
+                     */
+                    void update(const std::uint8_t *octets, std::size_t n) {
+                        block_type block;
+                        for (; n >= block_bytes; n -= block_bytes, octets += block_bytes) {
+                            std::memcpy(block.data(), octets, block_bytes);
+                            update(&block, 1);
+                        }
+                        if (n) {
+                            block.fill(0);
+                            std::memcpy(block.data(), octets, n);
+                            update(&block, 1);
+                        }
+                    }
+
+                    /*!
+                     * @brief Current value of the hash, buffered blocks are absorbed
+                     */
+                    const block_type &digest() {
+                        process_blocks(buffer.data(), buffered);
+                        buffered = 0;
+                        return y;
+                    }
+
+                protected:
+                    void process_blocks(const block_type *blocks, std::size_t n) {
+                        if (!n) {
+                            return;
+                        }
+#ifdef CRYPTO3_BLOCK_HAS_GHASH_CLMUL
+                        if (clmul) {
+                            ghash_clmul_impl::process_blocks(y, powers, blocks, n);
+                            return;
+                        }
+#endif
+                        ghash_portable_impl::process_blocks(y, h, blocks, n);
+                    }
+
+                    block_type h, y;
+#ifdef CRYPTO3_BLOCK_HAS_GHASH_CLMUL
+                    ghash_clmul_impl::powers_type powers;
+#endif
+                    std::array<block_type, aggregated_blocks> buffer;
+                    std::size_t buffered;
+                    bool clmul;
+                };
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLOCK_GHASH_HPP
@@ -0,0 +1,177 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_GHASH_CLMUL_IMPL_HPP
+#define CRYPTO3_BLOCK_GHASH_CLMUL_IMPL_HPP
+
+#include <boost/predef/architecture.h>
+
+#include <boost/crypto3/detail/config.hpp>
+
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_BLOCK_HAS_GHASH_CLMUL
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+#ifdef CRYPTO3_BLOCK_HAS_GHASH_CLMUL
+                /*!
+                 * @brief GHASH with PCLMULQDQ. Operands are kept byte-reversed in registers, products
+                 * are reduced as in Intel's "Carry-Less Multiplication and Its Usage for Computing
+                 * the GCM Mode" white paper. Runs of aggregated_blocks blocks are multiplied by
+                 * the powers of H and summed before a single reduction.
+                 */
+                struct ghash_clmul_impl {
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    constexpr static const std::size_t aggregated_blocks = 8;
+
+                    typedef std::array<block_type, aggregated_blocks> powers_type;
+
+                    static bool is_available() {
+                        return cpuid::has_clmul() && cpuid::has_ssse3();
+                    }
+
+                    /*!
+                     * @brief Computes H^1 to H^aggregated_blocks in the register representation
+                     */
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static void schedule_key(const block_type &h, powers_type &powers) {
+                        const __m128i h1 = load(h);
+                        __m128i p = h1;
+
+                        store_raw(powers[0], p);
+                        for (std::size_t i = 1; i != aggregated_blocks; ++i) {
+                            p = multiply(p, h1);
+                            store_raw(powers[i], p);
+                        }
+                    }
+
+                    /*!
+                     * @brief Absorbs n blocks into the GHASH state y
+                     */
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static void process_blocks(block_type &y, const powers_type &powers, const block_type *blocks,
+                                               std::size_t n) {
+                        __m128i a = load(y);
+
+                        for (; n >= aggregated_blocks; n -= aggregated_blocks, blocks += aggregated_blocks) {
+                            __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128(), mid = _mm_setzero_si128();
+
+                            // The i-th block of the run is multiplied by H^(aggregated_blocks - i)
+                            for (std::size_t i = 0; i != aggregated_blocks; ++i) {
+                                __m128i x = load(blocks[i]);
+                                if (i == 0) {
+                                    x = _mm_xor_si128(x, a);
+                                }
+                                __m128i h = load_raw(powers[aggregated_blocks - 1 - i]);
+
+                                lo = _mm_xor_si128(lo, _mm_clmulepi64_si128(x, h, 0x00));
+                                hi = _mm_xor_si128(hi, _mm_clmulepi64_si128(x, h, 0x11));
+                                mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(fold(x), fold(h), 0x00));
+                            }
+
+                            a = reduce(lo, hi, mid);
+                        }
+
+                        const __m128i h1 = load_raw(powers[0]);
+                        for (; n; --n, ++blocks) {
+                            a = multiply(_mm_xor_si128(a, load(*blocks)), h1);
+                        }
+
+                        store(y, a);
+                    }
+
+                protected:
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline __m128i multiply(__m128i x, __m128i h) {
+                        return reduce(_mm_clmulepi64_si128(x, h, 0x00), _mm_clmulepi64_si128(x, h, 0x11),
+                                      _mm_clmulepi64_si128(fold(x), fold(h), 0x00));
+                    }
+
+                    /*!
+                     * @brief Reduces the 256-bit product given by its Karatsuba terms, shifting it left
+                     * by one bit first to account for the reflected representation
+                     */
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline __m128i reduce(__m128i lo, __m128i hi, __m128i mid) {
+                        mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+                        __m128i b0 = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+                        __m128i b1 = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+
+                        __m128i t0 = _mm_srli_epi32(b1, 31);
+                        __m128i t1 = _mm_slli_epi32(b1, 1);
+                        __m128i t2 = _mm_srli_epi32(b0, 31);
+                        __m128i t3 = _mm_slli_epi32(b0, 1);
+
+                        t3 = _mm_or_si128(t3, _mm_srli_si128(t0, 12));
+                        t3 = _mm_or_si128(t3, _mm_slli_si128(t2, 4));
+                        t1 = _mm_or_si128(t1, _mm_slli_si128(t0, 4));
+
+                        t0 = _mm_xor_si128(_mm_slli_epi32(t1, 31), _mm_slli_epi32(t1, 30));
+                        t0 = _mm_xor_si128(t0, _mm_slli_epi32(t1, 25));
+
+                        t1 = _mm_xor_si128(t1, _mm_slli_si128(t0, 12));
+
+                        t0 = _mm_xor_si128(t3, _mm_srli_si128(t0, 4));
+                        t0 = _mm_xor_si128(t0, t1);
+                        t0 = _mm_xor_si128(t0, _mm_srli_epi32(t1, 7));
+                        t0 = _mm_xor_si128(t0, _mm_srli_epi32(t1, 1));
+                        t0 = _mm_xor_si128(t0, _mm_srli_epi32(t1, 2));
+                        return t0;
+                    }
+
+                    /*!
+                     * @brief Sum of the two 64-bit halves, the middle Karatsuba operand
+                     */
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline __m128i fold(__m128i x) {
+                        return _mm_xor_si128(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline __m128i load(const block_type &b) {
+                        return _mm_shuffle_epi8(load_raw(b), byte_reverse_mask());
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline void store(block_type &b, __m128i x) {
+                        store_raw(b, _mm_shuffle_epi8(x, byte_reverse_mask()));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline __m128i load_raw(const block_type &b) {
+                        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(b.data()));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline void store_raw(block_type &b, __m128i x) {
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(b.data()), x);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline __m128i byte_reverse_mask() {
+                        return _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLOCK_GHASH_CLMUL_IMPL_HPP
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_GHASH_IMPL_HPP
+#define CRYPTO3_BLOCK_GHASH_IMPL_HPP
+
+#include <boost/endian/conversion.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief Portable GHASH multiplication in GF(2^128). Uses neither tables nor
+                 * data-dependent branches: carry-less 64-bit products are assembled from integer
+                 * multiplications of operands with holes in every fourth bit, so that carries never
+                 * reach a meaningful bit. The bit-reflected halves are multiplied the same way
+                 * to recover the upper halves of the products.
+                 */
+                struct ghash_portable_impl {
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    /*!
+                     * @brief Absorbs n blocks into the GHASH state y keyed with h
+                     */
+                    static void process_blocks(block_type &y, const block_type &h, const block_type *blocks,
+                                               std::size_t n) {
+                        std::uint64_t y1 = load_be(y.data()), y0 = load_be(y.data() + 8);
+                        std::uint64_t h1 = load_be(h.data()), h0 = load_be(h.data() + 8);
+                        std::uint64_t h0r = rev64(h0), h1r = rev64(h1);
+                        std::uint64_t h2 = h0 ^ h1, h2r = h0r ^ h1r;
+
+                        for (const block_type *last = blocks + n; blocks != last; ++blocks) {
+                            y1 ^= load_be(blocks->data());
+                            y0 ^= load_be(blocks->data() + 8);
+
+                            std::uint64_t y0r = rev64(y0), y1r = rev64(y1);
+                            std::uint64_t y2 = y0 ^ y1, y2r = y0r ^ y1r;
+
+                            // Karatsuba over the low halves and over the reflected ones
+                            std::uint64_t z0 = bmul64(y0, h0), z1 = bmul64(y1, h1), z2 = bmul64(y2, h2);
+                            std::uint64_t z0h = bmul64(y0r, h0r), z1h = bmul64(y1r, h1r), z2h = bmul64(y2r, h2r);
+                            z2 ^= z0 ^ z1;
+                            z2h ^= z0h ^ z1h;
+                            z0h = rev64(z0h) >> 1;
+                            z1h = rev64(z1h) >> 1;
+                            z2h = rev64(z2h) >> 1;
+
+                            std::uint64_t v0 = z0, v1 = z0h ^ z2, v2 = z1 ^ z2h, v3 = z1h;
+
+                            // The product of bit-reflected operands is shifted by one bit
+                            v3 = (v3 << 1) | (v2 >> 63);
+                            v2 = (v2 << 1) | (v1 >> 63);
+                            v1 = (v1 << 1) | (v0 >> 63);
+                            v0 = v0 << 1;
+
+                            // Reduction modulo x^128 + x^7 + x^2 + x + 1
+                            v2 ^= v0 ^ (v0 >> 1) ^ (v0 >> 2) ^ (v0 >> 7);
+                            v1 ^= (v0 << 63) ^ (v0 << 62) ^ (v0 << 57);
+                            v3 ^= v1 ^ (v1 >> 1) ^ (v1 >> 2) ^ (v1 >> 7);
+                            v2 ^= (v1 << 63) ^ (v1 << 62) ^ (v1 << 57);
+
+                            y0 = v2;
+                            y1 = v3;
+                        }
+
+                        store_be(y.data(), y1);
+                        store_be(y.data() + 8, y0);
+                    }
+
+                protected:
+                    static inline std::uint64_t bmul64(std::uint64_t x, std::uint64_t y) {
+                        const std::uint64_t m0 = UINT64_C(0x1111111111111111), m1 = UINT64_C(0x2222222222222222),
+                                            m2 = UINT64_C(0x4444444444444444), m3 = UINT64_C(0x8888888888888888);
+
+                        std::uint64_t x0 = x & m0, x1 = x & m1, x2 = x & m2, x3 = x & m3;
+                        std::uint64_t y0 = y & m0, y1 = y & m1, y2 = y & m2, y3 = y & m3;
+
+                        std::uint64_t z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+                        std::uint64_t z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+                        std::uint64_t z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+                        std::uint64_t z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+
+                        return (z0 & m0) | (z1 & m1) | (z2 & m2) | (z3 & m3);
+                    }
+
+                    static inline std::uint64_t rev64(std::uint64_t x) {
+                        x = ((x & UINT64_C(0x5555555555555555)) << 1) | ((x >> 1) & UINT64_C(0x5555555555555555));
+                        x = ((x & UINT64_C(0x3333333333333333)) << 2) | ((x >> 2) & UINT64_C(0x3333333333333333));
+                        x = ((x & UINT64_C(0x0F0F0F0F0F0F0F0F)) << 4) | ((x >> 4) & UINT64_C(0x0F0F0F0F0F0F0F0F));
+                        x = ((x & UINT64_C(0x00FF00FF00FF00FF)) << 8) | ((x >> 8) & UINT64_C(0x00FF00FF00FF00FF));
+                        x = ((x & UINT64_C(0x0000FFFF0000FFFF)) << 16) | ((x >> 16) & UINT64_C(0x0000FFFF0000FFFF));
+                        return (x << 32) | (x >> 32);
+                    }
+
+                    static inline std::uint64_t load_be(const std::uint8_t *p) {
+                        std::uint64_t x;
+                        std::memcpy(&x, p, sizeof(x));
+                        return boost::endian::big_to_native(x);
+                    }
+
+                    static inline void store_be(std::uint8_t *p, std::uint64_t x) {
+                        x = boost::endian::native_to_big(x);
+                        std::memcpy(p, &x, sizeof(x));
+                    }
+                };
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLOCK_GHASH_IMPL_HPP
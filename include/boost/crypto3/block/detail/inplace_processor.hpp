@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_INPLACE_PROCESSOR_HPP
+#define CRYPTO3_BLOCK_INPLACE_PROCESSOR_HPP
+
+#include <boost/crypto3/block/algorithm/block.hpp>
+#include <boost/crypto3/block/detail/cipher_traits.hpp>
+
+#include <boost/crypto3/detail/octet.hpp>
+#include <boost/crypto3/detail/pack.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief is_inplace_mode trait checks whether the mode keeps the message length and
+                 * outputs every block as it comes, so that it can be applied to a buffer in place.
+                 * Padding modes, e.g. CBC with PKCS#7, extend the message and ciphertext stealing
+                 * rewrites its last two blocks on the message end, neither is applied in place.
+                 *
+                 * @tparam Mode
+                 */
+                template<typename Mode>
+                struct is_inplace_mode {
+                    constexpr static const bool value =
+                        output_delay_blocks<Mode>::value == 0 &&
+                        (Mode::length_preserving ||
+                         std::is_same<typename Mode::padding_type, nop_padding<typename Mode::cipher_type>>::value);
+                };
+
+                /*!
+                 * @brief Encrypts or decrypts octets in place through the encrypt_blocks or decrypt_blocks of
+                 * a mode. Blocks made of octets are processed right in the buffer, other ones are packed
+                 * batch_blocks at a time into a buffer on the stack and back.
+                 *
+                 * Whole blocks may be processed by any amount of calls. Length preserving modes, e.g. CTR,
+                 * also take a partial block at the end of the message, other ones, authenticated modes
+                 * included, throw std::invalid_argument on lengths not divisible by the block size.
+                 * Modes padding the message or stealing ciphertext are rejected at compile time, see
+                 * is_inplace_mode.
+                 *
+                 * @tparam Mode Mode bound to its policy, e.g. modes::ctr<aes<128>, nop_padding>::bind<...>::type
+                 */
+                template<typename Mode>
+                struct inplace_processor {
+                    typedef Mode mode_type;
+
+                    BOOST_STATIC_ASSERT_MSG(is_inplace_mode<mode_type>::value,
+                                            "The mode pads the message or steals ciphertext, it can not be "
+                                            "applied in place");
+
+                    typedef typename mode_type::endian_type endian_type;
+                    typedef typename mode_type::block_type block_type;
+                    typedef typename block_type::value_type value_type;
+
+                    constexpr static const std::size_t block_bits = mode_type::block_bits;
+                    constexpr static const std::size_t block_octets = block_bits / octet_bits;
+                    constexpr static const std::size_t value_bits = sizeof(value_type) * CHAR_BIT;
+
+                    constexpr static const std::size_t batch_blocks = 64;
+
+                    /*!
+                     * @brief Whether the octets of the buffer are the values of its blocks as they are
+                     */
+                    constexpr static const bool direct =
+                        value_bits == octet_bits && sizeof(block_type) == block_octets &&
+                        alignof(block_type) == 1 &&
+                        ::boost::crypto3::detail::can_memcpy<endian_type, octet_bits, value_bits, octet_type,
+                                                             value_type>::value;
+
+                    constexpr static const bool partial_blocks =
+                        mode_type::length_preserving && !is_authenticated_mode<mode_type>::value;
+
+                    static void encrypt(mode_type &mode, octet_type *data, std::size_t n) {
+                        process(mode, data, n, std::true_type());
+                    }
+
+                    static void decrypt(mode_type &mode, octet_type *data, std::size_t n) {
+                        process(mode, data, n, std::false_type());
+                    }
+
+                protected:
+                    template<typename Encrypting>
+                    static void process(mode_type &mode, octet_type *data, std::size_t n, Encrypting e) {
+                        std::size_t tail = n % block_octets;
+                        if (tail && !partial_blocks) {
+                            throw std::invalid_argument("in-place length is not a multiple of the block size");
+                        }
+
+                        process_blocks(mode, data, n / block_octets, e, std::integral_constant<bool, direct>());
+                        if (tail) {
+                            process_tail(mode, data + n - tail, tail, std::integral_constant<bool, partial_blocks>());
+                        }
+                    }
+
+                    template<typename Encrypting>
+                    static void process_blocks(mode_type &mode, octet_type *data, std::size_t blocks, Encrypting e,
+                                               std::true_type) {
+                        block_type *b = reinterpret_cast<block_type *>(data);
+                        run(mode, b, blocks, e);
+                    }
+
+                    template<typename Encrypting>
+                    static void process_blocks(mode_type &mode, octet_type *data, std::size_t blocks, Encrypting e,
+                                               std::false_type) {
+                        std::array<block_type, batch_blocks> batch;
+                        while (blocks) {
+                            std::size_t count = blocks < batch_blocks ? blocks : batch_blocks;
+                            for (std::size_t i = 0; i != count; ++i) {
+                                load(data + i * block_octets, batch[i]);
+                            }
+                            run(mode, batch.data(), count, e);
+                            for (std::size_t i = 0; i != count; ++i) {
+                                store(batch[i], data + i * block_octets);
+                            }
+                            data += count * block_octets;
+                            blocks -= count;
+                        }
+                    }
+
+                    static void process_tail(mode_type &mode, octet_type *data, std::size_t tail, std::true_type) {
+                        std::array<octet_type, block_octets> octets = {};
+                        std::copy(data, data + tail, octets.begin());
+
+                        block_type block;
+                        load(octets.data(), block);
+                        store(mode.end_message(block, tail * octet_bits), octets.data());
+                        std::copy(octets.begin(), octets.begin() + tail, data);
+                    }
+
+                    static void process_tail(mode_type &, octet_type *, std::size_t, std::false_type) {
+                    }
+
+                    static void run(mode_type &mode, block_type *blocks, std::size_t n, std::true_type) {
+                        mode.encrypt_blocks(blocks, blocks, n);
+                    }
+
+                    static void run(mode_type &mode, block_type *blocks, std::size_t n, std::false_type) {
+                        mode.decrypt_blocks(blocks, blocks, n);
+                    }
+
+                    static void load(const octet_type *in, block_type &block) {
+                        ::boost::crypto3::detail::pack_to<endian_type, octet_bits, value_bits>(
+                            in, in + block_octets, block.begin());
+                    }
+
+                    static void store(const block_type &block, octet_type *out) {
+                        // The output is passed as a prvalue, an lvalue iterator also matches the in place overload
+                        ::boost::crypto3::detail::pack<endian_type, endian_type, value_bits, octet_bits>(
+                            block.begin(), block.end(), &out[0]);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLOCK_INPLACE_PROCESSOR_HPP
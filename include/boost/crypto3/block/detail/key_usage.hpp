@@ -0,0 +1,28 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_KEY_USAGE_HPP
+#define CRYPTO3_BLOCK_KEY_USAGE_HPP
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @brief Directions a cipher key is expanded for. Ciphers with distinct encryption and
+             * decryption schedules skip or wipe the one which is not requested.
+             */
+            enum class key_usage {
+                encryption,
+                decryption,
+                both
+            };
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLOCK_KEY_USAGE_HPP
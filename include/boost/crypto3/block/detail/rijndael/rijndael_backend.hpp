@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_RIJNDAEL_BACKEND_HPP
+#define CRYPTO3_RIJNDAEL_BACKEND_HPP
+
+#include <boost/predef/architecture.h>
+
+#include <boost/crypto3/detail/config.hpp>
+
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_BLOCK_HAS_RIJNDAEL_X86
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @brief Rijndael implementations selectable at runtime. The x86 ones are always compiled
+             * in with per-function target attributes and picked through cpuid, so CRYPTO3_CLEAR_CPUID
+             * (e.g. CRYPTO3_CLEAR_CPUID=aesni,ssse3) masks them as well. ARMv8 and POWER8 ones require
+             * dedicated compiler flags and are available when built with CRYPTO3_HAS_RIJNDAEL_ARMV8
+             * or CRYPTO3_HAS_RIJNDAEL_POWER8.
+             */
+            enum class rijndael_backend {
+                /// The fastest backend the processor supports
+                automatic,
+                /// Table-based portable implementation, the only one for blocks wider than 128 bits
+                portable,
+                /// Constant-time bitsliced implementation on 64-bit words, four blocks at once
+                bitsliced,
+                /// Vector permutation implementation, constant time without hardware AES
+                ssse3,
+                aes_ni,
+                armv8,
+                power8
+            };
+
+            namespace detail {
+                /*!
+                 * @brief Whether the backend is compiled in and supported by the processor
+                 */
+                inline bool is_rijndael_backend_available(rijndael_backend backend) {
+                    switch (backend) {
+                        case rijndael_backend::automatic:
+                        case rijndael_backend::portable:
+                        case rijndael_backend::bitsliced:
+                            return true;
+#ifdef CRYPTO3_BLOCK_HAS_RIJNDAEL_X86
+                        case rijndael_backend::ssse3:
+                            return cpuid::has_ssse3();
+                        case rijndael_backend::aes_ni:
+                            return cpuid::has_aes_ni() && cpuid::has_ssse3();
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
+                        case rijndael_backend::armv8:
+                            return true;
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
+                        case rijndael_backend::power8:
+                            return true;
+#endif
+                        default:
+                            return false;
+                    }
+                }
+
+                /*!
+                 * @brief Resolves automatic to the fastest available backend for the block size
+                 */
+                inline rijndael_backend select_rijndael_backend(rijndael_backend backend, bool hardware_block) {
+                    if (backend != rijndael_backend::automatic) {
+                        return hardware_block ? backend : rijndael_backend::portable;
+                    }
+                    if (hardware_block) {
+                        const rijndael_backend preferred[] = {rijndael_backend::aes_ni, rijndael_backend::armv8,
+                                                              rijndael_backend::power8, rijndael_backend::ssse3,
+                                                              rijndael_backend::bitsliced};
+                        for (rijndael_backend b : preferred) {
+                            if (is_rijndael_backend_available(b)) {
+                                return b;
+                            }
+                        }
+                    }
+                    return rijndael_backend::portable;
+                }
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_RIJNDAEL_BACKEND_HPP
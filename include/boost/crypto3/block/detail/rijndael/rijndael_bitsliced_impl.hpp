@@ -0,0 +1,560 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_RIJNDAEL_BITSLICED_IMPL_HPP
+#define CRYPTO3_RIJNDAEL_BITSLICED_IMPL_HPP
+
+#include <boost/endian/conversion.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/crypto3/detail/secure_zero.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief Constant-time AES on 64-bit words. Four blocks are bitsliced into eight
+                 * words, the S-box is the Boyar-Peralta circuit, so neither memory accesses nor
+                 * branches depend on the key or the data. The layout follows T. Pornin's aes_ct64.
+                 */
+                class rijndael_bitsliced_functions {
+                public:
+                    typedef std::uint64_t word_type;
+
+                    constexpr static const std::size_t parallel_blocks = 4;
+                    constexpr static const std::size_t state_words = 8;
+
+                    static inline void sbox(word_type *q) {
+                        // Variables x* (input) and s* (output) are numbered in reverse, x0 is the high bit
+                        word_type x0 = q[7], x1 = q[6], x2 = q[5], x3 = q[4], x4 = q[3], x5 = q[2], x6 = q[1],
+                                  x7 = q[0];
+
+                        // Top linear transformation
+                        word_type y14 = x3 ^ x5;
+                        word_type y13 = x0 ^ x6;
+                        word_type y9 = x0 ^ x3;
+                        word_type y8 = x0 ^ x5;
+                        word_type t0 = x1 ^ x2;
+                        word_type y1 = t0 ^ x7;
+                        word_type y4 = y1 ^ x3;
+                        word_type y12 = y13 ^ y14;
+                        word_type y2 = y1 ^ x0;
+                        word_type y5 = y1 ^ x6;
+                        word_type y3 = y5 ^ y8;
+                        word_type t1 = x4 ^ y12;
+                        word_type y15 = t1 ^ x5;
+                        word_type y20 = t1 ^ x1;
+                        word_type y6 = y15 ^ x7;
+                        word_type y10 = y15 ^ t0;
+                        word_type y11 = y20 ^ y9;
+                        word_type y7 = x7 ^ y11;
+                        word_type y17 = y10 ^ y11;
+                        word_type y19 = y10 ^ y8;
+                        word_type y16 = t0 ^ y11;
+                        word_type y21 = y13 ^ y16;
+                        word_type y18 = x0 ^ y16;
+
+                        // Non-linear section
+                        word_type t2 = y12 & y15;
+                        word_type t3 = y3 & y6;
+                        word_type t4 = t3 ^ t2;
+                        word_type t5 = y4 & x7;
+                        word_type t6 = t5 ^ t2;
+                        word_type t7 = y13 & y16;
+                        word_type t8 = y5 & y1;
+                        word_type t9 = t8 ^ t7;
+                        word_type t10 = y2 & y7;
+                        word_type t11 = t10 ^ t7;
+                        word_type t12 = y9 & y11;
+                        word_type t13 = y14 & y17;
+                        word_type t14 = t13 ^ t12;
+                        word_type t15 = y8 & y10;
+                        word_type t16 = t15 ^ t12;
+                        word_type t17 = t4 ^ t14;
+                        word_type t18 = t6 ^ t16;
+                        word_type t19 = t9 ^ t14;
+                        word_type t20 = t11 ^ t16;
+                        word_type t21 = t17 ^ y20;
+                        word_type t22 = t18 ^ y19;
+                        word_type t23 = t19 ^ y21;
+                        word_type t24 = t20 ^ y18;
+
+                        word_type t25 = t21 ^ t22;
+                        word_type t26 = t21 & t23;
+                        word_type t27 = t24 ^ t26;
+                        word_type t28 = t25 & t27;
+                        word_type t29 = t28 ^ t22;
+                        word_type t30 = t23 ^ t24;
+                        word_type t31 = t22 ^ t26;
+                        word_type t32 = t31 & t30;
+                        word_type t33 = t32 ^ t24;
+                        word_type t34 = t23 ^ t33;
+                        word_type t35 = t27 ^ t33;
+                        word_type t36 = t24 & t35;
+                        word_type t37 = t36 ^ t34;
+                        word_type t38 = t27 ^ t36;
+                        word_type t39 = t29 & t38;
+                        word_type t40 = t25 ^ t39;
+
+                        word_type t41 = t40 ^ t37;
+                        word_type t42 = t29 ^ t33;
+                        word_type t43 = t29 ^ t40;
+                        word_type t44 = t33 ^ t37;
+                        word_type t45 = t42 ^ t41;
+                        word_type z0 = t44 & y15;
+                        word_type z1 = t37 & y6;
+                        word_type z2 = t33 & x7;
+                        word_type z3 = t43 & y16;
+                        word_type z4 = t40 & y1;
+                        word_type z5 = t29 & y7;
+                        word_type z6 = t42 & y11;
+                        word_type z7 = t45 & y17;
+                        word_type z8 = t41 & y10;
+                        word_type z9 = t44 & y12;
+                        word_type z10 = t37 & y3;
+                        word_type z11 = t33 & y4;
+                        word_type z12 = t43 & y13;
+                        word_type z13 = t40 & y5;
+                        word_type z14 = t29 & y2;
+                        word_type z15 = t42 & y9;
+                        word_type z16 = t45 & y14;
+                        word_type z17 = t41 & y8;
+
+                        // Bottom linear transformation
+                        word_type t46 = z15 ^ z16;
+                        word_type t47 = z10 ^ z11;
+                        word_type t48 = z5 ^ z13;
+                        word_type t49 = z9 ^ z10;
+                        word_type t50 = z2 ^ z12;
+                        word_type t51 = z2 ^ z5;
+                        word_type t52 = z7 ^ z8;
+                        word_type t53 = z0 ^ z3;
+                        word_type t54 = z6 ^ z7;
+                        word_type t55 = z16 ^ z17;
+                        word_type t56 = z12 ^ t48;
+                        word_type t57 = t50 ^ t53;
+                        word_type t58 = z4 ^ t46;
+                        word_type t59 = z3 ^ t54;
+                        word_type t60 = t46 ^ t57;
+                        word_type t61 = z14 ^ t57;
+                        word_type t62 = t52 ^ t58;
+                        word_type t63 = t49 ^ t58;
+                        word_type t64 = z4 ^ t59;
+                        word_type t65 = t61 ^ t62;
+                        word_type t66 = z1 ^ t63;
+                        word_type s0 = t59 ^ t63;
+                        word_type s6 = t56 ^ ~t62;
+                        word_type s7 = t48 ^ ~t60;
+                        word_type t67 = t64 ^ t65;
+                        word_type s3 = t53 ^ t66;
+                        word_type s4 = t51 ^ t66;
+                        word_type s5 = t47 ^ t65;
+                        word_type s1 = t64 ^ ~s3;
+                        word_type s2 = t55 ^ ~t67;
+
+                        q[7] = s0;
+                        q[6] = s1;
+                        q[5] = s2;
+                        q[4] = s3;
+                        q[3] = s4;
+                        q[2] = s5;
+                        q[1] = s6;
+                        q[0] = s7;
+                    }
+
+                    /*!
+                     * @brief The inverse S-box is the forward one wrapped into the inverse affine transform
+                     */
+                    static inline void inverted_sbox(word_type *q) {
+                        inverted_affine(q);
+                        sbox(q);
+                        inverted_affine(q);
+                    }
+
+                    /*!
+                     * @brief Transposes the 8x8 bit matrices, converting between the interleaved
+                     * and the bitsliced representations in both directions
+                     */
+                    static inline void ortho(word_type *q) {
+                        swap<0x5555555555555555, 1>(q[0], q[1]);
+                        swap<0x5555555555555555, 1>(q[2], q[3]);
+                        swap<0x5555555555555555, 1>(q[4], q[5]);
+                        swap<0x5555555555555555, 1>(q[6], q[7]);
+
+                        swap<0x3333333333333333, 2>(q[0], q[2]);
+                        swap<0x3333333333333333, 2>(q[1], q[3]);
+                        swap<0x3333333333333333, 2>(q[4], q[6]);
+                        swap<0x3333333333333333, 2>(q[5], q[7]);
+
+                        swap<0x0F0F0F0F0F0F0F0F, 4>(q[0], q[4]);
+                        swap<0x0F0F0F0F0F0F0F0F, 4>(q[1], q[5]);
+                        swap<0x0F0F0F0F0F0F0F0F, 4>(q[2], q[6]);
+                        swap<0x0F0F0F0F0F0F0F0F, 4>(q[3], q[7]);
+                    }
+
+                    /*!
+                     * @brief Spreads the four little-endian words of a block over two state words
+                     */
+                    static inline void interleave_in(word_type &q0, word_type &q1, const std::uint32_t *w) {
+                        word_type x[4];
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            x[i] = w[i];
+                            x[i] = (x[i] | x[i] << 16) & 0x0000FFFF0000FFFF;
+                            x[i] = (x[i] | x[i] << 8) & 0x00FF00FF00FF00FF;
+                        }
+                        q0 = x[0] | x[2] << 8;
+                        q1 = x[1] | x[3] << 8;
+                    }
+
+                    static inline void interleave_out(std::uint32_t *w, word_type q0, word_type q1) {
+                        word_type x[4] = {q0 & 0x00FF00FF00FF00FF, q1 & 0x00FF00FF00FF00FF,
+                                          (q0 >> 8) & 0x00FF00FF00FF00FF, (q1 >> 8) & 0x00FF00FF00FF00FF};
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            x[i] = (x[i] | x[i] >> 8) & 0x0000FFFF0000FFFF;
+                            w[i] = static_cast<std::uint32_t>(x[i]) | static_cast<std::uint32_t>(x[i] >> 16);
+                        }
+                    }
+
+                    /*!
+                     * @brief Loads up to four blocks into the bitsliced state, missing ones are zeroes
+                     */
+                    static inline void load_blocks(word_type *q, const std::uint8_t *in, std::size_t n) {
+                        std::uint32_t w[parallel_blocks * 4] = {0};
+                        std::memcpy(w, in, n * 16);
+                        for (std::uint32_t &x : w) {
+                            boost::endian::little_to_native_inplace(x);
+                        }
+                        for (std::size_t i = 0; i != parallel_blocks; ++i) {
+                            interleave_in(q[i], q[i + 4], w + i * 4);
+                        }
+                        ortho(q);
+                    }
+
+                    static inline void store_blocks(std::uint8_t *out, word_type *q, std::size_t n) {
+                        std::uint32_t w[parallel_blocks * 4];
+                        ortho(q);
+                        for (std::size_t i = 0; i != parallel_blocks; ++i) {
+                            interleave_out(w + i * 4, q[i], q[i + 4]);
+                        }
+                        for (std::uint32_t &x : w) {
+                            boost::endian::native_to_little_inplace(x);
+                        }
+                        std::memcpy(out, w, n * 16);
+                    }
+
+                    static inline void add_round_key(word_type *q, const word_type *sk) {
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            q[i] ^= sk[i];
+                        }
+                    }
+
+                    static inline void shift_rows(word_type *q) {
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            word_type x = q[i];
+                            q[i] = (x & 0x000000000000FFFF) | ((x & 0x00000000FFF00000) >> 4) |
+                                   ((x & 0x00000000000F0000) << 12) | ((x & 0x0000FF0000000000) >> 8) |
+                                   ((x & 0x000000FF00000000) << 8) | ((x & 0xF000000000000000) >> 12) |
+                                   ((x & 0x0FFF000000000000) << 4);
+                        }
+                    }
+
+                    static inline void inverted_shift_rows(word_type *q) {
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            word_type x = q[i];
+                            q[i] = (x & 0x000000000000FFFF) | ((x & 0x000000000FFF0000) << 4) |
+                                   ((x & 0x00000000F0000000) >> 12) | ((x & 0x000000FF00000000) << 8) |
+                                   ((x & 0x0000FF0000000000) >> 8) | ((x & 0x000F000000000000) << 12) |
+                                   ((x & 0xFFF0000000000000) >> 4);
+                        }
+                    }
+
+                    static inline void mix_columns(word_type *q) {
+                        word_type q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3], q4 = q[4], q5 = q[5], q6 = q[6],
+                                  q7 = q[7];
+                        word_type r0 = rotr16(q0), r1 = rotr16(q1), r2 = rotr16(q2), r3 = rotr16(q3),
+                                  r4 = rotr16(q4), r5 = rotr16(q5), r6 = rotr16(q6), r7 = rotr16(q7);
+
+                        q[0] = q7 ^ r7 ^ r0 ^ rotr32(q0 ^ r0);
+                        q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr32(q1 ^ r1);
+                        q[2] = q1 ^ r1 ^ r2 ^ rotr32(q2 ^ r2);
+                        q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr32(q3 ^ r3);
+                        q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr32(q4 ^ r4);
+                        q[5] = q4 ^ r4 ^ r5 ^ rotr32(q5 ^ r5);
+                        q[6] = q5 ^ r5 ^ r6 ^ rotr32(q6 ^ r6);
+                        q[7] = q6 ^ r6 ^ r7 ^ rotr32(q7 ^ r7);
+                    }
+
+                    static inline void inverted_mix_columns(word_type *q) {
+                        word_type q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3], q4 = q[4], q5 = q[5], q6 = q[6],
+                                  q7 = q[7];
+                        word_type r0 = rotr16(q0), r1 = rotr16(q1), r2 = rotr16(q2), r3 = rotr16(q3),
+                                  r4 = rotr16(q4), r5 = rotr16(q5), r6 = rotr16(q6), r7 = rotr16(q7);
+
+                        q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ rotr32(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+                        q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^ rotr32(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+                        q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^ rotr32(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+                        q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^
+                               rotr32(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+                        q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^
+                               rotr32(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+                        q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^
+                               rotr32(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+                        q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^ rotr32(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+                        q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ rotr32(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+                    }
+
+                    static inline void encrypt(word_type *q, const word_type *sk, std::size_t rounds) {
+                        add_round_key(q, sk);
+                        for (std::size_t r = 1; r != rounds; ++r) {
+                            sbox(q);
+                            shift_rows(q);
+                            mix_columns(q);
+                            add_round_key(q, sk + r * state_words);
+                        }
+                        sbox(q);
+                        shift_rows(q);
+                        add_round_key(q, sk + rounds * state_words);
+                    }
+
+                    static inline void decrypt(word_type *q, const word_type *sk, std::size_t rounds) {
+                        add_round_key(q, sk + rounds * state_words);
+                        for (std::size_t r = rounds - 1; r != 0; --r) {
+                            inverted_shift_rows(q);
+                            inverted_sbox(q);
+                            add_round_key(q, sk + r * state_words);
+                            inverted_mix_columns(q);
+                        }
+                        inverted_shift_rows(q);
+                        inverted_sbox(q);
+                        add_round_key(q, sk);
+                    }
+
+                    /*!
+                     * @brief S-box applied to every octet of a key schedule word
+                     */
+                    static inline std::uint32_t sub_word(std::uint32_t x) {
+                        word_type q[state_words] = {x};
+                        ortho(q);
+                        sbox(q);
+                        ortho(q);
+                        return static_cast<std::uint32_t>(q[0]);
+                    }
+
+                    /*!
+                     * @brief Compresses a round key into two words, it occupies as much room as the
+                     * conventional one then
+                     */
+                    static inline void compress_round_key(word_type *out, const std::uint32_t *w) {
+                        word_type q[state_words];
+                        interleave_in(q[0], q[4], w);
+                        q[1] = q[2] = q[3] = q[0];
+                        q[5] = q[6] = q[7] = q[4];
+                        ortho(q);
+                        out[0] = (q[0] & 0x1111111111111111) | (q[1] & 0x2222222222222222) |
+                                 (q[2] & 0x4444444444444444) | (q[3] & 0x8888888888888888);
+                        out[1] = (q[4] & 0x1111111111111111) | (q[5] & 0x2222222222222222) |
+                                 (q[6] & 0x4444444444444444) | (q[7] & 0x8888888888888888);
+                    }
+
+                    /*!
+                     * @brief Expands n compressed words into the 4 * n words used by the rounds
+                     */
+                    static inline void expand_round_keys(word_type *out, const word_type *compressed,
+                                                         std::size_t n) {
+                        for (std::size_t i = 0; i != n; ++i, out += 4) {
+                            word_type x = compressed[i];
+                            word_type x0 = x & 0x1111111111111111;
+                            word_type x1 = (x & 0x2222222222222222) >> 1;
+                            word_type x2 = (x & 0x4444444444444444) >> 2;
+                            word_type x3 = (x & 0x8888888888888888) >> 3;
+                            out[0] = (x0 << 4) - x0;
+                            out[1] = (x1 << 4) - x1;
+                            out[2] = (x2 << 4) - x2;
+                            out[3] = (x3 << 4) - x3;
+                        }
+                    }
+
+                private:
+                    template<word_type Low, std::size_t Shift>
+                    static inline void swap(word_type &x, word_type &y) {
+                        word_type a = x, b = y;
+                        x = (a & Low) | ((b & Low) << Shift);
+                        y = ((a & ~Low) >> Shift) | (b & ~Low);
+                    }
+
+                    static inline void inverted_affine(word_type *q) {
+                        word_type q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3], q4 = q[4], q5 = ~q[5], q6 = ~q[6],
+                                  q7 = q[7];
+                        q[7] = q1 ^ q4 ^ q6;
+                        q[6] = q0 ^ q3 ^ q5;
+                        q[5] = q7 ^ q2 ^ q4;
+                        q[4] = q6 ^ q1 ^ q3;
+                        q[3] = q5 ^ q0 ^ q2;
+                        q[2] = q4 ^ q7 ^ q1;
+                        q[1] = q3 ^ q6 ^ q0;
+                        q[0] = q2 ^ q5 ^ q7;
+                    }
+
+                    static inline word_type rotr16(word_type x) {
+                        return (x >> 16) | (x << 48);
+                    }
+
+                    static inline word_type rotr32(word_type x) {
+                        return (x << 32) | (x >> 32);
+                    }
+                };
+
+                /*!
+                 * @brief Bitsliced AES backend. The key schedule holds compressed bitsliced round keys,
+                 * which are expanded on every call. A single block costs as much as four,
+                 * so encrypt_blocks and decrypt_blocks are the preferred entry points.
+                 */
+                template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl, typename PolicyType>
+                class rijndael_bitsliced_impl {
+                    BOOST_STATIC_ASSERT(BlockBitsImpl == 128);
+                };
+
+                template<std::size_t KeyBitsImpl, typename PolicyType>
+                class rijndael_bitsliced_impl<KeyBitsImpl, 128, PolicyType> {
+                protected:
+                    typedef PolicyType policy_type;
+                    typedef rijndael_bitsliced_functions functions;
+                    typedef functions::word_type word_type;
+
+                    typedef typename policy_type::block_type block_type;
+                    typedef typename policy_type::key_type key_type;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+
+                    constexpr static const std::size_t rounds = policy_type::rounds;
+                    constexpr static const std::size_t compressed_words = 2 * (rounds + 1);
+                    constexpr static const std::size_t block_bytes = policy_type::block_bytes;
+
+                    BOOST_STATIC_ASSERT(PolicyType::key_bits == KeyBitsImpl);
+                    BOOST_STATIC_ASSERT(PolicyType::block_bits == 128);
+                    BOOST_STATIC_ASSERT(KeyBitsImpl == 128 || KeyBitsImpl == 192 || KeyBitsImpl == 256);
+                    BOOST_STATIC_ASSERT(sizeof(key_schedule_type) == compressed_words * sizeof(word_type));
+
+                    typedef std::array<word_type, compressed_words * 4> round_keys_type;
+
+                    static inline void expand(round_keys_type &round_keys, const key_schedule_type &key_schedule) {
+                        word_type compressed[compressed_words];
+                        std::memcpy(compressed, key_schedule.data(), sizeof(compressed));
+                        functions::expand_round_keys(round_keys.data(), compressed, compressed_words);
+                    }
+
+                public:
+                    constexpr static const std::size_t parallel_blocks = functions::parallel_blocks;
+
+                    static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
+                                             key_schedule_type &decryption_key) {
+                        constexpr static const std::size_t key_words = policy_type::key_words;
+                        constexpr static const std::size_t schedule_words = 4 * (rounds + 1);
+
+                        std::uint32_t w[schedule_words];
+                        std::memcpy(w, input_key.data(), key_words * 4);
+                        for (std::size_t i = 0; i != key_words; ++i) {
+                            boost::endian::little_to_native_inplace(w[i]);
+                        }
+
+                        std::uint32_t tmp = w[key_words - 1];
+                        for (std::size_t i = key_words, j = 0, k = 0; i != schedule_words; ++i) {
+                            if (j == 0) {
+                                tmp = (tmp << 24) | (tmp >> 8);
+                                tmp = functions::sub_word(tmp) ^ policy_type::round_constants[k];
+                            } else if (key_words > 6 && j == 4) {
+                                tmp = functions::sub_word(tmp);
+                            }
+                            tmp ^= w[i - key_words];
+                            w[i] = tmp;
+                            if (++j == key_words) {
+                                j = 0;
+                                ++k;
+                            }
+                        }
+
+                        word_type compressed[compressed_words];
+                        for (std::size_t i = 0; i != rounds + 1; ++i) {
+                            functions::compress_round_key(compressed + 2 * i, w + 4 * i);
+                        }
+
+                        // Decryption walks the same round keys backwards
+                        std::memcpy(encryption_key.data(), compressed, sizeof(compressed));
+                        std::memcpy(decryption_key.data(), compressed, sizeof(compressed));
+
+                        ::boost::crypto3::detail::secure_zero(w, schedule_words);
+                        ::boost::crypto3::detail::secure_zero(compressed, compressed_words);
+                    }
+
+                    static block_type encrypt_block(const block_type &plaintext,
+                                                    const key_schedule_type &encryption_key) {
+                        block_type out;
+                        encrypt_blocks(&plaintext, &out, 1, encryption_key);
+                        return out;
+                    }
+
+                    static block_type decrypt_block(const block_type &ciphertext,
+                                                    const key_schedule_type &decryption_key) {
+                        block_type out;
+                        decrypt_blocks(&ciphertext, &out, 1, decryption_key);
+                        return out;
+                    }
+
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        round_keys_type round_keys;
+                        expand(round_keys, encryption_key);
+
+                        while (n) {
+                            std::size_t count = n < parallel_blocks ? n : parallel_blocks;
+                            word_type q[functions::state_words];
+
+                            functions::load_blocks(q, in->data(), count);
+                            functions::encrypt(q, round_keys.data(), rounds);
+                            functions::store_blocks(out->data(), q, count);
+                            in += count;
+                            out += count;
+                            n -= count;
+                        }
+
+                        ::boost::crypto3::detail::secure_zero(round_keys.data(), round_keys.size());
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        round_keys_type round_keys;
+                        expand(round_keys, decryption_key);
+
+                        while (n) {
+                            std::size_t count = n < parallel_blocks ? n : parallel_blocks;
+                            word_type q[functions::state_words];
+
+                            functions::load_blocks(q, in->data(), count);
+                            functions::decrypt(q, round_keys.data(), rounds);
+                            functions::store_blocks(out->data(), q, count);
+                            in += count;
+                            out += count;
+                            n -= count;
+                        }
+
+                        ::boost::crypto3::detail::secure_zero(round_keys.data(), round_keys.size());
+                    }
+                };
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_RIJNDAEL_BITSLICED_IMPL_HPP
@@ -69,7 +69,7 @@ namespace boost {
                                 tmp[i] = state[i * policy_type::word_bytes + row];
                             }
 #pragma clang loop unroll(full)
-                            for (std::size_t i = 0; i < policy_type::block_words - 1; ++i) {
+                            for (std::size_t i = 0; i < policy_type::block_words - off; ++i) {
                                 state[i * policy_type::word_bytes + row] =
                                     state[(i + off) * policy_type::word_bytes + row];
                             }
@@ -170,24 +170,7 @@ namespace boost {
 
                     static void schedule_key(const key_type &key, key_schedule_type &encryption_key,
                                              key_schedule_type &decryption_key) {
-                        // the first key_words words are the original key
-                        ::boost::crypto3::detail::pack<stream_endian::big_octet_big_bit,
-                                                     stream_endian::little_octet_big_bit, CHAR_BIT,
-                                                     policy_type::word_bits>(
-                            key.begin(), key.begin() + policy_type::key_words * policy_type::word_bytes,
-                            encryption_key.begin());
-
-#pragma clang loop unroll(full)
-                        for (std::size_t i = policy_type::key_words; i < policy_type::key_schedule_words; ++i) {
-                            typename policy_type::key_schedule_word_type tmp = encryption_key[i - 1];
-                            if (i % policy_type::key_words == 0) {
-                                tmp = sub_word(policy_type::rotate_left(tmp), policy_type::constants) ^
-                                      policy_type::round_constants[i / policy_type::key_words - 1];
-                            } else if (policy_type::key_words > 6 && i % policy_type::key_words == 4) {
-                                tmp = sub_word(tmp, policy_type::constants);
-                            }
-                            encryption_key[i] = encryption_key[i - policy_type::key_words] ^ tmp;
-                        }
+                        schedule_encryption_key(key, encryption_key);
 
                         std::array<typename policy_type::byte_type, policy_type::key_schedule_bytes> bekey = {0};
                         ::boost::crypto3::detail::pack<stream_endian::little_octet_big_bit,
@@ -208,6 +191,30 @@ namespace boost {
                                                      policy_type::word_bits>(bekey.begin(), bekey.end(),
                                                                              decryption_key.begin());
                     }
+
+                    /*!
+                     * @brief Expands the encryption schedule only, for encryption-only keys
+                     */
+                    static void schedule_encryption_key(const key_type &key, key_schedule_type &encryption_key) {
+                        // the first key_words words are the original key
+                        ::boost::crypto3::detail::pack<stream_endian::big_octet_big_bit,
+                                                     stream_endian::little_octet_big_bit, CHAR_BIT,
+                                                     policy_type::word_bits>(
+                            key.begin(), key.begin() + policy_type::key_words * policy_type::word_bytes,
+                            encryption_key.begin());
+
+#pragma clang loop unroll(full)
+                        for (std::size_t i = policy_type::key_words; i < policy_type::key_schedule_words; ++i) {
+                            typename policy_type::key_schedule_word_type tmp = encryption_key[i - 1];
+                            if (i % policy_type::key_words == 0) {
+                                tmp = sub_word(policy_type::rotate_left(tmp), policy_type::constants) ^
+                                      policy_type::round_constants[i / policy_type::key_words - 1];
+                            } else if (policy_type::key_words > 6 && i % policy_type::key_words == 4) {
+                                tmp = sub_word(tmp, policy_type::constants);
+                            }
+                            encryption_key[i] = encryption_key[i - policy_type::key_words] ^ tmp;
+                        }
+                    }
                 };
             }    // namespace detail
             /*!
@@ -25,7 +25,7 @@ namespace boost {
              */
             namespace detail {
                 BOOST_ATTRIBUTE_TARGET("ssse3,aes")
-                __m128i aes_128_key_expansion(__m128i key, __m128i key_with_rcon) {
+                inline __m128i aes_128_key_expansion(__m128i key, __m128i key_with_rcon) {
                     key_with_rcon = _mm_shuffle_epi32(key_with_rcon, _MM_SHUFFLE(3, 3, 3, 3));
                     key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
                     key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
@@ -34,8 +34,8 @@ namespace boost {
                 }
 
                 BOOST_ATTRIBUTE_TARGET("ssse3,aes")
-                void aes_192_key_expansion(__m128i *K1, __m128i *K2, __m128i key2_with_rcon, uint32_t out[],
-                                           bool last) {
+                inline void aes_192_key_expansion(__m128i *K1, __m128i *K2, __m128i key2_with_rcon, uint32_t out[],
+                                                  bool last) {
                     __m128i key1 = *K1;
                     __m128i key2 = *K2;
 
@@ -64,7 +64,7 @@ namespace boost {
                  * The second half of the AES-256 key expansion (other half same as AES-128)
                  */
                 BOOST_ATTRIBUTE_TARGET("ssse3,aes")
-                __m128i aes_256_key_expansion(__m128i key, __m128i key2) {
+                inline __m128i aes_256_key_expansion(__m128i key, __m128i key2) {
                     __m128i key_with_rcon = _mm_aeskeygenassist_si128(key2, 0x00);
                     key_with_rcon = _mm_shuffle_epi32(key_with_rcon, _MM_SHUFFLE(2, 2, 2, 2));
 
@@ -74,6 +74,72 @@ namespace boost {
                     return _mm_xor_si128(key, key_with_rcon);
                 }
 
+                template<bool Decrypt>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                inline __m128i aes_ni_round(__m128i B, __m128i K) {
+                    return Decrypt ? _mm_aesdec_si128(B, K) : _mm_aesenc_si128(B, K);
+                }
+
+                template<bool Decrypt>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                inline __m128i aes_ni_last_round(__m128i B, __m128i K) {
+                    return Decrypt ? _mm_aesdeclast_si128(B, K) : _mm_aesenclast_si128(B, K);
+                }
+
+                /*!
+                 * @brief Encrypts or decrypts n consecutive blocks, eight at a time to keep the AES-NI
+                 * pipeline filled, since each round depends on the result of the previous one
+                 */
+                template<std::size_t Rounds, bool Decrypt>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                void aes_ni_process_blocks(const __m128i *in_mm, __m128i *out_mm, std::size_t n,
+                                           const __m128i *key_mm) {
+                    for (; n >= 8; n -= 8, in_mm += 8, out_mm += 8) {
+                        const __m128i K0 = _mm_loadu_si128(key_mm);
+
+                        __m128i B0 = _mm_xor_si128(_mm_loadu_si128(in_mm), K0);
+                        __m128i B1 = _mm_xor_si128(_mm_loadu_si128(in_mm + 1), K0);
+                        __m128i B2 = _mm_xor_si128(_mm_loadu_si128(in_mm + 2), K0);
+                        __m128i B3 = _mm_xor_si128(_mm_loadu_si128(in_mm + 3), K0);
+                        __m128i B4 = _mm_xor_si128(_mm_loadu_si128(in_mm + 4), K0);
+                        __m128i B5 = _mm_xor_si128(_mm_loadu_si128(in_mm + 5), K0);
+                        __m128i B6 = _mm_xor_si128(_mm_loadu_si128(in_mm + 6), K0);
+                        __m128i B7 = _mm_xor_si128(_mm_loadu_si128(in_mm + 7), K0);
+
+                        for (std::size_t r = 1; r != Rounds; ++r) {
+                            const __m128i K = _mm_loadu_si128(key_mm + r);
+
+                            B0 = aes_ni_round<Decrypt>(B0, K);
+                            B1 = aes_ni_round<Decrypt>(B1, K);
+                            B2 = aes_ni_round<Decrypt>(B2, K);
+                            B3 = aes_ni_round<Decrypt>(B3, K);
+                            B4 = aes_ni_round<Decrypt>(B4, K);
+                            B5 = aes_ni_round<Decrypt>(B5, K);
+                            B6 = aes_ni_round<Decrypt>(B6, K);
+                            B7 = aes_ni_round<Decrypt>(B7, K);
+                        }
+
+                        const __m128i KR = _mm_loadu_si128(key_mm + Rounds);
+
+                        _mm_storeu_si128(out_mm, aes_ni_last_round<Decrypt>(B0, KR));
+                        _mm_storeu_si128(out_mm + 1, aes_ni_last_round<Decrypt>(B1, KR));
+                        _mm_storeu_si128(out_mm + 2, aes_ni_last_round<Decrypt>(B2, KR));
+                        _mm_storeu_si128(out_mm + 3, aes_ni_last_round<Decrypt>(B3, KR));
+                        _mm_storeu_si128(out_mm + 4, aes_ni_last_round<Decrypt>(B4, KR));
+                        _mm_storeu_si128(out_mm + 5, aes_ni_last_round<Decrypt>(B5, KR));
+                        _mm_storeu_si128(out_mm + 6, aes_ni_last_round<Decrypt>(B6, KR));
+                        _mm_storeu_si128(out_mm + 7, aes_ni_last_round<Decrypt>(B7, KR));
+                    }
+
+                    for (; n; --n, ++in_mm, ++out_mm) {
+                        __m128i B = _mm_xor_si128(_mm_loadu_si128(in_mm), _mm_loadu_si128(key_mm));
+                        for (std::size_t r = 1; r != Rounds; ++r) {
+                            B = aes_ni_round<Decrypt>(B, _mm_loadu_si128(key_mm + r));
+                        }
+                        _mm_storeu_si128(out_mm, aes_ni_last_round<Decrypt>(B, _mm_loadu_si128(key_mm + Rounds)));
+                    }
+                }
+
                 template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl, typename PolicyType>
                 class rijndael_ni_impl {
                     BOOST_STATIC_ASSERT(PolicyType::block_bits == 128 && BlockBitsImpl == 128);
@@ -130,6 +196,20 @@ namespace boost {
                         return out;
                     }
 
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, false>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, true>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(decryption_key.data()));
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -277,6 +357,20 @@ namespace boost {
                         return out;
                     }
 
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, false>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, true>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(decryption_key.data()));
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -455,6 +549,20 @@ namespace boost {
                         return out;
                     }
 
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, false>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, true>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(decryption_key.data()));
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -1,14 +1,19 @@
-#include <boost/crypto3/utilities/cpuid/cpuid.hpp>
-#include <boost/crypto3/utilities/memory_operations.hpp>
-#include <boost/crypto3/utilities/loadstore.hpp>
+#ifndef CRYPTO3_CPUID_X86_HPP
+#define CRYPTO3_CPUID_X86_HPP
 
-#if defined(BOOST_ARCH_X86)
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
 
-#if defined(CRYPTO3_BUILD_COMPILER_IS_MSVC)
+#include <boost/predef/compiler.h>
+
+#include <cstring>
+
+#if BOOST_ARCH_X86
+
+#if BOOST_COMP_MSVC
 #include <intrin.h>
-#elif defined(CRYPTO3_BUILD_COMPILER_IS_INTEL)
+#elif BOOST_COMP_INTEL
 #include <ia32intrin.h>
-#elif defined(CRYPTO3_BUILD_COMPILER_IS_GCC) || defined(CRYPTO3_BUILD_COMPILER_IS_CLANG)
+#elif BOOST_COMP_GNUC || BOOST_COMP_CLANG
 #include <cpuid.h>
 #endif
 
@@ -17,10 +22,10 @@
 namespace boost {
     namespace crypto3 {
 
-#if defined(BOOST_ARCH_X86)
+#if BOOST_ARCH_X86
 
-        uint64_t cpuid::detect_cpu_features(size_t *cache_line_size) {
-#if defined(CRYPTO3_BUILD_COMPILER_IS_MSVC)
+        inline uint64_t cpuid::detect_cpu_features(size_t *cache_line_size) {
+#if BOOST_COMP_MSVC
 #define X86_CPUID(type, out)       \
     do {                           \
         __cpuid((int *)out, type); \
@@ -29,8 +34,9 @@ namespace boost {
     do {                                     \
         __cpuidex((int *)out, type, level);  \
     } while (0)
+#define X86_XGETBV() _xgetbv(0)
 
-#elif defined(CRYPTO3_BUILD_COMPILER_IS_INTEL)
+#elif BOOST_COMP_INTEL
 #define X86_CPUID(type, out) \
     do {                     \
         __cpuid(out, type);  \
@@ -39,14 +45,9 @@ namespace boost {
     do {                                     \
         __cpuidex((int *)out, type, level);  \
     } while (0)
+#define X86_XGETBV() _xgetbv(0)
 
-#elif defined(CRYPTO3_TARGET_ARCHITECTURE_IS_X86_64) && defined(CRYPTO3_USE_GCC_INLINE_ASM)
-#define X86_CPUID(type, out) asm("cpuid\n\t" : "=a"(out[0]), "=b"(out[1]), "=c"(out[2]), "=d"(out[3]) : "0"(type))
-
-#define X86_CPUID_SUBLEVEL(type, level, out) \
-    asm("cpuid\n\t" : "=a"(out[0]), "=b"(out[1]), "=c"(out[2]), "=d"(out[3]) : "0"(type), "2"(level))
-
-#elif defined(CRYPTO3_BUILD_COMPILER_IS_GCC) || defined(CRYPTO3_BUILD_COMPILER_IS_CLANG)
+#elif BOOST_COMP_GNUC || BOOST_COMP_CLANG
 #define X86_CPUID(type, out)                               \
     do {                                                   \
         __get_cpuid(type, out, out + 1, out + 2, out + 3); \
@@ -56,16 +57,25 @@ namespace boost {
     do {                                                            \
         __cpuid_count(type, level, out[0], out[1], out[2], out[3]); \
     } while (0)
+
+            // Avoid _xgetbv, since it requires the whole translation unit to be built with -mxsave
+            const auto xgetbv = []() -> uint64_t {
+                uint32_t lo, hi;
+                __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+                return (static_cast<uint64_t>(hi) << 32) | lo;
+            };
+#define X86_XGETBV() xgetbv()
 #else
 #warning "No way of calling x86 cpuid instruction for this compiler"
-#define X86_CPUID(type, out) \
-    do {                     \
-        clear_mem(out, 4);   \
+#define X86_CPUID(type, out)                       \
+    do {                                           \
+        std::memset(out, 0, 4 * sizeof(uint32_t)); \
     } while (0)
-#define X86_CPUID_SUBLEVEL(type, level, out) \
-    do {                                     \
-        clear_mem(out, 4);                   \
+#define X86_CPUID_SUBLEVEL(type, level, out)       \
+    do {                                           \
+        std::memset(out, 0, 4 * sizeof(uint32_t)); \
     } while (0)
+#define X86_XGETBV() uint64_t(0)
 #endif
 
             uint64_t features_detected = 0;
@@ -78,8 +88,12 @@ namespace boost {
 
             const uint32_t INTEL_CPUID[3] = {0x756E6547, 0x6C65746E, 0x49656E69};
             const uint32_t AMD_CPUID[3] = {0x68747541, 0x444D4163, 0x69746E65};
-            const bool is_intel = same_mem(cpuid + 1, INTEL_CPUID, 3);
-            const bool is_amd = same_mem(cpuid + 1, AMD_CPUID, 3);
+            const bool is_intel = std::memcmp(cpuid + 1, INTEL_CPUID, sizeof(INTEL_CPUID)) == 0;
+            const bool is_amd = std::memcmp(cpuid + 1, AMD_CPUID, sizeof(AMD_CPUID)) == 0;
+
+            // Extended register state has to be enabled by the OS before AVX2 and AVX-512 can be used
+            bool os_avx = false;
+            bool os_avx512 = false;
 
             if (max_supported_sublevel >= 1) {
                 // cpuid 1: feature bits
@@ -93,10 +107,19 @@ namespace boost {
                     SSSE3 = (1ULL << 41),
                     SSE41 = (1ULL << 51),
                     SSE42 = (1ULL << 52),
+                    OSXSAVE = (1ULL << 59),
+                    AVX = (1ULL << 60),
                     AESNI = (1ULL << 57),
                     RDRAND = (1ULL << 62)
                 };
 
+                if ((flags0 & x86_CPUID_1_bits::OSXSAVE) && (flags0 & x86_CPUID_1_bits::AVX)) {
+                    const uint64_t xcr0 = X86_XGETBV();
+                    // XMM and YMM state, then opmask and ZMM state in addition
+                    os_avx = (xcr0 & 0x06) == 0x06;
+                    os_avx512 = os_avx && (xcr0 & 0xE0) == 0xE0;
+                }
+
                 if (flags0 & x86_CPUID_1_bits::RDTSC)
                     features_detected |= cpuid::CPUID_RDTSC_BIT;
                 if (flags0 & x86_CPUID_1_bits::SSE2)
@@ -117,18 +140,19 @@ namespace boost {
 
             if (is_intel) {
                 // Intel cache line size is in cpuid(1) output
-                *cache_line_size = 8 * extract_uint_t<CHAR_BIT>(cpuid[1], 2);
+                *cache_line_size = 8 * ((cpuid[1] >> 8) & 0xFF);
             } else if (is_amd) {
                 // AMD puts it in vendor zone
                 X86_CPUID(0x80000005, cpuid);
-                *cache_line_size = extract_uint_t<CHAR_BIT>(cpuid[2], 3);
+                *cache_line_size = cpuid[2] & 0xFF;
             }
 
             if (max_supported_sublevel >= 7) {
-                clear_mem(cpuid, 4);
+                std::memset(cpuid, 0, sizeof(cpuid));
                 X86_CPUID_SUBLEVEL(7, 0, cpuid);
 
                 enum x86_CPUID_7_bits : uint64_t {
+                    BMI1 = (1ULL << 3),
                     AVX2 = (1ULL << 5),
                     BMI2 = (1ULL << 8),
                     AVX512F = (1ULL << 16),
@@ -138,11 +162,13 @@ namespace boost {
                 };
                 uint64_t flags7 = (static_cast<uint64_t>(cpuid[2]) << 32) | cpuid[1];
 
-                if (flags7 & x86_CPUID_7_bits::AVX2)
+                if ((flags7 & x86_CPUID_7_bits::AVX2) && os_avx)
                     features_detected |= cpuid::CPUID_AVX2_BIT;
+                if (flags7 & x86_CPUID_7_bits::BMI1)
+                    features_detected |= cpuid::CPUID_BMI1_BIT;
                 if (flags7 & x86_CPUID_7_bits::BMI2)
                     features_detected |= cpuid::CPUID_BMI2_BIT;
-                if (flags7 & x86_CPUID_7_bits::AVX512F)
+                if ((flags7 & x86_CPUID_7_bits::AVX512F) && os_avx512)
                     features_detected |= cpuid::CPUID_AVX512F_BIT;
                 if (flags7 & x86_CPUID_7_bits::RDSEED)
                     features_detected |= cpuid::CPUID_RDSEED_BIT;
@@ -154,12 +180,13 @@ namespace boost {
 
 #undef X86_CPUID
 #undef X86_CPUID_SUBLEVEL
+#undef X86_XGETBV
 
             /*
              * If we don't have access to cpuid, we can still safely assume that
              * any x86-64 processor has SSE2 and RDTSC
              */
-#if defined(CRYPTO3_TARGET_ARCHITECTURE_IS_X86_64)
+#if BOOST_ARCH_X86_64
             if (features_detected == 0) {
                 features_detected |= cpuid::CPUID_SSE2_BIT;
                 features_detected |= cpuid::CPUID_RDTSC_BIT;
@@ -172,3 +199,5 @@ namespace boost {
 #endif
     }    // namespace crypto3
 }    // namespace boost
+
+#endif    // CRYPTO3_CPUID_X86_HPP
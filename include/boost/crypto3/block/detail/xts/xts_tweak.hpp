@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_XTS_TWEAK_HPP
+#define CRYPTO3_BLOCK_XTS_TWEAK_HPP
+
+#include <boost/crypto3/block/detail/xts/xts_tweak_impl.hpp>
+#include <boost/crypto3/block/detail/xts/xts_tweak_sse2_impl.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief Sequence of the XTS tweaks of a data unit, starting with the encrypted data
+                 * unit number and multiplied by x for every following block. SSE2 is used when the
+                 * processor has it, the portable implementation otherwise.
+                 */
+                class xts_tweak {
+                public:
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    /*!
+                     * @param t Tweak of the first block
+                     */
+                    explicit xts_tweak(const block_type &t) : t(t), sse2(false) {
+#ifdef CRYPTO3_BLOCK_HAS_XTS_TWEAK_SSE2
+                        sse2 = xts_tweak_sse2_impl::is_available();
+#endif
+                    }
+
+                    ~xts_tweak() {
+                        t.fill(0);
+                    }
+
+                    /*!
+                     * @brief Loads the next n blocks of octets XORed with their tweaks, which are stored
+                     * for unwhiten
+                     */
+                    void whiten(const std::uint8_t *in, block_type *out, block_type *tweaks, std::size_t n) {
+#ifdef CRYPTO3_BLOCK_HAS_XTS_TWEAK_SSE2
+                        if (sse2) {
+                            xts_tweak_sse2_impl::whiten(t, in, out, tweaks, n);
+                            return;
+                        }
+#endif
+                        xts_tweak_portable_impl::whiten(t, in, out, tweaks, n);
+                    }
+
+                    /*!
+                     * @brief Stores n processed blocks XORed with their tweaks as octets
+                     */
+                    void unwhiten(const block_type *blocks, const block_type *tweaks, std::uint8_t *out,
+                                  std::size_t n) const {
+#ifdef CRYPTO3_BLOCK_HAS_XTS_TWEAK_SSE2
+                        if (sse2) {
+                            xts_tweak_sse2_impl::unwhiten(blocks, tweaks, out, n);
+                            return;
+                        }
+#endif
+                        xts_tweak_portable_impl::unwhiten(blocks, tweaks, out, n);
+                    }
+
+                protected:
+                    block_type t;
+                    bool sse2;
+                };
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLOCK_XTS_TWEAK_HPP
@@ -0,0 +1,69 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_XTS_TWEAK_IMPL_HPP
+#define CRYPTO3_BLOCK_XTS_TWEAK_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief Portable XTS tweak arithmetic. Tweaks are little-endian elements of GF(2^128)
+                 * modulo x^128 + x^7 + x^2 + x + 1, the reduction is applied without branches.
+                 */
+                struct xts_tweak_portable_impl {
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    constexpr static const std::size_t block_bytes = 16;
+
+                    /*!
+                     * @brief Loads n blocks of octets XORed with the consecutive tweaks t, t * x, ...,
+                     * stores the tweaks and leaves t multiplied by x^n
+                     */
+                    static void whiten(block_type &t, const std::uint8_t *in, block_type *out, block_type *tweaks,
+                                       std::size_t n) {
+                        for (std::size_t i = 0; i != n; ++i, in += block_bytes) {
+                            tweaks[i] = t;
+                            for (std::size_t j = 0; j != t.size(); ++j) {
+                                out[i][j] = in[j] ^ t[j];
+                            }
+                            multiply_x(t);
+                        }
+                    }
+
+                    /*!
+                     * @brief Stores n blocks XORed with the tweaks stored by whiten as octets
+                     */
+                    static void unwhiten(const block_type *blocks, const block_type *tweaks, std::uint8_t *out,
+                                         std::size_t n) {
+                        for (std::size_t i = 0; i != n; ++i, out += block_bytes) {
+                            for (std::size_t j = 0; j != blocks[i].size(); ++j) {
+                                out[j] = blocks[i][j] ^ tweaks[i][j];
+                            }
+                        }
+                    }
+
+                    static inline void multiply_x(block_type &t) {
+                        std::uint8_t carry = t[15] >> 7;
+                        for (std::size_t j = 15; j; --j) {
+                            t[j] = static_cast<std::uint8_t>(t[j] << 1 | t[j - 1] >> 7);
+                        }
+                        t[0] = static_cast<std::uint8_t>(t[0] << 1 ^ (0x87 & -carry));
+                    }
+                };
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLOCK_XTS_TWEAK_IMPL_HPP
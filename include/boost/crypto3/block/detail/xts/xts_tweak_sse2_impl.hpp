@@ -0,0 +1,80 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_XTS_TWEAK_SSE2_IMPL_HPP
+#define CRYPTO3_BLOCK_XTS_TWEAK_SSE2_IMPL_HPP
+
+#include <boost/predef/architecture.h>
+
+#include <boost/crypto3/detail/config.hpp>
+
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_BLOCK_HAS_XTS_TWEAK_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+#ifdef CRYPTO3_BLOCK_HAS_XTS_TWEAK_SSE2
+                /*!
+                 * @brief XTS tweak arithmetic on SSE2 registers. The tweak stays in a register across
+                 * the blocks: every 32-bit lane is shifted left and receives the carry of the lane
+                 * below, the carry out of the top lane folds back as 0x87.
+                 */
+                struct xts_tweak_sse2_impl {
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    constexpr static const std::size_t block_bytes = 16;
+
+                    static bool is_available() {
+                        return cpuid::has_sse2();
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static void whiten(block_type &t, const std::uint8_t *in, block_type *out, block_type *tweaks,
+                                       std::size_t n) {
+                        const __m128i poly = _mm_set_epi32(1, 1, 1, 0x87);
+                        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(t.data()));
+
+                        for (std::size_t i = 0; i != n; ++i) {
+                            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + block_bytes * i));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(tweaks[i].data()), x);
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out[i].data()), _mm_xor_si128(b, x));
+
+                            __m128i carry = _mm_shuffle_epi32(_mm_srai_epi32(x, 31), 0x93);
+                            x = _mm_xor_si128(_mm_slli_epi32(x, 1), _mm_and_si128(carry, poly));
+                        }
+
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(t.data()), x);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static void unwhiten(const block_type *blocks, const block_type *tweaks, std::uint8_t *out,
+                                         std::size_t n) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks[i].data()));
+                            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(tweaks[i].data()));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + block_bytes * i), _mm_xor_si128(b, x));
+                        }
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLOCK_XTS_TWEAK_SSE2_IMPL_HPP
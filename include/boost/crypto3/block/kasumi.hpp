@@ -12,12 +12,16 @@
 
 #include <boost/endian/arithmetic.hpp>
 #include <boost/endian/conversion.hpp>
+#include <boost/optional.hpp>
 
 #include <boost/crypto3/block/detail/kasumi/kasumi_functions.hpp>
 
 #include <boost/crypto3/block/detail/block_stream_processor.hpp>
 #include <boost/crypto3/block/detail/cipher_modes.hpp>
 
+#include <memory>
+#include <stdexcept>
+
 namespace boost {
     namespace crypto3 {
         namespace block {
@@ -61,20 +65,51 @@ namespace boost {
 
                 typedef typename stream_endian::little_octet_big_bit endian_type;
 
-                kasumi(const key_type &key) {
-                    schedule_key(key_schedule, key);
+                /*!
+                 * @brief Immutable key schedule, serves both directions. Ciphers constructed from a shared
+                 * expanded key refer to it instead of copying it.
+                 */
+                class expanded_key {
+                public:
+                    explicit expanded_key(const key_type &key) {
+                        schedule_key(key_schedule, key);
+                    }
+
+                    ~expanded_key() {
+                        key_schedule.fill(0);
+                    }
+
+                private:
+                    friend class kasumi;
+
+                    key_schedule_type key_schedule;
+                };
+
+                kasumi(const key_type &key) : own_schedule(boost::in_place_init, key) {
+                }
+
+                /*!
+                 * @throws std::invalid_argument if key is null
+                 */
+                explicit kasumi(const std::shared_ptr<const expanded_key> &key) : shared_schedule(key) {
+                    if (!key) {
+                        throw std::invalid_argument("kasumi expanded key is null");
+                    }
                 }
 
-                ~kasumi() {
-                    key_schedule.fill(0);
+                /*!
+                 * @brief Shared expanded key the cipher refers to, null if it was constructed from a raw key
+                 */
+                const std::shared_ptr<const expanded_key> &key() const {
+                    return shared_schedule;
                 }
 
                 inline block_type encrypt(const block_type &plaintext) const {
-                    return encrypt_block(plaintext, key_schedule);
+                    return encrypt_block(plaintext, schedule().key_schedule);
                 }
 
                 inline block_type decrypt(const block_type &ciphertext) const {
-                    return decrypt_block(ciphertext, key_schedule);
+                    return decrypt_block(ciphertext, schedule().key_schedule);
                 }
 
             protected:
@@ -150,9 +185,15 @@ namespace boost {
                             boost::endian::big_to_native(B2), boost::endian::big_to_native(B3)};
                 }
 
-                key_schedule_type key_schedule;
+                const expanded_key &schedule() const {
+                    return shared_schedule ? *shared_schedule : *own_schedule;
+                }
+
+                // Raw keys are expanded in place, only explicitly shared ones are referred to
+                std::shared_ptr<const expanded_key> shared_schedule;
+                boost::optional<expanded_key> own_schedule;
 
-                void schedule_key(key_schedule_type &key_schedule, const key_type &key) {
+                static void schedule_key(key_schedule_type &key_schedule, const key_type &key) {
                     std::array<word_type, 16> K = {0};
                     for (size_t i = 0; i != rounds; ++i) {
                         K[i] = boost::endian::native_to_big(key[i]);
@@ -12,25 +12,37 @@
 
 #include <boost/range/adaptor/sliced.hpp>
 
+#include <boost/optional.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
 #include <boost/crypto3/block/detail/block_stream_processor.hpp>
 #include <boost/crypto3/block/detail/cipher_modes.hpp>
+#include <boost/crypto3/block/detail/cipher_traits.hpp>
+#include <boost/crypto3/block/detail/key_usage.hpp>
 
 #include <boost/crypto3/block/detail/rijndael/rijndael_policy.hpp>
 #include <boost/crypto3/block/detail/rijndael/rijndael_impl.hpp>
+#include <boost/crypto3/block/detail/rijndael/rijndael_bitsliced_impl.hpp>
 
-#if defined(CRYPTO3_HAS_RIJNDAEL_NI)
-
-#include <boost/crypto3/block/detail/rijndael/rijndael_ni_impl.hpp>
+#include <boost/crypto3/block/detail/rijndael/rijndael_backend.hpp>
 
-#elif defined(CRYPTO3_HAS_RIJNDAEL_SSSE3) || BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSSE3_VERSION
+#ifdef CRYPTO3_BLOCK_HAS_RIJNDAEL_X86
 
+#include <boost/crypto3/block/detail/rijndael/rijndael_ni_impl.hpp>
 #include <boost/crypto3/block/detail/rijndael/rijndael_ssse3_impl.hpp>
 
-#elif defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
+#endif
+
+#if defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
 
 #include <boost/crypto3/block/detail/rijndael/rijndael_armv8_impl.hpp>
 
-#elif defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
+#endif
+
+#if defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
 
 #include <boost/crypto3/block/detail/rijndael/rijndael_power8_impl.hpp>
 
@@ -38,6 +50,8 @@
 
 #include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
 
+#include <boost/crypto3/detail/secure_zero.hpp>
+
 namespace boost {
     namespace crypto3 {
         namespace block {
@@ -79,7 +93,9 @@ namespace boost {
              *   of each call to encrypt or decrypt. (See the Z variable below)
              *
              * If available SSSE3 or AES-NI are used instead of this version, as both
-             * are faster and immune to side channel attacks.
+             * are faster and immune to side channel attacks. Without them AES falls back to
+             * a bitsliced implementation, which is constant time as well and encrypts four
+             * blocks at once. The table-based version remains for the non-AES block and key sizes.
              *
              * Some AES cache timing papers for reference:
              *
@@ -104,20 +120,37 @@ namespace boost {
                 constexpr static const std::size_t version = KeyBits;
                 typedef detail::rijndael_policy<KeyBits, BlockBits> policy_type;
 
-                typedef
-                    typename std::conditional<BlockBits == 128 && (KeyBits == 128 || KeyBits == 192 || KeyBits == 256),
-#if defined(CRYPTO3_HAS_RIJNDAEL_NI)
-                                              detail::rijndael_ni_impl<KeyBits, BlockBits, policy_type>,
-#elif defined(CRYPTO3_HAS_RIJNDAEL_SSSE3) || BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSSE3_VERSION
-                                              detail::rijndael_ssse3_impl<KeyBits, BlockBits, policy_type>,
-#elif defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
-                                              detail::rijndael_armv8_impl<KeyBits, BlockBits, policy_type>,
-#elif defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
-                                              detail::rijndael_power8_impl<KeyBits, BlockBits, policy_type>,
-#else
-                                              detail::rijndael_impl<KeyBits, BlockBits, policy_type>,
-#endif
-                                              detail::rijndael_impl<KeyBits, BlockBits, policy_type>>::type impl_type;
+                /*!
+                 * @brief Hardware, vector and bitsliced implementations only exist for AES, i.e. 128-bit blocks
+                 * and keys of 128, 192 or 256 bits
+                 */
+                constexpr static const bool hardware_block =
+                    BlockBits == 128 && (KeyBits == 128 || KeyBits == 192 || KeyBits == 256);
+
+                typedef detail::rijndael_impl<KeyBits, BlockBits, policy_type> portable_impl_type;
+
+                template<typename Impl>
+                struct backend_impl {
+                    typedef typename std::conditional<hardware_block, Impl, portable_impl_type>::type type;
+                };
+
+                typedef typename backend_impl<detail::rijndael_bitsliced_impl<KeyBits, 128, policy_type>>::type
+                    bitsliced_impl_type;
+
+#ifdef CRYPTO3_BLOCK_HAS_RIJNDAEL_X86
+                typedef typename backend_impl<detail::rijndael_ni_impl<KeyBits, 128, policy_type>>::type
+                    ni_impl_type;
+                typedef typename backend_impl<detail::rijndael_ssse3_impl<KeyBits, 128, policy_type>>::type
+                    ssse3_impl_type;
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
+                typedef typename backend_impl<detail::rijndael_armv8_impl<KeyBits, 128, policy_type>>::type
+                    armv8_impl_type;
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
+                typedef typename backend_impl<detail::rijndael_power8_impl<KeyBits, 128, policy_type>>::type
+                    power8_impl_type;
+#endif
 
                 constexpr static const std::size_t key_schedule_words = policy_type::key_schedule_words;
                 constexpr static const std::size_t key_schedule_bytes = policy_type::key_schedule_bytes;
@@ -152,25 +185,319 @@ namespace boost {
 
                 typedef typename stream_endian::little_octet_big_bit endian_type;
 
-                rijndael(const key_type &key) : encryption_key({0}), decryption_key({0}) {
-                    impl_type::schedule_key(key, encryption_key, decryption_key);
+                /*!
+                 * @brief Immutable key schedule bound to the backend it was expanded for. Ciphers constructed
+                 * from a shared expanded key refer to it instead of copying it, so a key expanded once may
+                 * be cached and used by any amount of ciphers on any amount of threads.
+                 */
+                class expanded_key {
+                public:
+                    /*!
+                     * @param key Cipher key
+                     * @param usage Directions to expand the key for. The portable implementation skips the
+                     * decryption schedule of encryption-only keys, other ones wipe the unused schedule.
+                     * @param backend Implementation to expand the key for, see rijndael constructor
+                     */
+                    explicit expanded_key(const key_type &key, key_usage usage = key_usage::both,
+                                          rijndael_backend backend = rijndael_backend::automatic) :
+                        encryption_key({0}), decryption_key({0}),
+                        selected_backend(detail::select_rijndael_backend(backend, hardware_block)),
+                        selected_usage(usage) {
+                        if (!detail::is_rijndael_backend_available(selected_backend)) {
+                            throw std::invalid_argument("rijndael backend is not available on this processor");
+                        }
+
+                        switch (selected_backend) {
+                            case rijndael_backend::bitsliced:
+                                schedule_key<bitsliced_impl_type>(key);
+                                break;
+#ifdef CRYPTO3_BLOCK_HAS_RIJNDAEL_X86
+                            case rijndael_backend::aes_ni:
+                                schedule_key<ni_impl_type>(key);
+                                break;
+                            case rijndael_backend::ssse3:
+                                schedule_key<ssse3_impl_type>(key);
+                                break;
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
+                            case rijndael_backend::armv8:
+                                schedule_key<armv8_impl_type>(key);
+                                break;
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
+                            case rijndael_backend::power8:
+                                schedule_key<power8_impl_type>(key);
+                                break;
+#endif
+                            default:
+                                if (usage == key_usage::encryption) {
+                                    portable_impl_type::schedule_encryption_key(key, encryption_key);
+                                } else {
+                                    schedule_key<portable_impl_type>(key);
+                                }
+                        }
+                    }
+
+                    ~expanded_key() {
+                        ::boost::crypto3::detail::secure_zero(encryption_key.data(), encryption_key.size());
+                        ::boost::crypto3::detail::secure_zero(decryption_key.data(), decryption_key.size());
+                    }
+
+                    rijndael_backend backend() const {
+                        return selected_backend;
+                    }
+
+                    key_usage usage() const {
+                        return selected_usage;
+                    }
+
+                private:
+                    friend class rijndael;
+
+                    template<typename Impl>
+                    void schedule_key(const key_type &key) {
+                        Impl::schedule_key(key, encryption_key, decryption_key);
+                        if (selected_usage == key_usage::encryption) {
+                            ::boost::crypto3::detail::secure_zero(decryption_key.data(), decryption_key.size());
+                        } else if (selected_usage == key_usage::decryption) {
+                            ::boost::crypto3::detail::secure_zero(encryption_key.data(), encryption_key.size());
+                        }
+                    }
+
+                    key_schedule_type encryption_key, decryption_key;
+                    rijndael_backend selected_backend;
+                    key_usage selected_usage;
+                };
+
+                /*!
+                 * @param key Cipher key
+                 * @param backend Implementation to use, the fastest one the processor supports by default.
+                 * @throws std::invalid_argument if the backend is requested explicitly and is not available,
+                 * see is_available
+                 */
+                rijndael(const key_type &key, rijndael_backend backend = rijndael_backend::automatic) :
+                    own_schedule(boost::in_place_init, key, key_usage::both, backend),
+                    selected_backend(own_schedule->backend()) {
+                }
+
+                /*!
+                 * @param key Shared expanded key, only the directions it was expanded for may be used
+                 * @throws std::invalid_argument if key is null
+                 */
+                explicit rijndael(const std::shared_ptr<const expanded_key> &key) :
+                    shared_schedule(key), selected_backend(checked_key(key).backend()) {
+                }
+
+                virtual ~rijndael() = default;
+
+                /*!
+                 * @brief Whether the backend can be requested on this processor
+                 */
+                static bool is_available(rijndael_backend backend) {
+                    return detail::is_rijndael_backend_available(
+                        detail::select_rijndael_backend(backend, hardware_block));
                 }
 
-                virtual ~rijndael() {
-                    encryption_key.fill(0);
-                    decryption_key.fill(0);
+                /*!
+                 * @brief Backend selected on construction
+                 */
+                rijndael_backend backend() const {
+                    return selected_backend;
+                }
+
+                /*!
+                 * @brief Shared expanded key the cipher refers to, null if it was constructed from a raw key
+                 */
+                const std::shared_ptr<const expanded_key> &key() const {
+                    return shared_schedule;
                 }
 
                 inline block_type encrypt(const block_type &plaintext) const {
-                    return impl_type::encrypt_block(plaintext, encryption_key);
+                    check_usage(key_usage::encryption);
+                    switch (selected_backend) {
+                        case rijndael_backend::bitsliced:
+                            return bitsliced_impl_type::encrypt_block(plaintext, schedule().encryption_key);
+#ifdef CRYPTO3_BLOCK_HAS_RIJNDAEL_X86
+                        case rijndael_backend::aes_ni:
+                            return ni_impl_type::encrypt_block(plaintext, schedule().encryption_key);
+                        case rijndael_backend::ssse3:
+                            return ssse3_impl_type::encrypt_block(plaintext, schedule().encryption_key);
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
+                        case rijndael_backend::armv8:
+                            return armv8_impl_type::encrypt_block(plaintext, schedule().encryption_key);
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
+                        case rijndael_backend::power8:
+                            return power8_impl_type::encrypt_block(plaintext, schedule().encryption_key);
+#endif
+                        default:
+                            return portable_impl_type::encrypt_block(plaintext, schedule().encryption_key);
+                    }
+                }
+
+                inline block_type decrypt(const block_type &ciphertext) const {
+                    check_usage(key_usage::decryption);
+                    switch (selected_backend) {
+                        case rijndael_backend::bitsliced:
+                            return bitsliced_impl_type::decrypt_block(ciphertext, schedule().decryption_key);
+#ifdef CRYPTO3_BLOCK_HAS_RIJNDAEL_X86
+                        case rijndael_backend::aes_ni:
+                            return ni_impl_type::decrypt_block(ciphertext, schedule().decryption_key);
+                        case rijndael_backend::ssse3:
+                            return ssse3_impl_type::decrypt_block(ciphertext, schedule().decryption_key);
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
+                        case rijndael_backend::armv8:
+                            return armv8_impl_type::decrypt_block(ciphertext, schedule().decryption_key);
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
+                        case rijndael_backend::power8:
+                            return power8_impl_type::decrypt_block(ciphertext, schedule().decryption_key);
+#endif
+                        default:
+                            return portable_impl_type::decrypt_block(ciphertext, schedule().decryption_key);
+                    }
+                }
+
+                /*!
+                 * @brief Encrypts n independent blocks. Implementations able to interleave several
+                 * blocks (e.g. AES-NI) process them at once, others encrypt them one by one.
+                 */
+                inline void encrypt_blocks(const block_type *in, block_type *out, std::size_t n) const {
+                    check_usage(key_usage::encryption);
+                    switch (selected_backend) {
+                        case rijndael_backend::bitsliced:
+                            encrypt_blocks<bitsliced_impl_type>(in, out, n);
+                            break;
+#ifdef CRYPTO3_BLOCK_HAS_RIJNDAEL_X86
+                        case rijndael_backend::aes_ni:
+                            encrypt_blocks<ni_impl_type>(in, out, n);
+                            break;
+                        case rijndael_backend::ssse3:
+                            encrypt_blocks<ssse3_impl_type>(in, out, n);
+                            break;
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
+                        case rijndael_backend::armv8:
+                            encrypt_blocks<armv8_impl_type>(in, out, n);
+                            break;
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
+                        case rijndael_backend::power8:
+                            encrypt_blocks<power8_impl_type>(in, out, n);
+                            break;
+#endif
+                        default:
+                            encrypt_blocks<portable_impl_type>(in, out, n);
+                    }
                 }
 
-                inline block_type decrypt(const block_type &plaintext) const {
-                    return impl_type::decrypt_block(plaintext, decryption_key);
+                /*!
+                 * @brief Decrypts n independent blocks, the counterpart of encrypt_blocks
+                 */
+                inline void decrypt_blocks(const block_type *in, block_type *out, std::size_t n) const {
+                    check_usage(key_usage::decryption);
+                    switch (selected_backend) {
+                        case rijndael_backend::bitsliced:
+                            decrypt_blocks<bitsliced_impl_type>(in, out, n);
+                            break;
+#ifdef CRYPTO3_BLOCK_HAS_RIJNDAEL_X86
+                        case rijndael_backend::aes_ni:
+                            decrypt_blocks<ni_impl_type>(in, out, n);
+                            break;
+                        case rijndael_backend::ssse3:
+                            decrypt_blocks<ssse3_impl_type>(in, out, n);
+                            break;
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_ARMV8)
+                        case rijndael_backend::armv8:
+                            decrypt_blocks<armv8_impl_type>(in, out, n);
+                            break;
+#endif
+#if defined(CRYPTO3_HAS_RIJNDAEL_POWER8)
+                        case rijndael_backend::power8:
+                            decrypt_blocks<power8_impl_type>(in, out, n);
+                            break;
+#endif
+                        default:
+                            decrypt_blocks<portable_impl_type>(in, out, n);
+                    }
                 }
 
             protected:
-                key_schedule_type encryption_key, decryption_key;
+                template<typename Impl>
+                inline void encrypt_blocks(const block_type *in, block_type *out, std::size_t n) const {
+                    typedef detail::has_encrypt_blocks<Impl, block_type, const key_schedule_type &>
+                        has_encrypt_blocks_type;
+                    encrypt_blocks<Impl>(in, out, n,
+                                         std::integral_constant<bool, has_encrypt_blocks_type::value>());
+                }
+
+                template<typename Impl>
+                inline void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                           std::true_type) const {
+                    if (n) {
+                        Impl::encrypt_blocks(in, out, n, schedule().encryption_key);
+                    }
+                }
+
+                template<typename Impl>
+                inline void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                           std::false_type) const {
+                    for (; n; --n) {
+                        *out++ = Impl::encrypt_block(*in++, schedule().encryption_key);
+                    }
+                }
+
+                template<typename Impl>
+                inline void decrypt_blocks(const block_type *in, block_type *out, std::size_t n) const {
+                    typedef detail::has_decrypt_blocks<Impl, block_type, const key_schedule_type &>
+                        has_decrypt_blocks_type;
+                    decrypt_blocks<Impl>(in, out, n,
+                                         std::integral_constant<bool, has_decrypt_blocks_type::value>());
+                }
+
+                template<typename Impl>
+                inline void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                           std::true_type) const {
+                    if (n) {
+                        Impl::decrypt_blocks(in, out, n, schedule().decryption_key);
+                    }
+                }
+
+                template<typename Impl>
+                inline void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                           std::false_type) const {
+                    for (; n; --n) {
+                        *out++ = Impl::decrypt_block(*in++, schedule().decryption_key);
+                    }
+                }
+
+                const expanded_key &schedule() const {
+                    return shared_schedule ? *shared_schedule : *own_schedule;
+                }
+
+                static const expanded_key &checked_key(const std::shared_ptr<const expanded_key> &key) {
+                    if (!key) {
+                        throw std::invalid_argument("rijndael expanded key is null");
+                    }
+                    return *key;
+                }
+
+                /*!
+                 * @brief Rejects a direction the key was not expanded for, its schedule is wiped
+                 */
+                inline void check_usage(key_usage direction) const {
+                    if (schedule().usage() != key_usage::both && schedule().usage() != direction) {
+                        throw std::invalid_argument("rijndael key was not expanded for this direction");
+                    }
+                }
+
+                // Raw keys are expanded in place, only explicitly shared ones are referred to
+                std::shared_ptr<const expanded_key> shared_schedule;
+                boost::optional<expanded_key> own_schedule;
+                rijndael_backend selected_backend;
             };
         }    // namespace block
     }        // namespace crypto3
@@ -16,6 +16,10 @@
 #include <boost/crypto3/block/detail/cipher_modes.hpp>
 
 #include <boost/static_assert.hpp>
+#include <boost/optional.hpp>
+
+#include <memory>
+#include <stdexcept>
 
 #ifdef CRYPTO3_BLOCK_SHOW_PROGRESS
 #include <cstdio>
@@ -81,10 +85,51 @@ namespace boost {
 
                 typedef typename stream_endian::little_octet_big_bit endian_type;
 
-                shacal2(const key_type &key) : schedule(build_schedule(key)) {
+                /*!
+                 * @brief Immutable message schedule, serves both directions. Ciphers constructed from a
+                 * shared expanded key refer to it instead of copying it.
+                 */
+                class expanded_key {
+                public:
+                    explicit expanded_key(const key_type &key) : key_schedule(build_schedule(key)) {
+                    }
+
+                    /*!
+                     * @param s Schedule with the first key_words words filled in
+                     */
+                    explicit expanded_key(key_schedule_type s) : key_schedule((prepare_schedule(s), s)) {
+                    }
+
+                    ~expanded_key() {
+                        key_schedule.fill(0);
+                    }
+
+                private:
+                    friend class shacal2;
+
+                    key_schedule_type key_schedule;
+                };
+
+                shacal2(const key_type &key) : own_schedule(boost::in_place_init, key) {
+                }
+
+                shacal2(const key_schedule_type &s) : own_schedule(boost::in_place_init, s) {
+                }
+
+                /*!
+                 * @throws std::invalid_argument if key is null
+                 */
+                explicit shacal2(const std::shared_ptr<const expanded_key> &key) : shared_schedule(key) {
+                    if (!key) {
+                        throw std::invalid_argument("shacal2 expanded key is null");
+                    }
                 }
 
-                shacal2(key_schedule_type s) : schedule((prepare_schedule(s), s)) {
+                /*!
+                 * @brief Shared expanded key the cipher refers to, null if it was constructed from a raw key
+                 */
+                const std::shared_ptr<const expanded_key> &key() const {
+                    return shared_schedule;
                 }
 
                 block_type encrypt(block_type const &plaintext) const {
@@ -96,7 +141,13 @@ namespace boost {
                 }
 
             protected:
-                const key_schedule_type schedule;
+                const expanded_key &schedule() const {
+                    return shared_schedule ? *shared_schedule : *own_schedule;
+                }
+
+                // Raw keys are expanded in place, only explicitly shared ones are referred to
+                std::shared_ptr<const expanded_key> shared_schedule;
+                boost::optional<expanded_key> own_schedule;
 
                 static key_schedule_type build_schedule(const key_type &key) {
                     // Copy key into beginning of round_constants_words
@@ -116,7 +167,7 @@ namespace boost {
                 }
 
                 block_type encrypt_block(const block_type &plaintext) const {
-                    return encrypt_block(schedule, plaintext);
+                    return encrypt_block(schedule().key_schedule, plaintext);
                 }
 
                 inline static block_type encrypt_block(const key_schedule_type &schedule, block_type const &plaintext) {
@@ -169,7 +220,7 @@ namespace boost {
                 }
 
                 block_type decrypt_block(const block_type &ciphertext) const {
-                    return decrypt_block(schedule, ciphertext);
+                    return decrypt_block(schedule().key_schedule, ciphertext);
                 }
 
                 inline static block_type decrypt_block(const key_schedule_type &schedule,
@@ -20,6 +20,7 @@
 #include <boost/container/static_vector.hpp>
 
 #include <boost/range/algorithm.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <boost/crypto3/detail/make_array.hpp>
 #include <boost/crypto3/detail/digest.hpp>
@@ -124,6 +125,27 @@ namespace boost {
                         }
                     }
 
+                    inline void resolve_type(const boost::iterator_range<const input_value_type *> &values,
+                                             std::size_t) {
+                        process(values);
+                    }
+
+                    inline void process(const boost::iterator_range<const input_value_type *> &values) {
+                        if (!cache.empty()) {
+                            for (const input_value_type &value : values) {
+                                process(value, input_value_bits);
+                            }
+                            return;
+                        }
+
+                        // Whole blocks of contiguous values are coded straight into the digest
+                        std::size_t n = values.size() / input_block_values;
+                        std::size_t offset = dgst.size();
+                        dgst.resize(offset + n * output_block_values);
+                        codec_mode_type::process_blocks(values.begin(), dgst.data() + offset, n);
+                        seen += n * input_block_bits;
+                    }
+
                     inline void process(const input_value_type &value, std::size_t) {
                         if (cache.size() == cache.max_size()) {
                             input_block_type ib = {0};
@@ -55,7 +55,7 @@ namespace boost {
                 template<typename T>
                 void operator()(const T &block) {
                     typename T::const_iterator itr = block.cbegin();
-                    while (*itr == '\0' && itr != block.cend()) {
+                    while (itr != block.cend() && *itr == '\0') {
                         ++itr;
                     }
                     leading_zeros = std::distance(block.begin(), itr);
@@ -166,7 +166,7 @@ namespace boost {
                 template<typename T>
                 void operator()(const T &block) {
                     typename T::const_iterator itr = block.cbegin();
-                    while (*itr == '1') {
+                    while (itr != block.cend() && *itr == '1') {
                         ++itr;
                     }
                     leading_zeros = std::distance(block.begin(), itr);
@@ -299,6 +299,40 @@ namespace boost {
                     return policy_type::decode_block(encoded);
                 }
 
+                /*!
+                 * @brief Upper bound of the amount of symbols n octets are encoded into.
+                 */
+                constexpr static std::size_t encoded_size(std::size_t n) {
+                    return policy_type::encoded_size(n);
+                }
+
+                /*!
+                 * @brief Upper bound of the amount of octets n symbols are decoded into.
+                 */
+                constexpr static std::size_t decoded_size(std::size_t n) {
+                    return policy_type::decoded_size(n);
+                }
+
+                /*!
+                 * @brief Encodes n octets into a caller provided buffer without going through the accumulator.
+                 * @param out Output symbols, encoded_size(n) of them at most.
+                 * @return Pointer past the last symbol written.
+                 */
+                inline static encoded_value_type *encode(const decoded_value_type *in, std::size_t n,
+                                                         encoded_value_type *out) {
+                    return policy_type::encode(in, n, out);
+                }
+
+                /*!
+                 * @brief Decodes n symbols into a caller provided buffer without going through the accumulator.
+                 * @param out Output octets, decoded_size(n) of them at most.
+                 * @return Pointer past the last octet written.
+                 */
+                inline static decoded_value_type *decode(const encoded_value_type *in, std::size_t n,
+                                                         decoded_value_type *out) {
+                    return policy_type::decode(in, n, out);
+                }
+
                 template<typename ProcessingMode>
                 using accumulator_mode_type = accumulators::postprocessing_accumulator_mode<ProcessingMode>;
 
@@ -366,6 +400,28 @@ namespace boost {
                     return policy_type::decode_block(encoded);
                 }
 
+                /*!
+                 * @brief Encodes n consecutive data blocks of contiguous values. Available for base64 only.
+                 * @param in Input plaintext, n * decoded_block_values values.
+                 * @param out Output, n * encoded_block_values values.
+                 */
+                template<typename Policy = policy_type>
+                inline static auto encode_blocks(const decoded_value_type *in, encoded_value_type *out, std::size_t n)
+                    -> decltype(Policy::encode_blocks(in, out, n)) {
+                    return Policy::encode_blocks(in, out, n);
+                }
+
+                /*!
+                 * @brief Decodes n consecutive data blocks of contiguous values. Available for base64 only.
+                 * @param in Input encoded data, n * encoded_block_values values.
+                 * @param out Output, n * decoded_block_values values.
+                 */
+                template<typename Policy = policy_type>
+                inline static auto decode_blocks(const encoded_value_type *in, decoded_value_type *out, std::size_t n)
+                    -> decltype(Policy::decode_blocks(in, out, n)) {
+                    return Policy::decode_blocks(in, out, n);
+                }
+
                 template<typename ProcessingMode>
                 using accumulator_mode_type = accumulators::preprocessing_accumulator_mode<ProcessingMode>;
 
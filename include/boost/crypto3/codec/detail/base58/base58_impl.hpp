@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_CODEC_BASE58_IMPL_HPP
+#define CRYPTO3_CODEC_BASE58_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/container/small_vector.hpp>
+
+namespace boost {
+    namespace crypto3 {
+        namespace codec {
+            namespace detail {
+                /*!
+                 * @brief Base58 radix conversion on machine words. Numbers are kept as little-endian arrays
+                 * of 32-bit limbs, either in base 2^32 or in base 58^5, so every step multiplies or divides
+                 * by a constant within 64-bit arithmetic and five symbols are handled at once. Limbs live on
+                 * the stack for inputs up to stack_octets long.
+                 */
+                struct base58_impl {
+                    typedef std::uint32_t limb_type;
+                    typedef std::uint64_t double_limb_type;
+
+                    constexpr static const std::size_t limb_symbols = 5;
+                    constexpr static const limb_type limb_radix = 58UL * 58UL * 58UL * 58UL * 58UL;
+
+                    constexpr static const std::size_t stack_octets = 512;
+                    constexpr static const std::size_t stack_limbs = stack_octets * 138 / 100 / limb_symbols + 2;
+                    constexpr static const std::size_t stack_symbols = stack_octets * 138 / 100 + 1;
+
+                    typedef boost::container::small_vector<limb_type, stack_limbs> limbs_type;
+                    // Symbols mapped to digits before decoding
+                    typedef boost::container::small_vector<std::uint8_t, stack_symbols> digits_type;
+
+                    /*!
+                     * @brief Upper bound of the amount of symbols n octets are encoded into, log(256) / log(58)
+                     * rounded up
+                     */
+                    constexpr static std::size_t encoded_size(std::size_t n) {
+                        return n * 138 / 100 + 1;
+                    }
+
+                    /*!
+                     * @brief Upper bound of the amount of octets n symbols are decoded into, log(58) / log(256)
+                     * rounded up
+                     */
+                    constexpr static std::size_t decoded_size(std::size_t n) {
+                        return n * 733 / 1000 + 1;
+                    }
+
+                    /*!
+                     * @brief Converts the big-endian number held in n octets into base58 digits
+                     * @param out Output digits, least significant first, encoded_size(n) of them at most
+                     * @return Iterator past the last digit written, none is written for zero
+                     */
+                    template<typename OutputIterator>
+                    static OutputIterator encode(const std::uint8_t *in, std::size_t n, OutputIterator out) {
+                        limbs_type limbs;
+                        limbs.reserve(encoded_size(n) / limb_symbols + 1);
+
+                        // Top octets first make a partial word, so the rest is read in whole 32-bit words
+                        std::size_t head = n % 4 ? n % 4 : 4;
+                        for (std::size_t i = 0; i < n; i += head, head = 4) {
+                            double_limb_type carry = 0;
+                            for (std::size_t j = 0; j != head; ++j) {
+                                carry = (carry << 8) | in[i + j];
+                            }
+                            for (limb_type &limb : limbs) {
+                                double_limb_type t = (double_limb_type(limb) << (8 * head)) + carry;
+                                limb = static_cast<limb_type>(t % limb_radix);
+                                carry = t / limb_radix;
+                            }
+                            while (carry) {
+                                limbs.push_back(static_cast<limb_type>(carry % limb_radix));
+                                carry /= limb_radix;
+                            }
+                        }
+
+                        // The most significant limb is the only one written without its leading zero digits
+                        for (std::size_t i = 0; i != limbs.size(); ++i) {
+                            limb_type limb = limbs[i];
+                            for (std::size_t j = 0; j != limb_symbols && (limb || i + 1 != limbs.size()); ++j) {
+                                *out++ = static_cast<std::uint8_t>(limb % 58);
+                                limb /= 58;
+                            }
+                        }
+                        return out;
+                    }
+
+                    /*!
+                     * @brief Converts n base58 digits, most significant first, into a number
+                     * @param out Output octets, least significant first, decoded_size(n) of them at most
+                     * @return Iterator past the last octet written, none is written for zero
+                     */
+                    template<typename OutputIterator>
+                    static OutputIterator decode(const std::uint8_t *in, std::size_t n, OutputIterator out) {
+                        limbs_type limbs;
+                        limbs.reserve(decoded_size(n) / 4 + 1);
+
+                        std::size_t head = n % limb_symbols ? n % limb_symbols : limb_symbols;
+                        for (std::size_t i = 0; i < n; i += head, head = limb_symbols) {
+                            double_limb_type carry = 0, radix = 1;
+                            for (std::size_t j = 0; j != head; ++j) {
+                                carry = carry * 58 + in[i + j];
+                                radix *= 58;
+                            }
+                            for (limb_type &limb : limbs) {
+                                double_limb_type t = limb * radix + carry;
+                                limb = static_cast<limb_type>(t);
+                                carry = t >> 32;
+                            }
+                            if (carry) {
+                                limbs.push_back(static_cast<limb_type>(carry));
+                            }
+                        }
+
+                        for (std::size_t i = 0; i != limbs.size(); ++i) {
+                            limb_type limb = limbs[i];
+                            for (std::size_t j = 0; j != 4 && (limb || i + 1 != limbs.size()); ++j) {
+                                *out++ = static_cast<std::uint8_t>(limb);
+                                limb >>= 8;
+                            }
+                        }
+                        return out;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace codec
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_CODEC_BASE58_IMPL_HPP
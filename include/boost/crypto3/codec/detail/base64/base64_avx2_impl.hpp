@@ -0,0 +1,165 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_CODEC_BASE64_AVX2_IMPL_HPP
+#define CRYPTO3_CODEC_BASE64_AVX2_IMPL_HPP
+
+#include <boost/crypto3/detail/simd_backend.hpp>
+#include <boost/crypto3/codec/detail/base64/base64_ssse3_impl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CRYPTO3_HAS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace codec {
+            namespace detail {
+#ifdef CRYPTO3_HAS_SIMD_X86
+                /*!
+                 * @brief Base64 on eight blocks at once, the SSSE3 arithmetic applied to both 128-bit lanes,
+                 * each lane holding four blocks.
+                 */
+                struct base64_avx2_impl {
+                    constexpr static const std::size_t decoded_block_bytes = base64_impl::decoded_block_bytes;
+                    constexpr static const std::size_t encoded_block_bytes = base64_impl::encoded_block_bytes;
+                    constexpr static const std::size_t parallel_blocks = 8;
+
+                    static bool is_available() {
+                        return cpuid::has_avx2();
+                    }
+
+                    /*!
+                     * @brief Same as base64_impl::encode_blocks, 24 octets into 32 symbols per step. Each
+                     * lane is loaded with 16 octets of which 12 are used, the rest is left to the SSSE3 and
+                     * the portable implementations.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static std::size_t encode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + parallel_blocks + 2 <= n; i += parallel_blocks) {
+                            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+                            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 12));
+                            __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), encode(x));
+                            in += parallel_blocks * decoded_block_bytes;
+                            out += parallel_blocks * encoded_block_bytes;
+                        }
+                        return i + base64_ssse3_impl::encode_blocks(in, out, n - i);
+                    }
+
+                    /*!
+                     * @brief Same as base64_impl::decode_blocks, 32 symbols into 24 octets per step. Each
+                     * lane is stored as 16 octets of which 12 are meaningful, the rest is left to the SSSE3
+                     * and the portable implementations.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static std::size_t decode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + parallel_blocks + 2 <= n; i += parallel_blocks) {
+                            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in));
+                            __m256i values;
+                            if (!decode(x, values)) {
+                                break;
+                            }
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm256_castsi256_si128(values));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 4 * decoded_block_bytes),
+                                             _mm256_extracti128_si256(values, 1));
+                            in += parallel_blocks * encoded_block_bytes;
+                            out += parallel_blocks * decoded_block_bytes;
+                        }
+                        return i + base64_ssse3_impl::decode_blocks(in, out, n - i);
+                    }
+
+                protected:
+                    /*!
+                     * @brief Encodes the octets 0 to 11 of each lane of x into 16 symbols
+                     */
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i encode(__m256i x) {
+                        // Every 32-bit lane gets the octets of one block as b1 b0 b2 b1
+                        x = _mm256_shuffle_epi8(x, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                                                   10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+                        // Move each 6-bit index into its own octet
+                        __m256i t0 = _mm256_and_si256(x, _mm256_set1_epi32(0x0fc0fc00));
+                        __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+                        __m256i t2 = _mm256_and_si256(x, _mm256_set1_epi32(0x003f03f0));
+                        __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+
+                        return lookup(_mm256_or_si256(t1, t3));
+                    }
+
+                    /*!
+                     * @brief Decodes 16 symbols per lane into the octets 0 to 11 of each lane of values
+                     * @return false if any of the symbols is outside of the alphabet
+                     */
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline bool decode(__m256i x, __m256i &values) {
+                        const __m256i lut_lo = _mm256_setr_epi8(
+                            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b,
+                            0x1a, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b,
+                            0x1b, 0x1a);
+                        const __m256i lut_hi = _mm256_setr_epi8(
+                            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                            0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                            0x10, 0x10);
+                        const __m256i lut_roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0,
+                                                                  0, 0, 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0,
+                                                                  0, 0, 0, 0);
+
+                        __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(x, 4), _mm256_set1_epi8(0x0f));
+                        __m256i lo_nibbles = _mm256_and_si256(x, _mm256_set1_epi8(0x0f));
+
+                        // A symbol is valid when the classes of its nibbles do not intersect
+                        __m256i classes = _mm256_and_si256(_mm256_shuffle_epi8(lut_lo, lo_nibbles),
+                                                           _mm256_shuffle_epi8(lut_hi, hi_nibbles));
+                        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(classes, _mm256_setzero_si256())) != -1) {
+                            return false;
+                        }
+
+                        // The offset is chosen by the high nibble, '/' shares it with '+' and is told apart
+                        __m256i eq_slash = _mm256_cmpeq_epi8(x, _mm256_set1_epi8('/'));
+                        __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_slash, hi_nibbles));
+                        x = _mm256_add_epi8(x, roll);
+
+                        // Merge four 6-bit values into 24 bits per 32-bit lane and gather the octets
+                        __m256i merged = _mm256_maddubs_epi16(x, _mm256_set1_epi32(0x01400140));
+                        merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+                        values = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                                                              -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10,
+                                                                              9, 8, 14, 13, 12, -1, -1, -1, -1));
+                        return true;
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i lookup(__m256i indices) {
+                        // 0 for 'a'-'z', 1-10 for '0'-'9', 11 and 12 for '+' and '/', 13 for 'A'-'Z'
+                        const __m256i offsets = _mm256_setr_epi8(
+                            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                            '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0, 'a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63,
+                            'A', 0, 0);
+
+                        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+                        __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+                        range = _mm256_or_si256(range, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+                        return _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace codec
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_CODEC_BASE64_AVX2_IMPL_HPP
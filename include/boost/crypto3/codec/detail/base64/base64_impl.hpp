@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_CODEC_BASE64_IMPL_HPP
+#define CRYPTO3_CODEC_BASE64_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+    namespace crypto3 {
+        namespace codec {
+            namespace detail {
+                /*!
+                 * @brief Portable bulk base64 of RFC 4648 alphabet. Symbols are computed with arithmetic
+                 * instead of table lookups, so neither the timing nor the memory access pattern depends
+                 * on the data.
+                 */
+                struct base64_impl {
+                    constexpr static const std::size_t decoded_block_bytes = 3;
+                    constexpr static const std::size_t encoded_block_bytes = 4;
+
+                    /*!
+                     * @brief Encodes n blocks of 3 octets into n blocks of 4 symbols
+                     * @return The amount of blocks processed, always n
+                     */
+                    static std::size_t encode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                        for (std::size_t i = 0; i != n; ++i, in += decoded_block_bytes, out += encoded_block_bytes) {
+                            out[0] = encode_symbol(in[0] >> 2);
+                            out[1] = encode_symbol(((in[0] & 0x03U) << 4) | (in[1] >> 4));
+                            out[2] = encode_symbol(((in[1] & 0x0fU) << 2) | (in[2] >> 6));
+                            out[3] = encode_symbol(in[2] & 0x3fU);
+                        }
+                        return n;
+                    }
+
+                    /*!
+                     * @brief Decodes blocks of 4 symbols into blocks of 3 octets up to the first block
+                     * holding anything but the 64 alphabet symbols, e.g. padding, whitespace or garbage
+                     * @return The amount of blocks decoded
+                     */
+                    static std::size_t decode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                        for (std::size_t i = 0; i != n; ++i, in += encoded_block_bytes, out += decoded_block_bytes) {
+                            int a = decode_symbol(in[0]), b = decode_symbol(in[1]);
+                            int c = decode_symbol(in[2]), d = decode_symbol(in[3]);
+                            if ((a | b | c | d) < 0) {
+                                return i;
+                            }
+                            std::uint32_t v = (static_cast<std::uint32_t>(a) << 18) |
+                                              (static_cast<std::uint32_t>(b) << 12) |
+                                              (static_cast<std::uint32_t>(c) << 6) | static_cast<std::uint32_t>(d);
+                            out[0] = static_cast<std::uint8_t>(v >> 16);
+                            out[1] = static_cast<std::uint8_t>(v >> 8);
+                            out[2] = static_cast<std::uint8_t>(v);
+                        }
+                        return n;
+                    }
+
+                protected:
+                    /*!
+                     * @brief Maps a 6-bit value onto its symbol, each range check yields an all-ones or
+                     * all-zeros mask from the sign of the difference
+                     */
+                    static inline std::uint8_t encode_symbol(unsigned x) {
+                        int v = static_cast<int>(x);
+                        int diff = 'A';
+                        diff += ((25 - v) >> 8) & 6;
+                        diff -= ((51 - v) >> 8) & 75;
+                        diff -= ((61 - v) >> 8) & 15;
+                        diff += ((62 - v) >> 8) & 3;
+                        return static_cast<std::uint8_t>(v + diff);
+                    }
+
+                    /*!
+                     * @brief Maps a symbol onto its 6-bit value, -1 for anything outside of the alphabet
+                     */
+                    static inline int decode_symbol(std::uint8_t symbol) {
+                        int c = symbol;
+                        int ret = -1;
+                        ret += (((0x40 - c) & (c - 0x5b)) >> 8) & (c - 64);
+                        ret += (((0x60 - c) & (c - 0x7b)) >> 8) & (c - 70);
+                        ret += (((0x2f - c) & (c - 0x3a)) >> 8) & (c + 5);
+                        ret += (((0x2a - c) & (c - 0x2c)) >> 8) & 63;
+                        ret += (((0x2e - c) & (c - 0x30)) >> 8) & 64;
+                        return ret;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace codec
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_CODEC_BASE64_IMPL_HPP
@@ -0,0 +1,151 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_CODEC_BASE64_SSSE3_IMPL_HPP
+#define CRYPTO3_CODEC_BASE64_SSSE3_IMPL_HPP
+
+#include <boost/crypto3/detail/simd_backend.hpp>
+#include <boost/crypto3/codec/detail/base64/base64_impl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CRYPTO3_HAS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace codec {
+            namespace detail {
+#ifdef CRYPTO3_HAS_SIMD_X86
+                /*!
+                 * @brief Base64 on four blocks at once. Octets are spread into 6-bit indices with a shuffle
+                 * and two multiplications, symbols are mapped with a pshufb of per-range offsets, so no
+                 * lookup depends on the data.
+                 */
+                struct base64_ssse3_impl {
+                    constexpr static const std::size_t decoded_block_bytes = base64_impl::decoded_block_bytes;
+                    constexpr static const std::size_t encoded_block_bytes = base64_impl::encoded_block_bytes;
+                    constexpr static const std::size_t parallel_blocks = 4;
+
+                    static bool is_available() {
+                        return cpuid::has_ssse3();
+                    }
+
+                    /*!
+                     * @brief Same as base64_impl::encode_blocks. Each step loads 16 octets of which 12 are
+                     * used, so the last blocks are left to the portable implementation.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static std::size_t encode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + parallel_blocks + 2 <= n; i += parallel_blocks) {
+                            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), encode(x));
+                            in += parallel_blocks * decoded_block_bytes;
+                            out += parallel_blocks * encoded_block_bytes;
+                        }
+                        return i + base64_impl::encode_blocks(in, out, n - i);
+                    }
+
+                    /*!
+                     * @brief Same as base64_impl::decode_blocks. Each step stores 16 octets of which 12 are
+                     * meaningful, so the last blocks are left to the portable implementation.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static std::size_t decode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                        std::size_t i = 0;
+                        for (; i + parallel_blocks + 2 <= n; i += parallel_blocks) {
+                            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+                            __m128i values;
+                            if (!decode(x, values)) {
+                                break;
+                            }
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), values);
+                            in += parallel_blocks * encoded_block_bytes;
+                            out += parallel_blocks * decoded_block_bytes;
+                        }
+                        return i + base64_impl::decode_blocks(in, out, n - i);
+                    }
+
+                protected:
+                    /*!
+                     * @brief Encodes the octets 0 to 11 of x into 16 symbols
+                     */
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static inline __m128i encode(__m128i x) {
+                        // Every 32-bit lane gets the octets of one block as b1 b0 b2 b1
+                        x = _mm_shuffle_epi8(x, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+                        // Move each 6-bit index into its own octet
+                        __m128i t0 = _mm_and_si128(x, _mm_set1_epi32(0x0fc0fc00));
+                        __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+                        __m128i t2 = _mm_and_si128(x, _mm_set1_epi32(0x003f03f0));
+                        __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+                        return lookup(_mm_or_si128(t1, t3));
+                    }
+
+                    /*!
+                     * @brief Decodes 16 symbols into the octets 0 to 11 of values
+                     * @return false if any of the symbols is outside of the alphabet
+                     */
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static inline bool decode(__m128i x, __m128i &values) {
+                        const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                             0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+                        const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10,
+                                                             0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+                        const __m128i lut_roll =
+                            _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+                        __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(x, 4), _mm_set1_epi8(0x0f));
+                        __m128i lo_nibbles = _mm_and_si128(x, _mm_set1_epi8(0x0f));
+
+                        // A symbol is valid when the classes of its nibbles do not intersect
+                        __m128i classes = _mm_and_si128(_mm_shuffle_epi8(lut_lo, lo_nibbles),
+                                                        _mm_shuffle_epi8(lut_hi, hi_nibbles));
+                        if (_mm_movemask_epi8(_mm_cmpeq_epi8(classes, _mm_setzero_si128())) != 0xffff) {
+                            return false;
+                        }
+
+                        // The offset is chosen by the high nibble, '/' shares it with '+' and is told apart
+                        __m128i eq_slash = _mm_cmpeq_epi8(x, _mm_set1_epi8('/'));
+                        __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_slash, hi_nibbles));
+                        x = _mm_add_epi8(x, roll);
+
+                        // Merge four 6-bit values into 24 bits per 32-bit lane and gather the octets
+                        __m128i merged = _mm_maddubs_epi16(x, _mm_set1_epi32(0x01400140));
+                        merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+                        const __m128i gather = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+                        values = _mm_shuffle_epi8(merged, gather);
+                        return true;
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static inline __m128i lookup(__m128i indices) {
+                        // 0 for 'a'-'z', 1-10 for '0'-'9', 11 and 12 for '+' and '/', 13 for 'A'-'Z'
+                        const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                              '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                              '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+                        __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+                        __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+                        range = _mm_or_si128(range, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+                        return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace codec
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_CODEC_BASE64_SSSE3_IMPL_HPP
@@ -10,18 +10,26 @@
 #ifndef CRYPTO3_BASE_POLICY_HPP
 #define CRYPTO3_BASE_POLICY_HPP
 
+#include <algorithm>
 #include <array>
 
 #include <boost/integer.hpp>
 
 #include <boost/container/small_vector.hpp>
 
-#include <boost/multiprecision/cpp_int.hpp>
-#include <boost/multiprecision/integer.hpp>
+#include <boost/exception/exception.hpp>
+#include <boost/exception/info.hpp>
+#include <boost/throw_exception.hpp>
 
 #include <boost/crypto3/detail/inline_variable.hpp>
 
-using namespace boost::multiprecision;
+#include <boost/crypto3/codec/detail/base58/base58_impl.hpp>
+
+#include <boost/crypto3/detail/simd_backend.hpp>
+
+#include <boost/crypto3/codec/detail/base64/base64_impl.hpp>
+#include <boost/crypto3/codec/detail/base64/base64_ssse3_impl.hpp>
+#include <boost/crypto3/codec/detail/base64/base64_avx2_impl.hpp>
 
 namespace boost {
     namespace crypto3 {
@@ -57,7 +65,22 @@ namespace boost {
 
             typedef boost::error_info<struct bad_char_, char> bad_char;
 
+            /*!
+             * @brief Bulk base64 implementations selectable at runtime
+             */
+            typedef ::boost::crypto3::simd_backend base64_backend;
+
             namespace detail {
+                /*!
+                 * @brief Bulk base64 kernels, see dispatch_simd
+                 */
+                struct base64_kernels {
+                    typedef base64_impl portable;
+#ifdef CRYPTO3_HAS_SIMD_X86
+                    typedef base64_ssse3_impl ssse3;
+                    typedef base64_avx2_impl avx2;
+#endif
+                };
 
                 template<std::size_t Version>
                 class basic_base_policy {};
@@ -281,56 +304,128 @@ namespace boost {
 
                     constexpr static const std::size_t encoded_value_bits = CHAR_BIT;
 
+                    // Blocks of addresses, key identifiers and signatures stay off the heap
+                    constexpr static const std::size_t inline_octets = 128;
+                    constexpr static const std::size_t inline_symbols = inline_octets * 138 / 100 + 1;
+
                     constexpr static const std::size_t decoded_block_values = 1;
                     constexpr static const std::size_t decoded_block_bits = decoded_block_values * decoded_value_bits;
-                    typedef boost::container::small_vector<decoded_value_type, decoded_block_values> decoded_block_type;
+                    typedef boost::container::small_vector<decoded_value_type, inline_octets> decoded_block_type;
 
                     constexpr static const std::size_t encoded_block_values = 1;
                     constexpr static const std::size_t encoded_block_bits = encoded_block_values * encoded_value_bits;
-                    typedef boost::container::small_vector<encoded_value_type, encoded_block_values> encoded_block_type;
+                    typedef boost::container::small_vector<encoded_value_type, inline_symbols> encoded_block_type;
                 };
 
                 template<>
                 class base_functions<58> : public basic_base_policy<58> {
                 public:
-                    template<typename NumberType = cpp_int>
+                    /*!
+                     * @brief Converts the number held in the octets, most significant first, into base58
+                     * symbols, least significant first. Leading zero octets are left to the codec.
+                     */
                     static inline encoded_block_type encode_block(const decoded_block_type &plaintext) {
-                        encoded_block_type out;
-                        std::size_t csint = basic_base_policy<58>::constants_size;
-                        NumberType v = 0, q = 0, r = 0, cs(csint);
-
-                        import_bits(v, plaintext.begin(), plaintext.end(), encoded_value_bits);
-                        while (v != 0) {
-                            divide_qr(v, cs, q, r);
-                            out.emplace_back(constants()[r.template convert_to<std::uint8_t>()]);
-                            v = q;
+                        encoded_block_type out(base58_impl::encoded_size(plaintext.size()));
+                        out.erase(base58_impl::encode(plaintext.data(), plaintext.size(), out.begin()), out.end());
+                        for (encoded_value_type &c : out) {
+                            c = constants()[c];
                         }
                         return out;
                     }
 
-                    template<typename NumberType = cpp_int>
+                    /*!
+                     * @brief Converts base58 symbols, most significant first, into the number they hold as
+                     * octets, least significant first. Spaces and line feeds are skipped.
+                     */
                     static inline decoded_block_type decode_block(const encoded_block_type &plaintext) {
-                        decoded_block_type out;
-                        std::size_t csint = basic_base_policy<58>::constants_size;
-                        NumberType v = 0;
+                        base58_impl::digits_type digits;
+                        digits.reserve(plaintext.size());
 
                         for (const typename encoded_block_type::value_type &c : plaintext) {
                             if (c == ' ' || c == '\n') {
                                 continue;
                             }
-                            const size_t idx = inverted_constants()[c];
+                            const std::uint8_t idx = inverted_constants()[c];
 
                             if (idx == 0x80) {
                                 throw wrong_input_symbol<58>();
-                                // throw std::invalid_argument("Invalid base58");
                             }
-                            v *= csint;
-                            v += idx;
+                            digits.push_back(idx);
                         }
-                        export_bits(v, std::inserter(out, out.end()), decoded_value_bits);
-                        std::reverse(out.begin(), out.end());
+
+                        decoded_block_type out(base58_impl::decoded_size(digits.size()));
+                        out.erase(base58_impl::decode(digits.data(), digits.size(), out.begin()), out.end());
                         return out;
                     }
+
+                    /*!
+                     * @brief Upper bound of the amount of symbols n octets are encoded into
+                     */
+                    constexpr static std::size_t encoded_size(std::size_t n) {
+                        return base58_impl::encoded_size(n);
+                    }
+
+                    /*!
+                     * @brief Upper bound of the amount of octets n symbols are decoded into
+                     */
+                    constexpr static std::size_t decoded_size(std::size_t n) {
+                        return n;
+                    }
+
+                    /*!
+                     * @brief Encodes n octets into a caller provided buffer, leading zero octets included.
+                     * Nothing is allocated for inputs up to base58_impl::stack_octets long.
+                     * @param out Output symbols, encoded_size(n) of them at most
+                     * @return Pointer past the last symbol written
+                     */
+                    static inline encoded_value_type *encode(const decoded_value_type *in, std::size_t n,
+                                                             encoded_value_type *out) {
+                        std::size_t zeros = 0;
+                        while (zeros != n && !in[zeros]) {
+                            out[zeros++] = constants()[0];
+                        }
+
+                        encoded_value_type *first = out + zeros;
+                        encoded_value_type *last = base58_impl::encode(in + zeros, n - zeros, first);
+                        std::reverse(first, last);
+                        for (encoded_value_type *it = first; it != last; ++it) {
+                            *it = constants()[*it];
+                        }
+                        return last;
+                    }
+
+                    /*!
+                     * @brief Decodes n symbols into a caller provided buffer, leading '1' symbols included.
+                     * Spaces and line feeds are skipped. Nothing is allocated for inputs up to
+                     * base58_impl::stack_symbols long.
+                     * @param out Output octets, decoded_size(n) of them at most
+                     * @return Pointer past the last octet written
+                     */
+                    static inline decoded_value_type *decode(const encoded_value_type *in, std::size_t n,
+                                                             decoded_value_type *out) {
+                        std::size_t i = 0;
+                        for (; i != n && in[i] == constants()[0]; ++i) {
+                            *out++ = 0;
+                        }
+
+                        base58_impl::digits_type digits;
+                        digits.reserve(n - i);
+                        for (; i != n; ++i) {
+                            if (in[i] == ' ' || in[i] == '\n') {
+                                continue;
+                            }
+                            const std::uint8_t idx = inverted_constants()[in[i]];
+
+                            if (idx == 0x80) {
+                                throw wrong_input_symbol<58>();
+                            }
+                            digits.push_back(idx);
+                        }
+
+                        decoded_value_type *last = base58_impl::decode(digits.data(), digits.size(), out);
+                        std::reverse(out, last);
+                        return last;
+                    }
                 };
 
                 template<>
@@ -388,6 +483,51 @@ namespace boost {
 
                         return out;
                     }
+
+                    /*!
+                     * @brief Encodes n consecutive blocks of contiguous octets at once.
+                     * @param in Input octets, n * 3 of them.
+                     * @param out Output symbols, n * 4 of them.
+                     * @param backend Implementation to use, the fastest available one by default.
+                     * @throws std::invalid_argument if the backend is not available on this processor.
+                     */
+                    static inline void encode_blocks(const decoded_value_type *in, encoded_value_type *out,
+                                                     std::size_t n,
+                                                     base64_backend backend = base64_backend::automatic) {
+                        ::boost::crypto3::detail::dispatch_simd<base64_kernels>(
+                            backend, [&](auto kernels) { decltype(kernels)::encode_blocks(in, out, n); });
+                    }
+
+                    /*!
+                     * @brief Decodes n consecutive blocks of contiguous symbols at once. Blocks holding
+                     * padding, whitespace or invalid symbols are passed to decode_block, so the result and
+                     * the errors are the same as with decode_block applied to each block.
+                     * @param in Input symbols, n * 4 of them.
+                     * @param out Output octets, n * 3 of them.
+                     * @param backend Implementation to use, the fastest available one by default.
+                     * @throws std::invalid_argument if the backend is not available on this processor.
+                     */
+                    static inline void decode_blocks(const encoded_value_type *in, decoded_value_type *out,
+                                                     std::size_t n,
+                                                     base64_backend backend = base64_backend::automatic) {
+                        backend = ::boost::crypto3::detail::select_simd_backend(backend);
+                        while (n) {
+                            std::size_t done = ::boost::crypto3::detail::dispatch_simd<base64_kernels>(
+                                backend, [&](auto kernels) { return decltype(kernels)::decode_blocks(in, out, n); });
+                            in += done * encoded_block_values;
+                            out += done * decoded_block_values;
+                            n -= done;
+
+                            if (n) {
+                                encoded_block_type block;
+                                std::copy(in, in + encoded_block_values, block.begin());
+                                decoded_block_type plaintext = decode_block(block);
+                                out = std::copy(plaintext.begin(), plaintext.end(), out);
+                                in += encoded_block_values;
+                                --n;
+                            }
+                        }
+                    }
                 };
 
                 template<std::size_t Version>
@@ -10,6 +10,11 @@
 #ifndef CRYPTO3_PREPROCESSING_MODES_HPP
 #define CRYPTO3_PREPROCESSING_MODES_HPP
 
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/crypto3/codec/detail/codec_traits.hpp>
+
 namespace boost {
     namespace crypto3 {
         namespace codec {
@@ -49,6 +54,33 @@ namespace boost {
                     static inline output_block_type process_block(const input_block_type &plaintext) {
                         return codec_type::encode(plaintext);
                     }
+
+                    /*!
+                     * @brief Encodes n consecutive blocks of contiguous values, with a single codec call
+                     * if the codec supports it.
+                     */
+                    template<typename OutputIterator>
+                    static inline void process_blocks(const input_value_type *in, OutputIterator out, std::size_t n) {
+                        process_blocks(in, out, n, std::integral_constant<bool, has_encode_blocks<Codec>::value>());
+                    }
+
+                protected:
+                    template<typename OutputIterator>
+                    static inline void process_blocks(const input_value_type *in, OutputIterator out, std::size_t n,
+                                                      std::true_type) {
+                        codec_type::encode_blocks(in, out, n);
+                    }
+
+                    template<typename OutputIterator>
+                    static inline void process_blocks(const input_value_type *in, OutputIterator out, std::size_t n,
+                                                      std::false_type) {
+                        for (; n; --n, in += input_block_values) {
+                            input_block_type block;
+                            std::copy(in, in + input_block_values, block.begin());
+                            output_block_type ob = process_block(block);
+                            out = std::copy(ob.begin(), ob.end(), out);
+                        }
+                    }
                 };
 
                 template<typename Codec>
@@ -75,6 +107,33 @@ namespace boost {
                     static inline output_block_type process_block(const input_block_type &plaintext) {
                         return codec_type::decode(plaintext);
                     }
+
+                    /*!
+                     * @brief Decodes n consecutive blocks of contiguous values, with a single codec call
+                     * if the codec supports it.
+                     */
+                    template<typename OutputIterator>
+                    static inline void process_blocks(const input_value_type *in, OutputIterator out, std::size_t n) {
+                        process_blocks(in, out, n, std::integral_constant<bool, has_decode_blocks<Codec>::value>());
+                    }
+
+                protected:
+                    template<typename OutputIterator>
+                    static inline void process_blocks(const input_value_type *in, OutputIterator out, std::size_t n,
+                                                      std::true_type) {
+                        codec_type::decode_blocks(in, out, n);
+                    }
+
+                    template<typename OutputIterator>
+                    static inline void process_blocks(const input_value_type *in, OutputIterator out, std::size_t n,
+                                                      std::false_type) {
+                        for (; n; --n, in += input_block_values) {
+                            input_block_type block;
+                            std::copy(in, in + input_block_values, block.begin());
+                            output_block_type ob = process_block(block);
+                            out = std::copy(ob.begin(), ob.end(), out);
+                        }
+                    }
                 };
             }    // namespace detail
         }        // namespace codec
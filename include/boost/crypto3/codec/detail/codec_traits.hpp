@@ -0,0 +1,74 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_CODEC_TRAITS_HPP
+#define CRYPTO3_CODEC_TRAITS_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+    namespace crypto3 {
+        namespace codec {
+            namespace detail {
+                /*!
+                 * @brief has_encode_blocks trait checks whether the codec is able to encode several
+                 * consecutive blocks of contiguous values with a single call, i.e. provides
+                 * encode_blocks(const decoded_value_type *, encoded_value_type *, std::size_t) static function.
+                 * Encoding modes fall back to an encode loop otherwise.
+                 *
+                 * @tparam Codec
+                 */
+                template<typename Codec>
+                struct has_encode_blocks {
+                private:
+                    template<typename C>
+                    static auto test(int)
+                        -> decltype(C::encode_blocks(std::declval<const typename C::decoded_value_type *>(),
+                                                     std::declval<typename C::encoded_value_type *>(),
+                                                     std::declval<std::size_t>()),
+                                    std::true_type());
+
+                    template<typename C>
+                    static std::false_type test(...);
+
+                public:
+                    constexpr static const bool value = decltype(test<Codec>(0))::value;
+                };
+
+                /*!
+                 * @brief has_decode_blocks trait checks whether the codec is able to decode several
+                 * consecutive blocks of contiguous values with a single call, i.e. provides
+                 * decode_blocks(const encoded_value_type *, decoded_value_type *, std::size_t) static function.
+                 * Decoding modes fall back to a decode loop otherwise.
+                 *
+                 * @tparam Codec
+                 */
+                template<typename Codec>
+                struct has_decode_blocks {
+                private:
+                    template<typename C>
+                    static auto test(int)
+                        -> decltype(C::decode_blocks(std::declval<const typename C::encoded_value_type *>(),
+                                                     std::declval<typename C::decoded_value_type *>(),
+                                                     std::declval<std::size_t>()),
+                                    std::true_type());
+
+                    template<typename C>
+                    static std::false_type test(...);
+
+                public:
+                    constexpr static const bool value = decltype(test<Codec>(0))::value;
+                };
+            }    // namespace detail
+        }        // namespace codec
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_CODEC_TRAITS_HPP
@@ -14,6 +14,7 @@
 
 #include <boost/crypto3/detail/pack.hpp>
 #include <boost/crypto3/detail/digest.hpp>
+#include <boost/crypto3/detail/type_traits.hpp>
 
 #include <boost/crypto3/codec/accumulators/codec.hpp>
 
@@ -22,6 +23,7 @@
 #include <boost/utility/enable_if.hpp>
 
 #include <boost/range/algorithm/copy.hpp>
+#include <boost/range/iterator_range.hpp>
 
 namespace boost {
     namespace crypto3 {
@@ -82,7 +84,35 @@ namespace boost {
                 }
 
                 template<typename InputIterator>
-                void update_n(InputIterator first, InputIterator last) {
+                void update_n(InputIterator first, InputIterator last, std::true_type) {
+                    std::size_t n = std::distance(first, last);
+                    if (!n) {
+                        return;
+                    }
+
+                    const input_value_type *p = reinterpret_cast<const input_value_type *>(std::addressof(*first));
+
+                    // Top up the partially filled block first
+                    for (; n && (seen % input_block_bits); --n) {
+                        update_one(*p++);
+                    }
+
+                    // Whole blocks are handed over at once, they leave seen % input_block_bits unchanged
+                    std::size_t blocks = n / block_values;
+                    if (blocks) {
+                        state(boost::make_iterator_range(p, p + blocks * block_values),
+                              accumulators::bits = blocks * input_block_bits);
+                        p += blocks * block_values;
+                        n -= blocks * block_values;
+                    }
+
+                    for (; n; --n) {
+                        update_one(*p++);
+                    }
+                }
+
+                template<typename InputIterator>
+                void update_n(InputIterator first, InputIterator last, std::false_type) {
                     std::size_t n = std::distance(first, last);
 #ifndef CRYPTO3_CODEC_NO_OPTIMIZATION
 #pragma clang loop unroll(full)
@@ -115,6 +145,19 @@ namespace boost {
                     }
                 }
 
+                template<typename InputIterator>
+                void update_n(InputIterator first, InputIterator last) {
+                    typedef ::boost::crypto3::detail::is_contiguous_iterator<InputIterator> is_contiguous;
+                    typedef typename std::iterator_traits<InputIterator>::value_type iterator_value_type;
+
+                    // Octets stored as octets are passed to the accumulator straight from the caller's buffer
+                    update_n(first, last,
+                             std::integral_constant<bool, is_contiguous::value &&
+                                                              sizeof(iterator_value_type) * CHAR_BIT == value_bits &&
+                                                              value_bits == input_value_bits &&
+                                                              input_value_bits == CHAR_BIT>());
+                }
+
             public:
                 fixed_block_stream_processor(accumulator_type &s) : state(s), seen(0), cache(cache_type()) {
                 }
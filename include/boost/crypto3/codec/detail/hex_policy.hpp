@@ -15,9 +15,13 @@
 
 #include <boost/crypto3/detail/inline_variable.hpp>
 
+#include <boost/crypto3/detail/hex.hpp>
+
 namespace boost {
     namespace crypto3 {
         namespace codec {
+            using ::boost::crypto3::hex_backend;
+
             namespace mode {
                 struct upper {
                     typedef const char *constants_type;
@@ -52,6 +56,33 @@ namespace boost {
                     constexpr static const std::size_t encoded_block_values = 2;
                     constexpr static const std::uint8_t encoded_block_bits = encoded_block_values * encoded_value_bits;
                     typedef std::array<encoded_value_type, encoded_block_values> encoded_block_type;
+
+                    /*!
+                     * @brief Encodes n contiguous octets into 2 * n symbols at once.
+                     * @param in Input octets, n of them.
+                     * @param out Output symbols, n * 2 of them.
+                     * @param backend Implementation to use, the fastest available one by default.
+                     * @throws std::invalid_argument if the backend is not available on this processor.
+                     */
+                    static inline void encode_blocks(const decoded_value_type *in, encoded_value_type *out,
+                                                     std::size_t n, hex_backend backend = hex_backend::automatic) {
+                        ::boost::crypto3::detail::hex_encode_blocks(in, out, n, constants(), backend);
+                    }
+
+                    /*!
+                     * @brief Decodes pairs of contiguous symbols of either case into octets, stopping at the
+                     * first pair holding anything but hex digits.
+                     * @param in Input symbols, n * 2 of them.
+                     * @param out Output octets, n of them.
+                     * @param backend Implementation to use, the fastest available one by default.
+                     * @throws std::invalid_argument if the backend is not available on this processor.
+                     * @return The amount of octets decoded, n unless an invalid pair is met.
+                     */
+                    static inline std::size_t decode_blocks(const encoded_value_type *in, decoded_value_type *out,
+                                                            std::size_t n,
+                                                            hex_backend backend = hex_backend::automatic) {
+                        return ::boost::crypto3::detail::hex_decode_blocks(in, out, n, backend);
+                    }
                 };
             }    // namespace detail
         }        // namespace codec
@@ -176,6 +176,30 @@ namespace boost {
                     return res;
                 }
 
+                /*!
+                 * @brief Encodes n consecutive data blocks of contiguous values.
+                 * @param in Input plaintext, n octets.
+                 * @param out Output, n * 2 symbols.
+                 */
+                inline static void encode_blocks(const decoded_value_type *in, encoded_value_type *out, std::size_t n) {
+                    policy_type::encode_blocks(in, out, n);
+                }
+
+                /*!
+                 * @brief Decodes n consecutive data blocks of contiguous values. A block holding anything but
+                 * hex digits is passed to decode, so it throws non_hex_input with the offending character.
+                 * @param in Input encoded data, n * 2 symbols.
+                 * @param out Output, n octets.
+                 */
+                inline static void decode_blocks(const encoded_value_type *in, decoded_value_type *out, std::size_t n) {
+                    std::size_t done = policy_type::decode_blocks(in, out, n);
+                    if (done != n) {
+                        encoded_block_type block = {{in[done * encoded_block_values],
+                                                     in[done * encoded_block_values + 1]}};
+                        decode(block);
+                    }
+                }
+
                 template<typename ProcessingMode>
                 using accumulator_mode_type = accumulators::preprocessing_accumulator_mode<ProcessingMode>;
 
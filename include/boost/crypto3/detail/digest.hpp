@@ -10,6 +10,7 @@
 #ifndef CRYPTO3_DIGEST_HPP
 #define CRYPTO3_DIGEST_HPP
 
+#include <algorithm>
 #include <iostream>
 
 #include <boost/static_assert.hpp>
@@ -20,6 +21,8 @@
 #include <boost/crypto3/detail/pack.hpp>
 #include <boost/crypto3/detail/octet.hpp>
 
+#include <boost/crypto3/detail/hex.hpp>
+
 namespace boost {
     namespace crypto3 {
         /*!
@@ -69,12 +72,9 @@ namespace boost {
             template<std::size_t DigestBits, typename OutputIterator>
             OutputIterator to_ascii(const digest<DigestBits> &d,
                                     OutputIterator it) {
-                for (std::size_t j = 0; j < d.size(); ++j) {
-                    octet_type b = d[j];
-                    *it++ = "0123456789abcdef"[(b >> 4) & 0xF];
-                    *it++ = "0123456789abcdef"[(b >> 0) & 0xF];
-                }
-                return it;
+                boost::container::small_vector<octet_type, DigestBits / 4> s(2 * d.size());
+                hex_encode_blocks(d.data(), s.data(), d.size(), "0123456789abcdef");
+                return std::copy(s.begin(), s.end(), it);
             }
 
             template<std::size_t DigestBits>
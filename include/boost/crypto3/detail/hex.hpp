@@ -0,0 +1,68 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_HEX_HPP
+#define CRYPTO3_DETAIL_HEX_HPP
+
+#include <boost/crypto3/detail/simd_backend.hpp>
+
+#include <boost/crypto3/detail/hex/hex_impl.hpp>
+#include <boost/crypto3/detail/hex/hex_ssse3_impl.hpp>
+#include <boost/crypto3/detail/hex/hex_avx2_impl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+    namespace crypto3 {
+        /*!
+         * @brief Bulk hex implementations selectable at runtime
+         */
+        typedef simd_backend hex_backend;
+
+        namespace detail {
+            /*!
+             * @brief Bulk hex kernels, see dispatch_simd
+             */
+            struct hex_kernels {
+                typedef hex_impl portable;
+#ifdef CRYPTO3_HAS_SIMD_X86
+                typedef hex_ssse3_impl ssse3;
+                typedef hex_avx2_impl avx2;
+#endif
+            };
+
+            /*!
+             * @brief Encodes n contiguous octets into 2 * n symbols of the 16 symbols alphabet. Shared by
+             * the hex codec and the digest string conversions.
+             * @param backend Implementation to use, the fastest available one by default.
+             * @throws std::invalid_argument if the backend is not available on this processor.
+             */
+            inline void hex_encode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n,
+                                          const char *alphabet, hex_backend backend = hex_backend::automatic) {
+                dispatch_simd<hex_kernels>(
+                    backend, [&](auto kernels) { decltype(kernels)::encode_blocks(in, out, n, alphabet); });
+            }
+
+            /*!
+             * @brief Decodes pairs of contiguous symbols of either case into n octets, stopping at the first
+             * pair holding anything but hex digits.
+             * @param backend Implementation to use, the fastest available one by default.
+             * @throws std::invalid_argument if the backend is not available on this processor.
+             * @return The amount of octets decoded, n unless an invalid pair is met.
+             */
+            inline std::size_t hex_decode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n,
+                                                 hex_backend backend = hex_backend::automatic) {
+                return dispatch_simd<hex_kernels>(
+                    backend, [&](auto kernels) { return decltype(kernels)::decode_blocks(in, out, n); });
+            }
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_DETAIL_HEX_HPP
@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_HEX_AVX2_IMPL_HPP
+#define CRYPTO3_DETAIL_HEX_AVX2_IMPL_HPP
+
+#include <boost/crypto3/detail/simd_backend.hpp>
+#include <boost/crypto3/detail/hex/hex_ssse3_impl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CRYPTO3_HAS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace detail {
+#ifdef CRYPTO3_HAS_SIMD_X86
+            /*!
+             * @brief Hex on 32 octets at once, the SSSE3 arithmetic applied to both 128-bit lanes.
+             * Unpacking and packing work within lanes, so the halves are put back in order with
+             * cross-lane permutations.
+             */
+            struct hex_avx2_impl {
+                constexpr static const std::size_t parallel_octets = 32;
+
+                static bool is_available() {
+                    return cpuid::has_avx2();
+                }
+
+                /*!
+                 * @brief Same as hex_impl::encode_blocks, 32 octets into 64 symbols per step. The rest
+                 * is left to the SSSE3 and the portable implementations.
+                 */
+                BOOST_ATTRIBUTE_TARGET("avx2")
+                static std::size_t encode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n,
+                                                 const char *alphabet) {
+                    const __m256i lut =
+                        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(alphabet)));
+
+                    std::size_t i = 0;
+                    for (; i + parallel_octets <= n; i += parallel_octets) {
+                        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+                        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), _mm256_set1_epi8(0x0f));
+                        __m256i lo = _mm256_and_si256(x, _mm256_set1_epi8(0x0f));
+
+                        // Octets 0-7 and 16-23, then 8-15 and 24-31
+                        __m256i first = _mm256_shuffle_epi8(lut, _mm256_unpacklo_epi8(hi, lo));
+                        __m256i second = _mm256_shuffle_epi8(lut, _mm256_unpackhi_epi8(hi, lo));
+
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                                            _mm256_permute2x128_si256(first, second, 0x20));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 32),
+                                            _mm256_permute2x128_si256(first, second, 0x31));
+                        out += 2 * parallel_octets;
+                    }
+                    return i + hex_ssse3_impl::encode_blocks(in + i, out, n - i, alphabet);
+                }
+
+                /*!
+                 * @brief Same as hex_impl::decode_blocks, 64 symbols into 32 octets per step. The rest
+                 * is left to the SSSE3 and the portable implementations.
+                 */
+                BOOST_ATTRIBUTE_TARGET("avx2")
+                static std::size_t decode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                    std::size_t i = 0;
+                    for (; i + parallel_octets <= n; i += parallel_octets) {
+                        __m256i lo, hi;
+                        if (!decode(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(in)), lo) ||
+                            !decode(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + 32)), hi)) {
+                            break;
+                        }
+                        // Packing interleaves the lanes as lo0 hi0 lo1 hi1 in 64-bit quarters
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                                            _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xd8));
+                        in += 2 * parallel_octets;
+                    }
+                    return i + hex_ssse3_impl::decode_blocks(in, out + i, n - i);
+                }
+
+            protected:
+                /*!
+                 * @brief Decodes 32 symbols into 16 octets, each one zero-extended to 16 bits
+                 * @return false if any of the symbols is not a hex digit
+                 */
+                BOOST_ATTRIBUTE_TARGET("avx2")
+                static inline bool decode(__m256i x, __m256i &values) {
+                    __m256i digits = _mm256_sub_epi8(x, _mm256_set1_epi8('0'));
+                    __m256i letters =
+                        _mm256_sub_epi8(_mm256_or_si256(x, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+                    __m256i is_digit =
+                        _mm256_cmpeq_epi8(_mm256_max_epu8(digits, _mm256_set1_epi8(9)), _mm256_set1_epi8(9));
+                    __m256i is_letter =
+                        _mm256_cmpeq_epi8(_mm256_max_epu8(letters, _mm256_set1_epi8(5)), _mm256_set1_epi8(5));
+                    if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)) != -1) {
+                        return false;
+                    }
+
+                    letters = _mm256_add_epi8(letters, _mm256_set1_epi8(10));
+                    __m256i nibbles = _mm256_blendv_epi8(letters, digits, is_digit);
+
+                    values = _mm256_maddubs_epi16(nibbles, _mm256_set1_epi16(0x0110));
+                    return true;
+                }
+            };
+#endif
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_DETAIL_HEX_AVX2_IMPL_HPP
@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_HEX_IMPL_HPP
+#define CRYPTO3_DETAIL_HEX_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+    namespace crypto3 {
+        namespace detail {
+            /*!
+             * @brief Portable bulk hex. Symbols are looked up in the 16 symbols alphabet of the mode,
+             * decoding accepts both cases and computes nibbles with arithmetic instead of branches.
+             */
+            struct hex_impl {
+                /*!
+                 * @brief Encodes n octets into 2 * n symbols of alphabet
+                 * @return The amount of octets processed, always n
+                 */
+                static std::size_t encode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n,
+                                                 const char *alphabet) {
+                    for (std::size_t i = 0; i != n; ++i, out += 2) {
+                        out[0] = static_cast<std::uint8_t>(alphabet[in[i] >> 4]);
+                        out[1] = static_cast<std::uint8_t>(alphabet[in[i] & 0x0f]);
+                    }
+                    return n;
+                }
+
+                /*!
+                 * @brief Decodes pairs of symbols into octets up to the first pair holding anything but
+                 * hex digits of either case
+                 * @return The amount of octets decoded
+                 */
+                static std::size_t decode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                    for (std::size_t i = 0; i != n; ++i, in += 2) {
+                        int hi = decode_symbol(in[0]), lo = decode_symbol(in[1]);
+                        if ((hi | lo) < 0) {
+                            return i;
+                        }
+                        out[i] = static_cast<std::uint8_t>((hi << 4) | lo);
+                    }
+                    return n;
+                }
+
+            protected:
+                /*!
+                 * @brief Maps a symbol onto its nibble, -1 for anything but hex digits. Each range check
+                 * yields an all-ones or all-zeros mask from the sign of the difference.
+                 */
+                static inline int decode_symbol(std::uint8_t symbol) {
+                    int c = symbol;
+                    int ret = -1;
+                    ret += (((0x2f - c) & (c - 0x3a)) >> 8) & (c - 0x2f);
+                    ret += (((0x40 - c) & (c - 0x47)) >> 8) & (c - 0x36);
+                    ret += (((0x60 - c) & (c - 0x67)) >> 8) & (c - 0x56);
+                    return ret;
+                }
+            };
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_DETAIL_HEX_IMPL_HPP
@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_HEX_SSSE3_IMPL_HPP
+#define CRYPTO3_DETAIL_HEX_SSSE3_IMPL_HPP
+
+#include <boost/crypto3/detail/simd_backend.hpp>
+#include <boost/crypto3/detail/hex/hex_impl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CRYPTO3_HAS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace detail {
+#ifdef CRYPTO3_HAS_SIMD_X86
+            /*!
+             * @brief Hex on 16 octets at once. Nibbles are turned into symbols with a pshufb of the
+             * alphabet, symbols are validated and turned back into nibbles with range comparisons.
+             */
+            struct hex_ssse3_impl {
+                constexpr static const std::size_t parallel_octets = 16;
+
+                static bool is_available() {
+                    return cpuid::has_ssse3();
+                }
+
+                /*!
+                 * @brief Same as hex_impl::encode_blocks, 16 octets into 32 symbols per step
+                 */
+                BOOST_ATTRIBUTE_TARGET("ssse3")
+                static std::size_t encode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n,
+                                                 const char *alphabet) {
+                    const __m128i lut = _mm_loadu_si128(reinterpret_cast<const __m128i *>(alphabet));
+
+                    std::size_t i = 0;
+                    for (; i + parallel_octets <= n; i += parallel_octets) {
+                        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                        __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), _mm_set1_epi8(0x0f));
+                        __m128i lo = _mm_and_si128(x, _mm_set1_epi8(0x0f));
+
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                                         _mm_shuffle_epi8(lut, _mm_unpacklo_epi8(hi, lo)));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16),
+                                         _mm_shuffle_epi8(lut, _mm_unpackhi_epi8(hi, lo)));
+                        out += 2 * parallel_octets;
+                    }
+                    return i + hex_impl::encode_blocks(in + i, out, n - i, alphabet);
+                }
+
+                /*!
+                 * @brief Same as hex_impl::decode_blocks, 32 symbols into 16 octets per step
+                 */
+                BOOST_ATTRIBUTE_TARGET("ssse3")
+                static std::size_t decode_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                    std::size_t i = 0;
+                    for (; i + parallel_octets <= n; i += parallel_octets) {
+                        __m128i lo, hi;
+                        if (!decode(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in)), lo) ||
+                            !decode(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 16)), hi)) {
+                            break;
+                        }
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(lo, hi));
+                        in += 2 * parallel_octets;
+                    }
+                    return i + hex_impl::decode_blocks(in, out + i, n - i);
+                }
+
+            protected:
+                /*!
+                 * @brief Decodes 16 symbols into 8 octets, each one zero-extended to 16 bits
+                 * @return false if any of the symbols is not a hex digit
+                 */
+                BOOST_ATTRIBUTE_TARGET("ssse3")
+                static inline bool decode(__m128i x, __m128i &values) {
+                    // Unsigned range checks, letters of both cases are folded to the lower one
+                    __m128i digits = _mm_sub_epi8(x, _mm_set1_epi8('0'));
+                    __m128i letters = _mm_sub_epi8(_mm_or_si128(x, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+                    __m128i is_digit = _mm_cmpeq_epi8(_mm_max_epu8(digits, _mm_set1_epi8(9)), _mm_set1_epi8(9));
+                    __m128i is_letter =
+                        _mm_cmpeq_epi8(_mm_max_epu8(letters, _mm_set1_epi8(5)), _mm_set1_epi8(5));
+                    if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xffff) {
+                        return false;
+                    }
+
+                    letters = _mm_add_epi8(letters, _mm_set1_epi8(10));
+                    __m128i nibbles =
+                        _mm_or_si128(_mm_and_si128(is_digit, digits), _mm_andnot_si128(is_digit, letters));
+
+                    // High nibble comes first in every pair of symbols
+                    values = _mm_maddubs_epi16(nibbles, _mm_set1_epi16(0x0110));
+                    return true;
+                }
+            };
+#endif
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_DETAIL_HEX_SSSE3_IMPL_HPP
@@ -18,11 +18,13 @@
 #include <boost/crypto3/detail/predef.hpp>
 
 #include <boost/static_assert.hpp>
+#include <boost/endian/conversion.hpp>
 #include <boost/predef/other/endian.h>
 #include <boost/predef/architecture.h>
 
 #include <algorithm>
 #include <climits>
+#include <cstring>
 #include <iterator>
 #include <type_traits>
 
@@ -97,6 +99,63 @@ namespace boost {
                 : host_can_memcpy<UnitBits, InputBits, OutputBits, , InT, OutT> { };
 #endif
 
+            /*!
+             * @brief octet_word_order trait checks whether words represented in Endianness endianness
+             * consist of whole octets ordered by unit only, so they can be assembled from an octet sequence
+             * with a memcpy call followed by conversion of each word to the native byte order.
+             *
+             * @ingroup pack
+             *
+             * @tparam Endianness
+             */
+            template<typename Endianness>
+            struct octet_word_order {
+                constexpr static const bool value = false;
+            };
+
+            template<>
+            struct octet_word_order<stream_endian::big_octet_big_bit> {
+                constexpr static const bool value = true;
+
+                template<typename T>
+                inline static void to_native(T &word) {
+                    boost::endian::big_to_native_inplace(word);
+                }
+            };
+
+            template<>
+            struct octet_word_order<stream_endian::little_octet_big_bit> {
+                constexpr static const bool value = true;
+
+                template<typename T>
+                inline static void to_native(T &word) {
+                    boost::endian::little_to_native_inplace(word);
+                }
+            };
+
+            /*!
+             * @brief can_memcpy_octets trait checks whether octets represented in InputEndianness endianness
+             * can be packed into words represented in OutputEndianness endianness by copying memory
+             * and converting every word to the native byte order afterwards.
+             *
+             * @ingroup pack
+             *
+             * @tparam InputEndianness
+             * @tparam OutputEndianness
+             * @tparam InputBits
+             * @tparam OutputBits
+             * @tparam InT
+             * @tparam OutT
+             */
+            template<typename InputEndianness, typename OutputEndianness, std::size_t InputBits,
+                     std::size_t OutputBits, typename InT, typename OutT>
+            struct can_memcpy_octets {
+                constexpr static const bool value =
+                    CHAR_BIT == 8 && InputBits == 8 && sizeof(InT) == 1 && std::is_integral<InT>::value &&
+                    std::is_unsigned<OutT>::value && sizeof(OutT) * CHAR_BIT == OutputBits &&
+                    octet_word_order<InputEndianness>::value && octet_word_order<OutputEndianness>::value;
+            };
+
             /*!
              * @brief Real_packer is used to transform input data divided into chunks of the bit size InputValueBits
              * represented in input endianness (InputEndianness)
@@ -345,7 +404,37 @@ namespace boost {
                 typedef detail::imploder<InputEndianness, OutputEndianness, InputValueBits, OutputValueBits> imploder;
 
                 template<typename InputIterator, typename OutputIterator>
-                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out) {
+                using can_copy = std::integral_constant<
+                    bool, std::is_pointer<InputIterator>::value && std::is_pointer<OutputIterator>::value &&
+                              can_memcpy_octets<InputEndianness, OutputEndianness, InputValueBits, OutputValueBits,
+                                                InputType, OutputType>::value>;
+
+                /*!
+                 * @brief Packs in_n octets pointed by in into words pointed by out. Octets are copied with a
+                 * single memcpy call, then each word is converted to the native byte order.
+                 * This function is invoked only if input and output iterators are pointers and
+                 * can_memcpy_octets holds.
+                 *
+                 * @ingroup pack
+                 *
+                 * @param in
+                 * @param in_n
+                 * @param out
+                 *
+                 * @return
+                 */
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::true_type) {
+                    std::size_t out_n = in_n / (OutputValueBits / InputValueBits);
+
+                    std::memcpy(out, in, out_n * sizeof(OutputType));
+                    for (std::size_t i = 0; i != out_n; ++i) {
+                        octet_word_order<OutputEndianness>::to_native(out[i]);
+                    }
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::false_type) {
                     std::size_t out_n = in_n / (OutputValueBits / InputValueBits);
 
                     while (out_n--) {
@@ -356,13 +445,29 @@ namespace boost {
                 }
 
                 template<typename InputIterator, typename OutputIterator>
-                inline static void pack(InputIterator first, InputIterator last, OutputIterator out) {
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out) {
+                    pack_n(in, in_n, out, can_copy<InputIterator, OutputIterator>());
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out, std::true_type) {
+                    pack_n(first, std::distance(first, last), out, std::true_type());
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out,
+                                        std::false_type) {
                     while (first != last) {
                         OutputType value = OutputType();
                         imploder::implode(first, value);
                         *out++ = value;
                     }
                 }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out) {
+                    pack(first, last, out, can_copy<InputIterator, OutputIterator>());
+                }
             };
 
             /*!
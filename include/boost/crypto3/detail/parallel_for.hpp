@@ -0,0 +1,77 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_PARALLEL_FOR_HPP
+#define CRYPTO3_DETAIL_PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace boost {
+    namespace crypto3 {
+        /*!
+         * @brief Caller's thread pool bulk work is handed to. executor(n, task) has to run task(i) for
+         * every i in [0, n), possibly concurrently, and return once all of them are done.
+         */
+        typedef std::function<void(std::size_t, const std::function<void(std::size_t)> &)> bulk_executor;
+
+        namespace detail {
+            /*!
+             * @brief Runs fn(i) for every i in [0, n) on up to threads threads, the calling one included.
+             * One-shot bulk helper: the threads are started and joined by every call, which only pays off
+             * for work far longer than a thread start-up. Repeated calls should go to an executor.
+             */
+            template<typename Function>
+            void parallel_for(std::size_t n, std::size_t threads, const Function &fn) {
+                threads = (std::min)(threads, n);
+                if (threads <= 1) {
+                    for (std::size_t i = 0; i != n; ++i) {
+                        fn(i);
+                    }
+                    return;
+                }
+
+                std::atomic<std::size_t> next(0);
+                auto worker = [&]() {
+                    for (std::size_t i = next++; i < n; i = next++) {
+                        fn(i);
+                    }
+                };
+
+                std::vector<std::thread> pool;
+                pool.reserve(threads - 1);
+                for (std::size_t i = 1; i != threads; ++i) {
+                    pool.emplace_back(worker);
+                }
+                worker();
+                for (std::thread &t : pool) {
+                    t.join();
+                }
+            }
+
+            /*!
+             * @brief Runs fn(i) for every i in [0, n) on the executor, or on up to threads threads started
+             * for the call if there is none
+             */
+            template<typename Function>
+            void parallel_for(const bulk_executor &executor, std::size_t n, std::size_t threads, const Function &fn) {
+                if (executor && n > 1 && threads > 1) {
+                    executor(n, std::function<void(std::size_t)>(std::cref(fn)));
+                } else {
+                    parallel_for(n, threads, fn);
+                }
+            }
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_DETAIL_PARALLEL_FOR_HPP
@@ -0,0 +1,35 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_SECURE_ZERO_HPP
+#define CRYPTO3_DETAIL_SECURE_ZERO_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace boost {
+    namespace crypto3 {
+        namespace detail {
+            /*!
+             * @brief Zeroes n values through a volatile pointer, so that wiping key material which is
+             * not read afterwards is not dropped as a dead store
+             */
+            template<typename T>
+            inline void secure_zero(T *p, std::size_t n) {
+                static_assert(std::is_integral<T>::value, "Only integral values are wiped");
+
+                volatile T *v = p;
+                for (std::size_t i = 0; i != n; ++i) {
+                    v[i] = 0;
+                }
+            }
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_DETAIL_SECURE_ZERO_HPP
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_SIMD_BACKEND_HPP
+#define CRYPTO3_DETAIL_SIMD_BACKEND_HPP
+
+#include <stdexcept>
+
+#include <boost/predef/architecture.h>
+
+#include <boost/crypto3/detail/config.hpp>
+
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_HAS_SIMD_X86
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        /*!
+         * @brief Bulk codec implementations selectable at runtime. The x86 ones are compiled in with
+         * per-function target attributes and picked through cpuid, so CRYPTO3_CLEAR_CPUID
+         * (e.g. CRYPTO3_CLEAR_CPUID=avx2,ssse3) masks them as well.
+         */
+        enum class simd_backend {
+            /// The fastest backend the processor supports
+            automatic,
+            /// Portable implementation
+            portable,
+            /// 16 octet vectors
+            ssse3,
+            /// 32 octet vectors
+            avx2
+        };
+
+        namespace detail {
+            /*!
+             * @brief Whether the backend is compiled in and supported by the processor
+             */
+            inline bool is_simd_backend_available(simd_backend backend) {
+                switch (backend) {
+                    case simd_backend::automatic:
+                    case simd_backend::portable:
+                        return true;
+#ifdef CRYPTO3_HAS_SIMD_X86
+                    case simd_backend::ssse3:
+                        return cpuid::has_ssse3();
+                    case simd_backend::avx2:
+                        return cpuid::has_avx2();
+#endif
+                    default:
+                        return false;
+                }
+            }
+
+            /*!
+             * @brief Resolves automatic to the fastest available backend
+             */
+            inline simd_backend select_simd_backend(simd_backend backend) {
+                if (backend != simd_backend::automatic) {
+                    return backend;
+                }
+                const simd_backend preferred[] = {simd_backend::avx2, simd_backend::ssse3};
+                for (simd_backend b : preferred) {
+                    if (is_simd_backend_available(b)) {
+                        return b;
+                    }
+                }
+                return simd_backend::portable;
+            }
+
+            /*!
+             * @brief Calls f with a value of the kernel struct of the selected backend
+             * @tparam Kernels Names the kernel structs as portable, and as ssse3 and avx2 where
+             * CRYPTO3_HAS_SIMD_X86 is defined
+             * @param backend Backend to use, automatic is resolved to the fastest available one
+             * @throws std::invalid_argument if the backend is not available on this processor
+             */
+            template<typename Kernels, typename Function>
+            inline auto dispatch_simd(simd_backend backend, Function &&f)
+                -> decltype(f(typename Kernels::portable())) {
+                if (!is_simd_backend_available(backend)) {
+                    throw std::invalid_argument("simd backend is not available on this processor");
+                }
+                switch (select_simd_backend(backend)) {
+#ifdef CRYPTO3_HAS_SIMD_X86
+                    case simd_backend::avx2:
+                        return f(typename Kernels::avx2());
+                    case simd_backend::ssse3:
+                        return f(typename Kernels::ssse3());
+#endif
+                    default:
+                        return f(typename Kernels::portable());
+                }
+            }
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_DETAIL_SIMD_BACKEND_HPP
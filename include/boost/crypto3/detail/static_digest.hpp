@@ -12,6 +12,7 @@
 #include <boost/static_assert.hpp>
 #include <boost/assert.hpp>
 
+#include <algorithm>
 #include <array>
 #include <string>
 #include <cstring>
@@ -20,6 +21,8 @@
 #include <boost/crypto3/detail/octet.hpp>
 #include <boost/crypto3/detail/pack.hpp>
 
+#include <boost/crypto3/detail/hex.hpp>
+
 namespace boost {
     namespace crypto3 {
         /*!
@@ -58,21 +61,28 @@ namespace boost {
         namespace detail {
             template<std::size_t DigestBits, typename OutputIterator>
             OutputIterator to_ascii(const static_digest<DigestBits> &d, OutputIterator it) {
-                for (std::size_t j = 0; j < DigestBits / octet_bits; ++j) {
-                    octet_type b = d[j];
-                    *it++ = "0123456789abcdef"[(b >> 4) & 0xF];
-                    *it++ = "0123456789abcdef"[(b >> 0) & 0xF];
-                }
-                return it;
+                std::array<octet_type, DigestBits / 4> s;
+                hex_encode_blocks(d.data(), s.data(), d.size(), "0123456789abcdef");
+                return std::copy(s.begin(), s.end(), it);
             }
 
             template<std::size_t DigestBits>
             std::array<char, DigestBits / 4 + 1> c_str(const static_digest<DigestBits> &d) {
                 std::array<char, DigestBits / 4 + 1> s;
-                char *p = to_ascii<DigestBits>(d, s.data());
-                *p++ = '\0';
+                hex_encode_blocks(d.data(), reinterpret_cast<octet_type *>(s.data()), d.size(), "0123456789abcdef");
+                s.back() = '\0';
                 return s;
             }
+
+            /*!
+             * @brief Parses DigestBits / 4 hex digits of either case into the digest
+             * @return false if any of the characters is not a hex digit, the digest is then left partially
+             * filled
+             */
+            template<std::size_t DigestBits>
+            bool from_ascii(const char *s, static_digest<DigestBits> &d) {
+                return hex_decode_blocks(reinterpret_cast<const octet_type *>(s), d.data(), d.size()) == d.size();
+            }
         }    // namespace detail
     }        // namespace crypto3
 }    // namespace boost
@@ -158,7 +168,7 @@ namespace boost {
         template<std::size_t DB>
         bool operator!=(const static_digest<DB> &a, char const *b) {
             BOOST_ASSERT(std::strlen(b) == DB / 4);
-            return std::to_string(a) != b;
+            return std::memcmp(detail::c_str(a).data(), b, DB / 4) != 0;
         }
 
         template<std::size_t DB>
@@ -9,6 +9,11 @@
 #ifndef CRYPTO3_TYPE_TRAITS_HPP
 #define CRYPTO3_TYPE_TRAITS_HPP
 
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #define GENERATE_HAS_MEMBER_TYPE(Type)                                                \
                                                                                       \
     template<class T>                                                                 \
@@ -217,6 +222,30 @@ namespace boost {
                 constexpr static bool value = std::is_same<decltype(test(std::declval<T>())), long>::value;
             };
 
+            /*!
+             * @brief is_contiguous_iterator trait checks whether the iterator is known to address elements
+             * stored contiguously in memory, so the data it iterates over can be accessed through a plain pointer.
+             * Only pointers and iterators of std::vector and std::string are recognized until C++20
+             * contiguous_iterator concept becomes available.
+             *
+             * @tparam Iterator
+             */
+            template<typename Iterator>
+            struct is_contiguous_iterator {
+            private:
+                typedef typename std::iterator_traits<Iterator>::value_type value_type;
+                typedef typename std::conditional<std::is_same<value_type, bool>::value, void *, value_type>::type
+                    element_type;
+
+            public:
+                constexpr static bool value =
+                    std::is_pointer<Iterator>::value ||
+                    std::is_same<Iterator, typename std::vector<element_type>::iterator>::value ||
+                    std::is_same<Iterator, typename std::vector<element_type>::const_iterator>::value ||
+                    std::is_same<Iterator, std::string::iterator>::value ||
+                    std::is_same<Iterator, std::string::const_iterator>::value;
+            };
+
             template<typename Range>
             struct is_range {
                 static const bool value = has_begin<Range>::value && has_end<Range>::value;
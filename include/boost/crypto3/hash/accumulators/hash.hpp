@@ -31,6 +31,8 @@
 
 #include <boost/accumulators/statistics/count.hpp>
 
+#include <boost/range/iterator_range.hpp>
+
 namespace boost {
     namespace crypto3 {
         namespace accumulators {
@@ -65,6 +67,17 @@ namespace boost {
                 public:
                     typedef typename hash_type::digest_type result_type;
 
+                    /*!
+                     * @brief Everything a partially hashed stream is made of. Whatever has been hashed is
+                     * either absorbed into the construction state or kept in the cache.
+                     */
+                    struct checkpoint_type {
+                        bool filled;
+                        std::size_t total_seen;
+                        block_type cache;
+                        typename construction_type::state_type state;
+                    };
+
                     // The constructor takes an argument pack.
                     hash_impl(boost::accumulators::dont_care) : filled(false), total_seen(0) {
                     }
@@ -80,6 +93,21 @@ namespace boost {
                         return res.digest(cache, total_seen);
                     }
 
+                    inline checkpoint_type checkpoint() const {
+                        return {filled, total_seen, cache, construction.state()};
+                    }
+
+                    /*!
+                     * @brief Continues the stream a checkpoint was taken of, discarding whatever has been
+                     * hashed so far
+                     */
+                    inline void resume(const checkpoint_type &c) {
+                        filled = c.filled;
+                        total_seen = c.total_seen;
+                        cache = c.cache;
+                        construction.restore(c.state);
+                    }
+
                 protected:
                     inline void resolve_type(const block_type &value, std::size_t bits) {
                         // total_seen += bits == 0 ? block_bits : bits;
@@ -91,6 +119,36 @@ namespace boost {
                         process(value, bits == 0 ? word_bits : bits);
                     }
 
+                    inline void resolve_type(const boost::iterator_range<const block_type *> &blocks, std::size_t) {
+                        process_blocks(blocks.begin(), blocks.size());
+                    }
+
+                    inline void process_blocks(const block_type *blocks, std::size_t n) {
+                        if (!n) {
+                            return;
+                        }
+
+                        if (total_seen % block_bits) {
+                            // Blocks are not aligned with the cached bits, so they have to be injected one by one
+                            for (std::size_t i = 0; i != n; ++i) {
+                                process(blocks[i], block_bits);
+                            }
+                            return;
+                        }
+
+                        if (filled) {
+                            construction.process_block(cache, total_seen);
+                            filled = false;
+                        }
+
+                        // The last block is kept in the cache, since it may turn out to be the final one
+                        construction.process_blocks(blocks, n - 1, total_seen);
+                        total_seen += n * block_bits;
+
+                        std::copy(blocks[n - 1].begin(), blocks[n - 1].end(), cache.begin());
+                        filled = true;
+                    }
+
                     inline void process(const block_type &value, std::size_t value_seen) {
                         using namespace ::boost::crypto3::detail;
 
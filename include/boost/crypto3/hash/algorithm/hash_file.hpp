@@ -0,0 +1,292 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_FILE_HPP
+#define CRYPTO3_HASH_FILE_HPP
+
+#include <boost/predef/os.h>
+
+#include <boost/throw_exception.hpp>
+
+#include <boost/crypto3/detail/octet.hpp>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#if BOOST_OS_UNIX || BOOST_OS_MACOS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define CRYPTO3_HASH_HAS_FILE_API
+#endif
+
+#ifdef CRYPTO3_HASH_HAS_FILE_API
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Filled by hash_file and hash_fd
+             */
+            struct file_hash_stats {
+                /// Octets hashed
+                std::uint64_t bytes = 0;
+                /// Wall clock time spent reading and hashing
+                double seconds = 0;
+                /// Whether the input was memory-mapped rather than read into a buffer
+                bool mapped = false;
+
+                double bytes_per_second() const {
+                    return seconds > 0 ? double(bytes) / seconds : 0;
+                }
+            };
+
+            namespace detail {
+                /// Octets hashed per step, the size of a huge page on x86-64 and AArch64
+                constexpr static const std::size_t file_chunk_octets = std::size_t(2) << 20;
+
+                inline void throw_file_error(const char *what) {
+                    BOOST_THROW_EXCEPTION(std::system_error(errno, std::generic_category(), what));
+                }
+
+                /*!
+                 * @brief Hashes file descriptors in chunks of whole blocks, so the stream processor never
+                 * caches a partial block until the end of the input
+                 */
+                template<typename Hash>
+                struct file_hasher {
+                    typedef accumulator_set<Hash> accumulator_type;
+
+                    constexpr static const std::size_t block_octets =
+                        Hash::construction::type::block_bits / octet_bits;
+                    constexpr static const std::size_t chunk_octets =
+                        file_chunk_octets / block_octets * block_octets;
+
+                    /*!
+                     * @brief Maps a regular file of size octets and hashes it, advising the kernel to read
+                     * ahead of every chunk
+                     * @return false if the file can not be mapped, nothing is hashed then
+                     */
+                    static bool process_mapped(int fd, std::uint64_t size, accumulator_type &acc) {
+                        if (size > std::numeric_limits<std::size_t>::max()) {
+                            return false;
+                        }
+                        std::size_t n = static_cast<std::size_t>(size);
+
+                        void *p = ::mmap(nullptr, n, PROT_READ, MAP_PRIVATE, fd, 0);
+                        if (p == MAP_FAILED) {
+                            return false;
+                        }
+                        std::unique_ptr<void, mapping_deleter> mapping(p, mapping_deleter {n});
+
+                        // Advice is a hint, failures are of no consequence
+                        ::madvise(p, n, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+                        ::madvise(p, n, MADV_HUGEPAGE);
+#endif
+
+                        const std::uint8_t *first = static_cast<const std::uint8_t *>(p);
+                        const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+                        for (std::size_t offset = 0; offset < n; offset += chunk_octets) {
+                            std::size_t next = offset + chunk_octets;
+                            if (next < n) {
+                                std::size_t ahead = next / page * page;
+                                ::madvise(const_cast<std::uint8_t *>(first) + ahead,
+                                          std::min(std::size_t(chunk_octets), n - ahead), MADV_WILLNEED);
+                            }
+                            hash<Hash>(first + offset, first + std::min(next, n), acc);
+                        }
+                        return true;
+                    }
+
+                    /*!
+                     * @brief Reads the descriptor chunk by chunk with pread, or with read if it is not
+                     * seekable, until the end of the input
+                     * @return The amount of octets hashed
+                     */
+                    static std::uint64_t process_read(int fd, accumulator_type &acc) {
+#ifdef POSIX_FADV_SEQUENTIAL
+                        ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+                        std::unique_ptr<std::uint8_t[]> buffer(new std::uint8_t[chunk_octets]);
+
+                        std::uint64_t offset = 0;
+                        bool seekable = true, eof = false;
+                        while (!eof) {
+                            // Chunks are filled up before hashing, since reads may return less than asked
+                            std::size_t n = 0;
+                            while (n != chunk_octets) {
+                                ssize_t r = seekable ? ::pread(fd, buffer.get() + n, chunk_octets - n, offset) :
+                                                       ::read(fd, buffer.get() + n, chunk_octets - n);
+                                if (r < 0) {
+                                    if (errno == EINTR) {
+                                        continue;
+                                    }
+                                    if (seekable && errno == ESPIPE) {
+                                        seekable = false;
+                                        continue;
+                                    }
+                                    throw_file_error("read");
+                                }
+                                if (!r) {
+                                    eof = true;
+                                    break;
+                                }
+                                n += static_cast<std::size_t>(r);
+                                offset += static_cast<std::uint64_t>(r);
+                            }
+                            if (n) {
+                                hash<Hash>(buffer.get(), buffer.get() + n, acc);
+                            }
+                        }
+                        return offset;
+                    }
+
+                private:
+                    struct mapping_deleter {
+                        std::size_t size;
+
+                        void operator()(void *p) const {
+                            ::munmap(p, size);
+                        }
+                    };
+                };
+
+                /*!
+                 * @brief Closes the descriptor opened by hash_file on scope exit
+                 */
+                struct file_descriptor_guard {
+                    int fd;
+
+                    ~file_descriptor_guard() {
+                        ::close(fd);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+
+        /*!
+         * @brief Hashes everything a file descriptor refers to. Regular files are memory-mapped and
+         * hashed whole whatever the descriptor offset is, in chunks of about 2 MiB with sequential access
+         * and huge pages advised. Inputs which can not be mapped (pipes, sockets, procfs) are read with
+         * pread, or read if they are not seekable, into a buffer of the same size.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         *
+         * @param fd Descriptor open for reading, left open
+         * @param stats Receives the amount of octets hashed and the time spent
+         *
+         * @return Digest of the input
+         *
+         * @throws std::system_error if the input can not be read
+         */
+        template<typename Hash>
+        typename Hash::digest_type hash_fd(int fd, hashes::file_hash_stats &stats) {
+            typedef hashes::detail::file_hasher<Hash> file_hasher_type;
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            struct stat st;
+            if (::fstat(fd, &st) != 0) {
+                hashes::detail::throw_file_error("fstat");
+            }
+
+            typename file_hasher_type::accumulator_type acc;
+            // Empty regular files may still have contents, as procfs and sysfs ones do
+            stats.mapped = S_ISREG(st.st_mode) && st.st_size > 0 &&
+                           file_hasher_type::process_mapped(fd, static_cast<std::uint64_t>(st.st_size), acc);
+            stats.bytes =
+                stats.mapped ? static_cast<std::uint64_t>(st.st_size) : file_hasher_type::process_read(fd, acc);
+
+            typename Hash::digest_type d = accumulators::extract::hash<Hash>(acc);
+            stats.seconds =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            return d;
+        }
+
+        /*!
+         * @brief Hashes everything a file descriptor refers to
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         *
+         * @param fd Descriptor open for reading, left open
+         *
+         * @return Digest of the input
+         *
+         * @throws std::system_error if the input can not be read
+         */
+        template<typename Hash>
+        typename Hash::digest_type hash_fd(int fd) {
+            hashes::file_hash_stats stats;
+            return hash_fd<Hash>(fd, stats);
+        }
+
+        /*!
+         * @brief Hashes a file the same way as hash_fd does
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         *
+         * @param path File path
+         * @param stats Receives the amount of octets hashed and the time spent
+         *
+         * @return Digest of the file
+         *
+         * @throws std::system_error if the file can not be opened or read
+         */
+        template<typename Hash>
+        typename Hash::digest_type hash_file(const std::string &path, hashes::file_hash_stats &stats) {
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                hashes::detail::throw_file_error("open");
+            }
+            hashes::detail::file_descriptor_guard guard {fd};
+
+            return hash_fd<Hash>(fd, stats);
+        }
+
+        /*!
+         * @brief Hashes a file the same way as hash_fd does
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         *
+         * @param path File path
+         *
+         * @return Digest of the file
+         *
+         * @throws std::system_error if the file can not be opened or read
+         */
+        template<typename Hash>
+        typename Hash::digest_type hash_file(const std::string &path) {
+            hashes::file_hash_stats stats;
+            return hash_file<Hash>(path, stats);
+        }
+    }    // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_HAS_FILE_API
+
+#endif    // CRYPTO3_HASH_FILE_HPP
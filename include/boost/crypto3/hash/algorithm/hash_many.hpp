@@ -0,0 +1,203 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_MANY_HPP
+#define CRYPTO3_HASH_MANY_HPP
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+
+#include <boost/crypto3/hash/keccak.hpp>
+#include <boost/crypto3/hash/sha2.hpp>
+#include <boost/crypto3/hash/shake.hpp>
+#include <boost/crypto3/hash/detail/keccak/keccak_multi_buffer.hpp>
+#include <boost/crypto3/hash/detail/sha2/sha2_multi_buffer.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Sponge parameters of the hashes able to run on interleaved Keccak-f[1600] states
+                 */
+                template<typename Hash>
+                struct keccak_sponge_traits {
+                    constexpr static const bool value = false;
+                };
+
+                template<std::size_t DigestBits, std::size_t CapacityBits, std::uint8_t DomainSeparator>
+                struct basic_keccak_sponge_traits {
+                    constexpr static const bool value = true;
+                    constexpr static const std::size_t rate_bytes = (1600 - CapacityBits) / octet_bits;
+                    constexpr static const std::size_t digest_bytes = DigestBits / octet_bits;
+                    constexpr static const std::uint8_t domain_separator = DomainSeparator;
+                };
+
+                template<std::size_t DigestBits>
+                struct keccak_sponge_traits<sha3<DigestBits>>
+                    : public basic_keccak_sponge_traits<DigestBits, 2 * DigestBits,
+                                                        sha3_policy<DigestBits>::domain_separator> { };
+
+                template<std::size_t DigestBits>
+                struct keccak_sponge_traits<keccak_1600<DigestBits>>
+                    : public basic_keccak_sponge_traits<DigestBits, 2 * DigestBits,
+                                                        keccak_1600_policy<DigestBits>::domain_separator> { };
+
+                template<std::size_t Version>
+                struct keccak_sponge_traits<shake<Version>>
+                    : public basic_keccak_sponge_traits<shake_policy<Version>::digest_bits, 2 * Version,
+                                                        shake_policy<Version>::domain_separator> { };
+
+                template<typename Hash, typename InputIterator, typename OutputIterator>
+                OutputIterator hash_many_sequential(InputIterator first, InputIterator last, OutputIterator out) {
+                    for (; first != last; ++first, ++out) {
+                        *out = static_cast<typename Hash::digest_type>(::boost::crypto3::hash<Hash>(*first));
+                    }
+                    return out;
+                }
+
+                /*!
+                 * @brief Splits the messages into groups of MultiBuffer::lanes and hashes every group at once
+                 */
+                template<typename MultiBuffer, typename Hash, typename InputIterator, typename OutputIterator>
+                OutputIterator hash_many_interleaved(InputIterator first, InputIterator last, OutputIterator out) {
+                    while (first != last) {
+                        InputIterator group_last = first;
+                        for (std::size_t n = 0; n != MultiBuffer::lanes && group_last != last; ++n) {
+                            ++group_last;
+                        }
+                        out = MultiBuffer::template process_group<typename Hash::digest_type>(first, group_last, out);
+                        first = group_last;
+                    }
+                    return out;
+                }
+
+                /*!
+                 * @brief Picks the widest multi-buffer implementation available for Hash at runtime,
+                 * hashes lacking one are processed sequentially
+                 */
+                template<typename Hash, typename = void>
+                struct hash_many_dispatcher {
+                    template<typename InputIterator, typename OutputIterator>
+                    static OutputIterator process(InputIterator first, InputIterator last, OutputIterator out) {
+                        return hash_many_sequential<Hash>(first, last, out);
+                    }
+                };
+
+                template<typename Hash>
+                struct hash_many_dispatcher<Hash, typename std::enable_if<keccak_sponge_traits<Hash>::value>::type> {
+                    typedef keccak_sponge_traits<Hash> traits_type;
+
+                    template<typename Impl>
+                    using multi_buffer_type = keccak_1600_multi_buffer<Impl, traits_type::rate_bytes,
+                                                                       traits_type::digest_bytes,
+                                                                       traits_type::domain_separator>;
+
+                    template<typename InputIterator, typename OutputIterator>
+                    static OutputIterator process(InputIterator first, InputIterator last, OutputIterator out) {
+#ifdef CRYPTO3_HASH_HAS_KECCAK_MULTI_BUFFER
+                        if (keccak_1600_x8_avx512_impl::is_available()) {
+                            return hash_many_interleaved<multi_buffer_type<keccak_1600_x8_avx512_impl>, Hash>(
+                                first, last, out);
+                        }
+                        if (keccak_1600_x4_avx2_impl::is_available()) {
+                            return hash_many_interleaved<multi_buffer_type<keccak_1600_x4_avx2_impl>, Hash>(
+                                first, last, out);
+                        }
+#endif
+                        return hash_many_sequential<Hash>(first, last, out);
+                    }
+                };
+
+                template<std::size_t Version>
+                struct hash_many_dispatcher<sha2<Version>,
+                                            typename std::enable_if<Version == 224 || Version == 256>::type> {
+                    typedef sha2<Version> hash_type;
+
+                    template<typename Impl>
+                    using multi_buffer_type = sha256_multi_buffer<Impl, sha2_policy<Version>>;
+
+                    template<typename InputIterator, typename OutputIterator>
+                    static OutputIterator process(InputIterator first, InputIterator last, OutputIterator out) {
+#ifdef CRYPTO3_HASH_HAS_SHA2_MULTI_BUFFER
+                        if (sha256_x16_avx512_impl::is_available()) {
+                            return hash_many_interleaved<multi_buffer_type<sha256_x16_avx512_impl>, hash_type>(
+                                first, last, out);
+                        }
+                        // Single-lane SHA extensions outperform eight AVX2 lanes
+                        if (sha256_x8_avx2_impl::is_available() && !has_sha_extensions()) {
+                            return hash_many_interleaved<multi_buffer_type<sha256_x8_avx2_impl>, hash_type>(
+                                first, last, out);
+                        }
+#endif
+                        return hash_many_sequential<hash_type>(first, last, out);
+                    }
+
+                private:
+                    static bool has_sha_extensions() {
+#ifdef CRYPTO3_HASH_HAS_SHA_NI
+                        return sha256_ni_impl::is_available();
+#else
+                        return false;
+#endif
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+
+        /*!
+         * @brief Hashes a sequence of independent messages. Keccak-based hashes (SHA-3, Keccak,
+         * SHAKE) run 8 (AVX-512F) or 4 (AVX2) messages in lockstep through a SIMD permutation,
+         * SHA-224 and SHA-256 compress 16 (AVX-512F) or 8 (AVX2) messages at once. The width
+         * is chosen at runtime, other hashes and processors lacking these extensions hash the
+         * messages one after another with hash.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         * @tparam InputIterator Forward iterator over ranges of octets
+         * @tparam OutputIterator Output iterator accepting Hash::digest_type
+         *
+         * @param first Iterator to the first message
+         * @param last Iterator past the last message
+         * @param out Digests destination, written in the order of the messages
+         *
+         * @return Output iterator past the last written digest
+         */
+        template<typename Hash, typename InputIterator, typename OutputIterator>
+        OutputIterator hash_many(InputIterator first, InputIterator last, OutputIterator out) {
+            return hashes::detail::hash_many_dispatcher<Hash>::process(first, last, out);
+        }
+
+        /*!
+         * @brief Hashes a range of independent messages
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         * @tparam SinglePassRange Forward range of ranges of octets
+         * @tparam OutputIterator Output iterator accepting Hash::digest_type
+         *
+         * @param rng Messages
+         * @param out Digests destination, written in the order of the messages
+         *
+         * @return Output iterator past the last written digest
+         */
+        template<typename Hash, typename SinglePassRange, typename OutputIterator>
+        OutputIterator hash_many(const SinglePassRange &rng, OutputIterator out) {
+            return hash_many<Hash>(boost::begin(rng), boost::end(rng), out);
+        }
+    }    // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_MANY_HPP
@@ -13,6 +13,7 @@
 
 #include <boost/crypto3/hash/detail/blake2b/blake2b_functions.hpp>
 #include <boost/crypto3/hash/detail/blake2b/blake2b_padding.hpp>
+#include <boost/crypto3/hash/detail/blake2b/blake2b_simd_impl.hpp>
 
 #include <boost/crypto3/hash/detail/haifa_construction.hpp>
 #include <boost/crypto3/hash/detail/block_stream_processor.hpp>
@@ -45,25 +46,65 @@ namespace boost {
                 typedef typename policy_type::salt_type salt_type;
                 constexpr static const salt_type salt_value = policy_type::salt_value;
 
+                /*!
+                 * @brief Processes a block, seen is the amount of bits hashed including it. Tree
+                 * hashing modes set node_finalizator on the last block of the last node of a level.
+                 */
                 static void process_block(state_type &state, const block_type &block, value_type seen = value_type(),
-                                          value_type finalizator = value_type()) {
-                    std::array<word_type, state_words * 2> v;
+                                          value_type finalizator = value_type(),
+                                          value_type node_finalizator = value_type()) {
+                    compress(state, &block, 1, octets(seen), finalizator, node_finalizator);
+                }
 
-                    std::move(state.begin(), state.end(), v.begin());
-                    std::move(iv_generator()().begin(), iv_generator()().end(), v.begin() + state_words);
+                /*!
+                 * @brief Processes n consecutive non-final blocks, seen is the amount of bits hashed
+                 * before the first of them
+                 */
+                static void process_blocks(state_type &state, const block_type *blocks, std::size_t n,
+                                           value_type seen = value_type()) {
+                    compress(state, blocks, n, octets(seen + block_bits), value_type(), value_type());
+                }
 
-                    std::array<typename state_type::value_type, 2> s = {seen / CHAR_BIT + ((seen % CHAR_BIT) ? 1 : 0),
-                                                                        0x00};
+            protected:
+                static inline word_type octets(value_type seen) {
+                    return seen / CHAR_BIT + ((seen % CHAR_BIT) ? 1 : 0);
+                }
 
-                    v[12] ^= s[0];
-                    v[13] ^= s[1];
+                /*!
+                 * @brief Chooses the widest implementation available once for the whole run of blocks,
+                 * counter is the amount of octets hashed including the first block
+                 */
+                static void compress(state_type &state, const block_type *blocks, std::size_t n, word_type counter,
+                                     word_type finalizator, word_type node_finalizator) {
+#ifdef CRYPTO3_HASH_HAS_BLAKE2B_SIMD
+                    if (detail::blake2b_avx2_impl::is_available()) {
+                        detail::blake2b_avx2_impl::process_blocks(state, blocks, n, counter, finalizator,
+                                                                  node_finalizator, iv_generator()());
+                        return;
+                    }
+                    if (detail::blake2b_sse41_impl::is_available()) {
+                        detail::blake2b_sse41_impl::process_blocks(state, blocks, n, counter, finalizator,
+                                                                   node_finalizator, iv_generator()());
+                        return;
+                    }
+#endif
+                    for (const block_type *last = blocks + n; blocks != last;
+                         ++blocks, counter += block_bits / CHAR_BIT) {
+                        process_block_portable(state, *blocks, counter, finalizator, node_finalizator);
+                    }
+                }
 
-                    s = {finalizator, 0};
+                static void process_block_portable(state_type &state, const block_type &block, word_type counter,
+                                                   word_type finalizator, word_type node_finalizator) {
+                    const state_type &iv = iv_generator()();
+                    std::array<word_type, state_words * 2> v;
 
-                    v[14] ^= s[0];
-                    v[15] ^= s[1];
+                    std::copy(state.begin(), state.end(), v.begin());
+                    std::copy(iv.begin(), iv.end(), v.begin() + state_words);
 
-                    s.fill(0);
+                    v[12] ^= counter;
+                    v[14] ^= finalizator;
+                    v[15] ^= node_finalizator;
 
                     policy_type::template round<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15>(v, block);
                     policy_type::template round<14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3>(v, block);
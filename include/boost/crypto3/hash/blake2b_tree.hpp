@@ -0,0 +1,295 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_BLAKE2B_TREE_HPP
+#define CRYPTO3_HASH_BLAKE2B_TREE_HPP
+
+#include <boost/crypto3/hash/detail/blake2b/blake2b_tree_node.hpp>
+
+#include <boost/crypto3/detail/parallel_for.hpp>
+#include <boost/crypto3/detail/static_digest.hpp>
+#include <boost/crypto3/detail/type_traits.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Base of the parallel BLAKE2b modes, holds the thread count and
+                 * brings arbitrary input ranges to contiguous octets
+                 */
+                class blake2b_parallel_base {
+                public:
+                    /*!
+                     * @brief Amount of input octets worth starting another thread for
+                     */
+                    constexpr static const std::size_t min_octets_per_thread = 16384;
+
+                    explicit blake2b_parallel_base(std::size_t threads) :
+                        threads(threads ? threads : (std::max)(1U, std::thread::hardware_concurrency())) {
+                    }
+
+                    std::size_t thread_count() const {
+                        return threads;
+                    }
+
+                protected:
+                    std::size_t threads_for(std::size_t n) const {
+                        return (std::min)(threads, (std::max)(std::size_t(1), n / min_octets_per_thread));
+                    }
+
+                    template<typename InputIterator, typename Function>
+                    static void with_octets(InputIterator first, InputIterator last, const Function &fn) {
+                        typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+                        with_octets(first, last, fn,
+                                    std::integral_constant<bool,
+                                                           ::boost::crypto3::detail::is_contiguous_iterator<
+                                                               InputIterator>::value &&
+                                                               sizeof(value_type) == 1>());
+                    }
+
+                private:
+                    template<typename InputIterator, typename Function>
+                    static void with_octets(InputIterator first, InputIterator last, const Function &fn,
+                                            std::true_type) {
+                        std::size_t n = std::distance(first, last);
+                        fn(n ? reinterpret_cast<const octet_type *>(&*first) : nullptr, n);
+                    }
+
+                    template<typename InputIterator, typename Function>
+                    static void with_octets(InputIterator first, InputIterator last, const Function &fn,
+                                            std::false_type) {
+                        std::vector<octet_type> octets;
+                        for (; first != last; ++first) {
+                            octets.push_back(static_cast<octet_type>(*first));
+                        }
+                        fn(octets.data(), octets.size());
+                    }
+
+                    std::size_t threads;
+                };
+            }    // namespace detail
+
+            /*!
+             * @brief BLAKE2bp, four BLAKE2b leaves over interleaved 128-octet blocks combined by a
+             * root node. Leaves are hashed on up to four threads, the result does not depend on
+             * the thread count.
+             *
+             * @tparam DigestBits Digest length in bits, at most 512
+             * @ingroup hashes
+             *
+             * @code
+             * hashes::blake2bp<512> hasher;
+             * hashes::blake2bp<512>::digest_type d = hasher(message);
+             * @endcode
+             */
+            template<std::size_t DigestBits = 512>
+            class blake2bp : public detail::blake2b_parallel_base {
+                typedef detail::blake2b_tree_node node_type;
+
+            public:
+                constexpr static const std::size_t digest_bits = DigestBits;
+                typedef static_digest<digest_bits> digest_type;
+
+                constexpr static const std::size_t parallelism_degree = 4;
+
+                static_assert(DigestBits && DigestBits % octet_bits == 0 &&
+                                  DigestBits / octet_bits <= detail::blake2b_tree_params::max_digest_bytes,
+                              "BLAKE2bp digest length has to be between 1 and 64 octets");
+
+                /*!
+                 * @param threads Maximal amount of threads, 0 stands for the hardware concurrency
+                 */
+                explicit blake2bp(std::size_t threads = 0) : blake2b_parallel_base(threads) {
+                }
+
+                template<typename InputIterator>
+                digest_type operator()(InputIterator first, InputIterator last) const {
+                    digest_type d;
+                    with_octets(first, last,
+                                [this, &d](const octet_type *data, std::size_t n) { d = process(data, n); });
+                    return d;
+                }
+
+                template<typename SinglePassRange>
+                digest_type operator()(const SinglePassRange &r) const {
+                    return (*this)(boost::begin(r), boost::end(r));
+                }
+
+            private:
+                digest_type process(const octet_type *data, std::size_t n) const {
+                    constexpr static const detail::blake2b_tree_params params = {
+                        digest_bits / octet_bits, parallelism_degree, 2, 0,
+                        detail::blake2b_tree_params::max_digest_bytes};
+                    constexpr static const std::size_t block_bytes = node_type::block_bytes;
+                    constexpr static const std::size_t inner_bytes = params.inner_length;
+
+                    std::size_t blocks = (n + block_bytes - 1) / block_bytes;
+                    octet_type leaves[parallelism_degree * inner_bytes];
+
+                    ::boost::crypto3::detail::parallel_for(parallelism_degree, threads_for(n), [&](std::size_t i) {
+                        node_type leaf(params, i, 0);
+                        octet_type *out = leaves + i * inner_bytes;
+                        bool last_node = i == parallelism_degree - 1;
+
+                        if (blocks <= i) {
+                            leaf.finalize(nullptr, 0, last_node, inner_bytes, out);
+                            return;
+                        }
+
+                        // Leaf i takes every parallelism_degree-th block starting from the i-th
+                        std::size_t count = (blocks - 1 - i) / parallelism_degree + 1;
+                        std::size_t tail = (i + (count - 1) * parallelism_degree) * block_bytes;
+                        leaf.process_blocks(data + i * block_bytes, count - 1, parallelism_degree * block_bytes);
+                        leaf.finalize(data + tail, (std::min)(block_bytes, n - tail), last_node, inner_bytes, out);
+                    });
+
+                    digest_type d;
+                    node_type(params, 0, 1).process(leaves, sizeof(leaves), true, d.size(), d.begin());
+                    return d;
+                }
+            };
+
+            /*!
+             * @brief BLAKE2b tree hashing mode. The input is split into leaves of leaf_length octets,
+             * every fanout consecutive nodes of a level are combined by a node of the next one until a
+             * single root remains. The level depth - 1 combines all of its children at once, fanout 0
+             * or depth 255 stand for an unlimited fanout or depth. Depth 1 is sequential BLAKE2b,
+             * inner length is zero then as there are no inner nodes. Nodes of a level are hashed on
+             * a pool of threads, the result does not depend on the thread count.
+             *
+             * @tparam DigestBits Digest length in bits, at most 512
+             * @ingroup hashes
+             *
+             * @code
+             * hashes::blake2b_tree<512> hasher(4, 255, 65536);
+             * hashes::blake2b_tree<512>::digest_type d = hasher(message);
+             * @endcode
+             */
+            template<std::size_t DigestBits = 512>
+            class blake2b_tree : public detail::blake2b_parallel_base {
+                typedef detail::blake2b_tree_node node_type;
+
+            public:
+                constexpr static const std::size_t digest_bits = DigestBits;
+                typedef static_digest<digest_bits> digest_type;
+
+                constexpr static const std::size_t unlimited_depth = 255;
+
+                static_assert(DigestBits && DigestBits % octet_bits == 0 &&
+                                  DigestBits / octet_bits <= detail::blake2b_tree_params::max_digest_bytes,
+                              "BLAKE2b digest length has to be between 1 and 64 octets");
+
+                /*!
+                 * @param fanout Maximal amount of children of a node, 0 to 255
+                 * @param depth Maximal depth of the tree, 1 to 255
+                 * @param leaf_length Maximal leaf length in octets, 0 for unlimited
+                 * @param threads Maximal amount of threads, 0 stands for the hardware concurrency
+                 * @param inner_length Length of the chaining values passed to parent nodes, 1 to 64
+                 * @throws std::invalid_argument if a parameter is out of range, or if fanout 1 is combined
+                 * with an unlimited depth, as such a tree never reaches a root
+                 */
+                blake2b_tree(std::size_t fanout, std::size_t depth, std::uint32_t leaf_length,
+                             std::size_t threads = 0,
+                             std::size_t inner_length = detail::blake2b_tree_params::max_digest_bytes) :
+                    blake2b_parallel_base(threads),
+                    params {digest_bits / octet_bits, fanout, depth, leaf_length, depth == 1 ? 0 : inner_length} {
+                    if (fanout > 255) {
+                        throw std::invalid_argument("BLAKE2b tree fanout has to be at most 255");
+                    }
+                    if (depth < 1 || depth > 255) {
+                        throw std::invalid_argument("BLAKE2b tree depth has to be between 1 and 255");
+                    }
+                    if (inner_length < 1 || inner_length > detail::blake2b_tree_params::max_digest_bytes) {
+                        throw std::invalid_argument("BLAKE2b tree inner length has to be between 1 and 64 octets");
+                    }
+                    if (fanout == 1 && depth == unlimited_depth) {
+                        throw std::invalid_argument("BLAKE2b tree of fanout 1 has to be of limited depth");
+                    }
+                }
+
+                template<typename InputIterator>
+                digest_type operator()(InputIterator first, InputIterator last) const {
+                    digest_type d;
+                    with_octets(first, last,
+                                [this, &d](const octet_type *data, std::size_t n) { d = process(data, n); });
+                    return d;
+                }
+
+                template<typename SinglePassRange>
+                digest_type operator()(const SinglePassRange &r) const {
+                    return (*this)(boost::begin(r), boost::end(r));
+                }
+
+            private:
+                digest_type process(const octet_type *data, std::size_t n) const {
+                    digest_type d;
+
+                    if (params.depth == 1) {
+                        node_type(params, 0, 0).process(data, n, false, d.size(), d.begin());
+                        return d;
+                    }
+
+                    std::size_t leaf_length = params.leaf_length ? params.leaf_length : (std::max)(n, std::size_t(1));
+                    std::size_t count = (std::max)(std::size_t(1), (n + leaf_length - 1) / leaf_length);
+                    std::size_t threads = threads_for(n);
+                    std::vector<octet_type> level(count * params.inner_length);
+
+                    ::boost::crypto3::detail::parallel_for(count, threads, [&](std::size_t i) {
+                        std::size_t offset = (std::min)(i * leaf_length, n);
+                        node_type(params, i, 0).process(data + offset, (std::min)(leaf_length, n - offset),
+                                                        i == count - 1, params.inner_length,
+                                                        level.begin() + i * params.inner_length);
+                    });
+
+                    for (std::size_t depth = 1;; ++depth) {
+                        bool unlimited = !params.fanout ||
+                                         (params.depth != unlimited_depth && depth == params.depth - 1);
+                        std::size_t group = unlimited ? count : params.fanout;
+
+                        if (count <= group) {
+                            node_type(params, 0, depth).process(level.data(), level.size(), true, d.size(),
+                                                                d.begin());
+                            return d;
+                        }
+
+                        std::size_t parents = (count + group - 1) / group;
+                        std::size_t group_bytes = group * params.inner_length;
+                        std::vector<octet_type> next(parents * params.inner_length);
+
+                        ::boost::crypto3::detail::parallel_for(parents, threads, [&](std::size_t i) {
+                            std::size_t offset = i * group_bytes;
+                            node_type(params, i, depth)
+                                .process(level.data() + offset, (std::min)(group_bytes, level.size() - offset),
+                                         i == parents - 1, params.inner_length,
+                                         next.begin() + i * params.inner_length);
+                        });
+
+                        level.swap(next);
+                        count = parents;
+                    }
+                }
+
+                detail::blake2b_tree_params params;
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_BLAKE2B_TREE_HPP
@@ -13,6 +13,8 @@
 
 #include <boost/crypto3/hash/detail/blake2b/blake2b_policy.hpp>
 
+#include <boost/crypto3/detail/inject.hpp>
+
 namespace boost {
     namespace crypto3 {
         namespace hashes {
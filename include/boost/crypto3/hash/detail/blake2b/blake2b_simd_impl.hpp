@@ -0,0 +1,302 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_BLAKE2B_SIMD_IMPL_HPP
+#define CRYPTO3_HASH_BLAKE2B_SIMD_IMPL_HPP
+
+#include <boost/predef/architecture.h>
+
+#include <boost/crypto3/detail/config.hpp>
+
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_HASH_HAS_BLAKE2B_SIMD
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief BLAKE2b message schedule, row r lists the message words fed to the
+                 * column and diagonal steps of round r. A template only to be defined in a header.
+                 */
+                template<typename = void>
+                struct basic_blake2b_sigma {
+                    constexpr static const std::size_t rounds = 12;
+
+                    constexpr static const std::uint8_t value[rounds][16] = {
+                        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+                        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+                        {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+                        {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+                        {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+                        {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+                        {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+                        {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+                        {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+                        {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+                        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+                        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+                };
+
+                template<typename T>
+                constexpr const std::uint8_t basic_blake2b_sigma<T>::value[basic_blake2b_sigma<T>::rounds][16];
+
+                typedef basic_blake2b_sigma<> blake2b_sigma;
+
+#ifdef CRYPTO3_HASH_HAS_BLAKE2B_SIMD
+                /*!
+                 * @brief BLAKE2b compression function with the four rows of the working state held
+                 * in AVX2 registers, so that each half-round computes all four G functions at once.
+                 * Diagonal steps rotate the rows in place instead of gathering the diagonals.
+                 */
+                struct blake2b_avx2_impl {
+                    typedef std::array<std::uint64_t, 8> state_type;
+                    typedef std::array<std::uint64_t, 16> block_type;
+
+                    static bool is_available() {
+                        return cpuid::has_avx2();
+                    }
+
+                    /*!
+                     * @brief Compresses n consecutive blocks, counter is the amount of octets
+                     * hashed including the first block and grows by a block for the following ones.
+                     * Finalization flags f0 and f1 mark the last block and the last node of a tree.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static void process_blocks(state_type &state, const block_type *blocks, std::size_t n,
+                                               std::uint64_t counter, std::uint64_t f0, std::uint64_t f1,
+                                               const state_type &iv) {
+                        const __m256i iv_low = load(iv.data()), iv_high = load(iv.data() + 4);
+                        __m256i h_low = load(state.data()), h_high = load(state.data() + 4);
+
+                        for (const block_type *last = blocks + n; blocks != last; ++blocks, counter += 128) {
+                            const std::uint64_t *m = blocks->data();
+
+                            __m256i a = h_low, b = h_high, c = iv_low;
+                            __m256i d = _mm256_xor_si256(
+                                iv_high, _mm256_set_epi64x(static_cast<long long>(f1), static_cast<long long>(f0), 0,
+                                                           static_cast<long long>(counter)));
+
+                            round<0>(a, b, c, d, m);
+                            round<1>(a, b, c, d, m);
+                            round<2>(a, b, c, d, m);
+                            round<3>(a, b, c, d, m);
+                            round<4>(a, b, c, d, m);
+                            round<5>(a, b, c, d, m);
+                            round<6>(a, b, c, d, m);
+                            round<7>(a, b, c, d, m);
+                            round<8>(a, b, c, d, m);
+                            round<9>(a, b, c, d, m);
+                            round<10>(a, b, c, d, m);
+                            round<11>(a, b, c, d, m);
+
+                            h_low = _mm256_xor_si256(h_low, _mm256_xor_si256(a, c));
+                            h_high = _mm256_xor_si256(h_high, _mm256_xor_si256(b, d));
+                        }
+
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state.data()), h_low);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state.data() + 4), h_high);
+                    }
+
+                private:
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    BOOST_FORCEINLINE static __m256i load(const std::uint64_t *p) {
+                        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                    }
+
+                    /// Gathers message words sigma[R][I], sigma[R][I + 2], sigma[R][I + 4], sigma[R][I + 6]
+                    template<std::size_t R, std::size_t I>
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    BOOST_FORCEINLINE static __m256i gather(const std::uint64_t *m) {
+                        return _mm256_set_epi64x(static_cast<long long>(m[blake2b_sigma::value[R][I + 6]]),
+                                                 static_cast<long long>(m[blake2b_sigma::value[R][I + 4]]),
+                                                 static_cast<long long>(m[blake2b_sigma::value[R][I + 2]]),
+                                                 static_cast<long long>(m[blake2b_sigma::value[R][I]]));
+                    }
+
+                    template<std::size_t R>
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    BOOST_FORCEINLINE static void round(__m256i &a, __m256i &b, __m256i &c, __m256i &d,
+                                                         const std::uint64_t *m) {
+                        g(a, b, c, d, gather<R, 0>(m), gather<R, 1>(m));
+
+                        b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+                        c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+                        d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));
+
+                        g(a, b, c, d, gather<R, 8>(m), gather<R, 9>(m));
+
+                        b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));
+                        c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+                        d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    BOOST_FORCEINLINE static void g(__m256i &a, __m256i &b, __m256i &c, __m256i &d, __m256i m0,
+                                                     __m256i m1) {
+                        const __m256i rotr24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                                                3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+                        const __m256i rotr16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                                                2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+
+                        a = _mm256_add_epi64(_mm256_add_epi64(a, b), m0);
+                        d = _mm256_shuffle_epi32(_mm256_xor_si256(d, a), _MM_SHUFFLE(2, 3, 0, 1));
+                        c = _mm256_add_epi64(c, d);
+                        b = _mm256_shuffle_epi8(_mm256_xor_si256(b, c), rotr24);
+                        a = _mm256_add_epi64(_mm256_add_epi64(a, b), m1);
+                        d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotr16);
+                        c = _mm256_add_epi64(c, d);
+                        b = _mm256_xor_si256(b, c);
+                        b = _mm256_xor_si256(_mm256_srli_epi64(b, 63), _mm256_add_epi64(b, b));
+                    }
+                };
+
+                /*!
+                 * @brief BLAKE2b compression function with every row of the working state split
+                 * into two SSE registers, diagonal steps realign the halves with palignr.
+                 */
+                struct blake2b_sse41_impl {
+                    typedef std::array<std::uint64_t, 8> state_type;
+                    typedef std::array<std::uint64_t, 16> block_type;
+
+                    static bool is_available() {
+                        return cpuid::has_sse41() && cpuid::has_ssse3();
+                    }
+
+                    /*!
+                     * @brief Compresses n consecutive blocks, counter is the amount of octets
+                     * hashed including the first block and grows by a block for the following ones.
+                     * Finalization flags f0 and f1 mark the last block and the last node of a tree.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("sse4.1,ssse3")
+                    static void process_blocks(state_type &state, const block_type *blocks, std::size_t n,
+                                               std::uint64_t counter, std::uint64_t f0, std::uint64_t f1,
+                                               const state_type &iv) {
+                        __m128i h[4];
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            h[i] = load(state.data() + 2 * i);
+                        }
+
+                        for (const block_type *last = blocks + n; blocks != last; ++blocks, counter += 128) {
+                            const std::uint64_t *m = blocks->data();
+
+                            __m128i a0 = h[0], a1 = h[1], b0 = h[2], b1 = h[3];
+                            __m128i c0 = load(iv.data()), c1 = load(iv.data() + 2);
+                            __m128i d0 = _mm_xor_si128(load(iv.data() + 4),
+                                                       _mm_set_epi64x(0, static_cast<long long>(counter)));
+                            __m128i d1 = _mm_xor_si128(load(iv.data() + 6),
+                                                       _mm_set_epi64x(static_cast<long long>(f1),
+                                                                      static_cast<long long>(f0)));
+
+                            round<0>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<1>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<2>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<3>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<4>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<5>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<6>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<7>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<8>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<9>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<10>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+                            round<11>(a0, a1, b0, b1, c0, c1, d0, d1, m);
+
+                            h[0] = _mm_xor_si128(h[0], _mm_xor_si128(a0, c0));
+                            h[1] = _mm_xor_si128(h[1], _mm_xor_si128(a1, c1));
+                            h[2] = _mm_xor_si128(h[2], _mm_xor_si128(b0, d0));
+                            h[3] = _mm_xor_si128(h[3], _mm_xor_si128(b1, d1));
+                        }
+
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data() + 2 * i), h[i]);
+                        }
+                    }
+
+                private:
+                    BOOST_ATTRIBUTE_TARGET("sse4.1,ssse3")
+                    BOOST_FORCEINLINE static __m128i load(const std::uint64_t *p) {
+                        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                    }
+
+                    /// Gathers message words sigma[R][I] and sigma[R][I + 2]
+                    template<std::size_t R, std::size_t I>
+                    BOOST_ATTRIBUTE_TARGET("sse4.1,ssse3")
+                    BOOST_FORCEINLINE static __m128i gather(const std::uint64_t *m) {
+                        return _mm_set_epi64x(static_cast<long long>(m[blake2b_sigma::value[R][I + 2]]),
+                                              static_cast<long long>(m[blake2b_sigma::value[R][I]]));
+                    }
+
+                    template<std::size_t R>
+                    BOOST_ATTRIBUTE_TARGET("sse4.1,ssse3")
+                    BOOST_FORCEINLINE static void round(__m128i &a0, __m128i &a1, __m128i &b0, __m128i &b1, __m128i &c0,
+                                                         __m128i &c1, __m128i &d0, __m128i &d1, const std::uint64_t *m) {
+                        __m128i t0, t1;
+
+                        g(a0, b0, c0, d0, gather<R, 0>(m), gather<R, 1>(m));
+                        g(a1, b1, c1, d1, gather<R, 4>(m), gather<R, 5>(m));
+
+                        t0 = _mm_alignr_epi8(b1, b0, 8);
+                        t1 = _mm_alignr_epi8(b0, b1, 8);
+                        b0 = t0;
+                        b1 = t1;
+                        t0 = c0;
+                        c0 = c1;
+                        c1 = t0;
+                        t0 = _mm_alignr_epi8(d1, d0, 8);
+                        t1 = _mm_alignr_epi8(d0, d1, 8);
+                        d0 = t1;
+                        d1 = t0;
+
+                        g(a0, b0, c0, d0, gather<R, 8>(m), gather<R, 9>(m));
+                        g(a1, b1, c1, d1, gather<R, 12>(m), gather<R, 13>(m));
+
+                        t0 = _mm_alignr_epi8(b0, b1, 8);
+                        t1 = _mm_alignr_epi8(b1, b0, 8);
+                        b0 = t0;
+                        b1 = t1;
+                        t0 = c0;
+                        c0 = c1;
+                        c1 = t0;
+                        t0 = _mm_alignr_epi8(d0, d1, 8);
+                        t1 = _mm_alignr_epi8(d1, d0, 8);
+                        d0 = t1;
+                        d1 = t0;
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sse4.1,ssse3")
+                    BOOST_FORCEINLINE static void g(__m128i &a, __m128i &b, __m128i &c, __m128i &d, __m128i m0,
+                                                     __m128i m1) {
+                        const __m128i rotr24 = _mm_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+                        const __m128i rotr16 = _mm_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+
+                        a = _mm_add_epi64(_mm_add_epi64(a, b), m0);
+                        d = _mm_shuffle_epi32(_mm_xor_si128(d, a), _MM_SHUFFLE(2, 3, 0, 1));
+                        c = _mm_add_epi64(c, d);
+                        b = _mm_shuffle_epi8(_mm_xor_si128(b, c), rotr24);
+                        a = _mm_add_epi64(_mm_add_epi64(a, b), m1);
+                        d = _mm_shuffle_epi8(_mm_xor_si128(d, a), rotr16);
+                        c = _mm_add_epi64(c, d);
+                        b = _mm_xor_si128(b, c);
+                        b = _mm_xor_si128(_mm_srli_epi64(b, 63), _mm_add_epi64(b, b));
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_BLAKE2B_SIMD_IMPL_HPP
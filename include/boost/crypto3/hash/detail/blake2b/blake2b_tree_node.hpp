@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLAKE2B_TREE_NODE_HPP
+#define CRYPTO3_BLAKE2B_TREE_NODE_HPP
+
+#include <boost/crypto3/hash/blake2b.hpp>
+
+#include <boost/endian/conversion.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief BLAKE2b parameter block fields shared by all the nodes of a tree
+                 */
+                struct blake2b_tree_params {
+                    constexpr static const std::size_t max_digest_bytes = 64;
+
+                    std::size_t digest_bytes;
+                    std::size_t fanout;
+                    std::size_t depth;
+                    std::uint32_t leaf_length;
+                    std::size_t inner_length;
+                };
+
+                /*!
+                 * @brief Single node of a BLAKE2b tree. The whole node input is known in advance,
+                 * full blocks may be laid out with a stride to serve the interleaved BLAKE2bp leaves.
+                 */
+                class blake2b_tree_node {
+                    typedef blake2b_compressor<512> compressor_type;
+
+                    typedef typename compressor_type::word_type word_type;
+                    typedef typename compressor_type::state_type state_type;
+                    typedef typename compressor_type::block_type block_type;
+
+                    constexpr static const std::size_t word_bytes = compressor_type::word_bits / octet_bits;
+                    constexpr static const std::size_t batch_blocks = 8;
+
+                public:
+                    constexpr static const std::size_t block_bytes = compressor_type::block_bits / octet_bits;
+
+                    blake2b_tree_node(const blake2b_tree_params &params, std::uint64_t node_offset,
+                                      std::size_t node_depth) :
+                        state(typename compressor_type::iv_generator()()),
+                        seen(0) {
+                        state[0] ^= word_type(params.digest_bytes) | word_type(params.fanout) << 16 |
+                                    word_type(params.depth) << 24 | word_type(params.leaf_length) << 32;
+                        state[1] ^= node_offset;
+                        state[2] ^= word_type(node_depth) | word_type(params.inner_length) << 8;
+                    }
+
+                    /*!
+                     * @brief Compresses n full blocks, each following the previous one stride octets apart.
+                     * None of them may be the last block of the node.
+                     */
+                    void process_blocks(const octet_type *first, std::size_t n, std::size_t stride) {
+                        block_type blocks[batch_blocks];
+
+                        while (n) {
+                            std::size_t count = n < batch_blocks ? n : batch_blocks;
+                            for (std::size_t i = 0; i != count; ++i, first += stride) {
+                                load_block(blocks[i], first, block_bytes);
+                            }
+
+                            compressor_type::process_blocks(state, blocks, count, seen * octet_bits);
+                            seen += count * block_bytes;
+                            n -= count;
+                        }
+                    }
+
+                    /*!
+                     * @brief Compresses the last, possibly partial or empty block and writes
+                     * digest_bytes octets of the chaining value
+                     */
+                    template<typename OutputIterator>
+                    OutputIterator finalize(const octet_type *tail, std::size_t n, bool last_node,
+                                            std::size_t digest_bytes, OutputIterator out) {
+                        BOOST_ASSERT(n <= block_bytes);
+
+                        block_type block;
+                        load_block(block, tail, n);
+                        seen += n;
+                        compressor_type::process_block(state, block, seen * octet_bits, ~word_type(),
+                                                       last_node ? ~word_type() : word_type());
+
+                        for (std::size_t i = 0; i != digest_bytes; ++i) {
+                            *out++ = static_cast<octet_type>(state[i / word_bytes] >> ((i % word_bytes) * octet_bits));
+                        }
+                        return out;
+                    }
+
+                    /*!
+                     * @brief Hashes n contiguous octets as a single node
+                     */
+                    template<typename OutputIterator>
+                    OutputIterator process(const octet_type *first, std::size_t n, bool last_node,
+                                           std::size_t digest_bytes, OutputIterator out) {
+                        std::size_t blocks = n ? (n - 1) / block_bytes : 0;
+                        process_blocks(first, blocks, block_bytes);
+                        return finalize(first + blocks * block_bytes, n - blocks * block_bytes, last_node,
+                                        digest_bytes, out);
+                    }
+
+                private:
+                    static inline void load_block(block_type &block, const octet_type *p, std::size_t n) {
+                        if (n == block_bytes) {
+                            std::memcpy(block.data(), p, block_bytes);
+                        } else {
+                            block.fill(0);
+                            if (n) {
+                                std::memcpy(block.data(), p, n);
+                            }
+                        }
+                        for (word_type &w : block) {
+                            boost::endian::little_to_native_inplace(w);
+                        }
+                    }
+
+                    state_type state;
+                    std::uint64_t seen;
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_BLAKE2B_TREE_NODE_HPP
@@ -10,15 +10,21 @@
 #ifndef CRYPTO3_HASH_BLOCK_STREAM_PROCESSOR_HPP
 #define CRYPTO3_HASH_BLOCK_STREAM_PROCESSOR_HPP
 
+#include <algorithm>
 #include <array>
+#include <climits>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 
 #include <boost/crypto3/detail/pack.hpp>
+#include <boost/crypto3/detail/type_traits.hpp>
 
 #include <boost/crypto3/hash/accumulators/bits_count.hpp>
 #include <boost/crypto3/hash/accumulators/parameters/bits.hpp>
 
 #include <boost/integer.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/utility/enable_if.hpp>
 
@@ -56,6 +62,9 @@ namespace boost {
                 constexpr static const std::size_t block_values = block_bits / value_bits;
                 typedef std::array<value_type, block_values> cache_type;
 
+                /// Amount of blocks packed from the contiguous input before they are handed over to the accumulator
+                constexpr static const std::size_t batch_blocks = 8;
+
             protected:
                 BOOST_STATIC_ASSERT(block_bits % value_bits == 0);
 
@@ -68,6 +77,52 @@ namespace boost {
                     acc(block, accumulators::bits = block_seen);
                 }
 
+                template<typename ValueType>
+                inline void process_blocks(const ValueType *first, std::size_t n) {
+                    using namespace boost::crypto3::detail;
+                    // Convert the input into words straight from the caller's buffer
+                    std::array<block_type, batch_blocks> blocks;
+                    for (std::size_t i = 0; i != n; ++i, first += block_values) {
+                        pack_to<endian_type, value_bits, word_bits>(first, first + block_values, blocks[i].begin());
+                    }
+                    // Process the blocks
+                    acc(boost::make_iterator_range<const block_type *>(blocks.data(), blocks.data() + n),
+                        accumulators::bits = n * block_bits);
+                }
+
+                template<typename InputIterator>
+                inline void update_n(InputIterator p, std::size_t n, std::true_type) {
+                    if (!n) {
+                        return;
+                    }
+
+                    const auto *first = std::addressof(*p);
+
+                    // Top up the partially filled cache first
+                    for (; n && cache_seen; --n) {
+                        update_one(*first++);
+                    }
+
+                    // Full blocks bypass the cache and are handed over in batches
+                    while (n >= block_values) {
+                        std::size_t blocks_n = std::min(n / block_values, std::size_t(batch_blocks));
+                        process_blocks(first, blocks_n);
+                        first += blocks_n * block_values;
+                        n -= blocks_n * block_values;
+                    }
+
+                    for (; n; --n) {
+                        cache[cache_seen++] = *first++;
+                    }
+                }
+
+                template<typename InputIterator>
+                inline void update_n(InputIterator p, std::size_t n, std::false_type) {
+                    for (; n; --n) {
+                        update_one(*p++);
+                    }
+                }
+
             public:
                 inline void update_one(value_type value) {
                     cache[cache_seen] = value;
@@ -81,9 +136,13 @@ namespace boost {
 
                 template<typename InputIterator>
                 inline void update_n(InputIterator p, size_t n) {
-                    for (; n; --n) {
-                        update_one(*p++);
-                    }
+                    typedef ::boost::crypto3::detail::is_contiguous_iterator<InputIterator> is_contiguous;
+                    typedef typename std::iterator_traits<InputIterator>::value_type input_value_type;
+
+                    // Values narrower than their storage (e.g. bits stored as bool) still go through the cache
+                    update_n(p, n,
+                             std::integral_constant<bool, is_contiguous::value &&
+                                                              sizeof(input_value_type) * CHAR_BIT == value_bits>());
                 }
 
                 template<typename InputIterator>
@@ -121,7 +180,7 @@ namespace boost {
                 }
 
                 virtual ~block_stream_processor() {
-                    if (!cache.empty()) {
+                    if (cache_seen) {
                         process_block(cache_seen * value_bits);
                         cache_seen = 0;
                     }
@@ -0,0 +1,55 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_COMPRESSOR_TRAITS_HPP
+#define CRYPTO3_HASH_COMPRESSOR_TRAITS_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief has_process_blocks trait checks whether the compressor is able to process
+                 * several consecutive blocks with a single call, i.e. provides
+                 * process_blocks(state_type &, const block_type *, std::size_t, Args...) static function.
+                 * Constructions use it to let the compressor keep the state in registers across
+                 * blocks or to schedule several blocks at once, and fall back to a process_block
+                 * loop otherwise.
+                 *
+                 * @tparam Compressor
+                 * @tparam Args Additional arguments, e.g. the bit counter for HAIFA compressors
+                 */
+                template<typename Compressor, typename... Args>
+                struct has_process_blocks {
+                private:
+                    typedef typename Compressor::state_type state_type;
+                    typedef typename Compressor::block_type block_type;
+
+                    template<typename C>
+                    static auto test(int) -> decltype(C::process_blocks(std::declval<state_type &>(),
+                                                                        std::declval<const block_type *>(),
+                                                                        std::declval<std::size_t>(),
+                                                                        std::declval<Args>()...),
+                                                      std::true_type());
+
+                    template<typename C>
+                    static std::false_type test(...);
+
+                public:
+                    constexpr static const bool value = decltype(test<Compressor>(0))::value;
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_COMPRESSOR_TRAITS_HPP
@@ -11,6 +11,7 @@
 #define CRYPTO3_HASH_HAIFA_CONSTRUCTION_HPP
 
 #include <boost/crypto3/hash/detail/nop_finalizer.hpp>
+#include <boost/crypto3/hash/detail/compressor_traits.hpp>
 
 #include <boost/crypto3/detail/static_digest.hpp>
 #include <boost/crypto3/detail/pack.hpp>
@@ -84,16 +85,28 @@ namespace boost {
                     return *this;
                 }
 
+                /*!
+                 * @brief Processes n consecutive non-final blocks. As opposed to process_block,
+                 * seen is the amount of bits hashed before the first of the blocks, the counter
+                 * for each block is derived from it.
+                 */
+                template<typename Integer = std::size_t>
+                inline haifa_construction &process_blocks(const block_type *blocks, std::size_t n,
+                                                          Integer seen = Integer()) {
+                    process_blocks(
+                        blocks, n, seen,
+                        std::integral_constant<bool, detail::has_process_blocks<compressor_functor, Integer>::value>());
+                    return *this;
+                }
+
                 inline digest_type digest(const block_type &block = block_type(),
                                           std::size_t total_seen = length_type()) {
                     using namespace boost::crypto3::detail;
 
                     block_type b = block;
-                    // Process block if it is full
-                    if (total_seen && !(total_seen % block_bits))
-                        process_block(b, total_seen);
 
-                    // Pad last message block
+                    // Pad last message block. A full last block is left intact, since it has to be
+                    // processed with the finalization flag set
                     padding_functor padding;
                     padding(b, total_seen);
 
@@ -130,7 +143,28 @@ namespace boost {
                     return state_;
                 }
 
+                /*!
+                 * @brief Sets the chaining state of a partially processed message, as returned by state().
+                 * As opposed to reset, the parameter block is not mixed in again.
+                 */
+                void restore(state_type const &s) {
+                    state_ = s;
+                }
+
             private:
+                template<typename Integer>
+                inline void process_blocks(const block_type *blocks, std::size_t n, Integer seen, std::true_type) {
+                    compressor_functor::process_blocks(state_, blocks, n, seen);
+                }
+
+                template<typename Integer>
+                inline void process_blocks(const block_type *blocks, std::size_t n, Integer seen, std::false_type) {
+                    for (const block_type *last = blocks + n; blocks != last; ++blocks) {
+                        seen += block_bits;
+                        compressor_functor::process_block(state_, *blocks, seen, Integer());
+                    }
+                }
+
                 state_type state_;
             };
 
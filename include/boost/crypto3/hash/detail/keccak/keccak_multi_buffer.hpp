@@ -0,0 +1,281 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_KECCAK_MULTI_BUFFER_HPP
+#define CRYPTO3_HASH_KECCAK_MULTI_BUFFER_HPP
+
+#include <boost/predef/architecture.h>
+
+#include <boost/crypto3/detail/config.hpp>
+#include <boost/crypto3/detail/octet.hpp>
+
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_HASH_HAS_KECCAK_MULTI_BUFFER
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Keccak-f[1600] permutation constants shared by the interleaved implementations.
+                 */
+                struct keccak_1600_constants {
+                    constexpr static const std::size_t rounds = 24;
+                    constexpr static const std::size_t state_words = 25;
+
+                    static const std::uint64_t *round_constants() {
+                        static const std::uint64_t rc[rounds] = {
+                            UINT64_C(0x0000000000000001), UINT64_C(0x0000000000008082), UINT64_C(0x800000000000808a),
+                            UINT64_C(0x8000000080008000), UINT64_C(0x000000000000808b), UINT64_C(0x0000000080000001),
+                            UINT64_C(0x8000000080008081), UINT64_C(0x8000000000008009), UINT64_C(0x000000000000008a),
+                            UINT64_C(0x0000000000000088), UINT64_C(0x0000000080008009), UINT64_C(0x000000008000000a),
+                            UINT64_C(0x000000008000808b), UINT64_C(0x800000000000008b), UINT64_C(0x8000000000008089),
+                            UINT64_C(0x8000000000008003), UINT64_C(0x8000000000008002), UINT64_C(0x8000000000000080),
+                            UINT64_C(0x000000000000800a), UINT64_C(0x800000008000000a), UINT64_C(0x8000000080008081),
+                            UINT64_C(0x8000000000008080), UINT64_C(0x0000000080000001), UINT64_C(0x8000000080008008)};
+                        return rc;
+                    }
+
+                    /// Rotation offsets of the lane x + 5 * y
+                    static const unsigned *rotations() {
+                        static const unsigned r[state_words] = {0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+                                                                25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14};
+                        return r;
+                    }
+
+                    /// Destination of the lane x + 5 * y after pi, i.e. y + 5 * ((2 * x + 3 * y) % 5)
+                    static const unsigned *permutation() {
+                        static const unsigned p[state_words] = {0,  10, 20, 5,  15, 16, 1,  11, 21, 6,  7,  17, 2,
+                                                                12, 22, 23, 8,  18, 3,  13, 14, 24, 9,  19, 4};
+                        return p;
+                    }
+                };
+
+#ifdef CRYPTO3_HASH_HAS_KECCAK_MULTI_BUFFER
+                /*!
+                 * @brief Four independent Keccak-f[1600] states permuted in lockstep with AVX2, lane i
+                 * of every state is kept in the i-th row of the interleaved state.
+                 */
+                struct keccak_1600_x4_avx2_impl {
+                    constexpr static const std::size_t lanes = 4;
+                    typedef std::array<std::array<std::uint64_t, lanes>, keccak_1600_constants::state_words>
+                        state_type;
+
+                    static bool is_available() {
+                        return cpuid::has_avx2();
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static void permute(state_type &state) {
+                        const std::uint64_t *rc = keccak_1600_constants::round_constants();
+                        const unsigned *rho = keccak_1600_constants::rotations();
+                        const unsigned *pi = keccak_1600_constants::permutation();
+
+                        __m256i A[25], B[25], C[5], D[5];
+                        for (std::size_t i = 0; i != 25; ++i) {
+                            A[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[i].data()));
+                        }
+
+                        for (std::size_t round = 0; round != keccak_1600_constants::rounds; ++round) {
+                            for (std::size_t x = 0; x != 5; ++x) {
+                                C[x] = _mm256_xor_si256(_mm256_xor_si256(A[x], A[x + 5]),
+                                                        _mm256_xor_si256(_mm256_xor_si256(A[x + 10], A[x + 15]), A[x + 20]));
+                            }
+                            for (std::size_t x = 0; x != 5; ++x) {
+                                D[x] = _mm256_xor_si256(C[(x + 4) % 5], rotl(C[(x + 1) % 5], 1));
+                            }
+                            for (std::size_t i = 0; i != 25; ++i) {
+                                B[pi[i]] = rotl(_mm256_xor_si256(A[i], D[i % 5]), rho[i]);
+                            }
+                            for (std::size_t y = 0; y != 25; y += 5) {
+                                for (std::size_t x = 0; x != 5; ++x) {
+                                    A[y + x] = _mm256_xor_si256(
+                                        B[y + x], _mm256_andnot_si256(B[y + (x + 1) % 5], B[y + (x + 2) % 5]));
+                                }
+                            }
+                            A[0] = _mm256_xor_si256(A[0], _mm256_set1_epi64x(static_cast<long long>(rc[round])));
+                        }
+
+                        for (std::size_t i = 0; i != 25; ++i) {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[i].data()), A[i]);
+                        }
+                    }
+
+                private:
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i rotl(__m256i x, unsigned n) {
+                        return _mm256_or_si256(_mm256_sll_epi64(x, _mm_cvtsi32_si128(n)),
+                                               _mm256_srl_epi64(x, _mm_cvtsi32_si128(64 - n)));
+                    }
+                };
+
+                /*!
+                 * @brief Eight independent Keccak-f[1600] states permuted in lockstep with AVX-512F.
+                 */
+                struct keccak_1600_x8_avx512_impl {
+                    constexpr static const std::size_t lanes = 8;
+                    typedef std::array<std::array<std::uint64_t, lanes>, keccak_1600_constants::state_words>
+                        state_type;
+
+                    static bool is_available() {
+                        return cpuid::has_avx512f();
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static void permute(state_type &state) {
+                        const std::uint64_t *rc = keccak_1600_constants::round_constants();
+                        const unsigned *rho = keccak_1600_constants::rotations();
+                        const unsigned *pi = keccak_1600_constants::permutation();
+
+                        __m512i A[25], B[25], C[5], D[5];
+                        for (std::size_t i = 0; i != 25; ++i) {
+                            A[i] = _mm512_loadu_si512(state[i].data());
+                        }
+
+                        for (std::size_t round = 0; round != keccak_1600_constants::rounds; ++round) {
+                            for (std::size_t x = 0; x != 5; ++x) {
+                                // A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20]
+                                C[x] = _mm512_ternarylogic_epi64(
+                                    _mm512_ternarylogic_epi64(A[x], A[x + 5], A[x + 10], 0x96), A[x + 15], A[x + 20],
+                                    0x96);
+                            }
+                            for (std::size_t x = 0; x != 5; ++x) {
+                                D[x] = _mm512_xor_si512(C[(x + 4) % 5],
+                                                        _mm512_rolv_epi64(C[(x + 1) % 5], _mm512_set1_epi64(1)));
+                            }
+                            for (std::size_t i = 0; i != 25; ++i) {
+                                B[pi[i]] = _mm512_rolv_epi64(_mm512_xor_si512(A[i], D[i % 5]),
+                                                             _mm512_set1_epi64(static_cast<long long>(rho[i])));
+                            }
+                            for (std::size_t y = 0; y != 25; y += 5) {
+                                for (std::size_t x = 0; x != 5; ++x) {
+                                    // B[x] ^ (~B[x + 1] & B[x + 2])
+                                    A[y + x] = _mm512_ternarylogic_epi64(B[y + x], B[y + (x + 1) % 5],
+                                                                         B[y + (x + 2) % 5], 0xD2);
+                                }
+                            }
+                            A[0] = _mm512_xor_si512(A[0], _mm512_set1_epi64(static_cast<long long>(rc[round])));
+                        }
+
+                        for (std::size_t i = 0; i != 25; ++i) {
+                            _mm512_storeu_si512(state[i].data(), A[i]);
+                        }
+                    }
+                };
+#endif
+
+                /*!
+                 * @brief Hashes groups of Impl::lanes independent messages with a sponge based on
+                 * interleaved Keccak-f[1600] states. Messages of a group are absorbed in lockstep, the
+                 * digest of each one is squeezed right after its last block, so groups of messages of the
+                 * same length keep all the lanes busy.
+                 *
+                 * @tparam Impl Interleaved permutation implementation
+                 * @tparam RateBytes Sponge rate
+                 * @tparam DigestBytes Output length, shouldn't exceed the rate
+                 * @tparam DomainSeparator Domain separation suffix followed by the first padding bit
+                 */
+                template<typename Impl, std::size_t RateBytes, std::size_t DigestBytes, std::uint8_t DomainSeparator>
+                struct keccak_1600_multi_buffer {
+                    constexpr static const std::size_t lanes = Impl::lanes;
+                    constexpr static const std::size_t rate_words = RateBytes / 8;
+
+                    static_assert(DigestBytes <= RateBytes, "digest has to be squeezed in one block");
+                    typedef typename Impl::state_type state_type;
+
+                    /*!
+                     * @brief Hashes up to lanes messages [first, last) and writes the digests to out
+                     * in the same order. Messages are ranges of octets.
+                     */
+                    template<typename Digest, typename InputIterator, typename OutputIterator>
+                    static OutputIterator process_group(InputIterator first, InputIterator last, OutputIterator out) {
+                        typedef typename std::iterator_traits<InputIterator>::value_type range_type;
+                        typedef typename boost::range_const_iterator<range_type>::type octet_iterator;
+
+                        octet_iterator position[lanes];
+                        std::size_t remaining[lanes], blocks[lanes];
+                        std::size_t n = 0, max_blocks = 0;
+                        for (; first != last; ++first, ++n) {
+                            position[n] = boost::begin(*first);
+                            remaining[n] = std::distance(boost::begin(*first), boost::end(*first));
+                            blocks[n] = remaining[n] / RateBytes + 1;
+                            max_blocks = std::max(max_blocks, blocks[n]);
+                        }
+
+                        state_type state;
+                        for (std::size_t i = 0; i != state.size(); ++i) {
+                            state[i].fill(0);
+                        }
+
+                        Digest digests[lanes];
+                        octet_type block[RateBytes];
+                        for (std::size_t step = 0; step != max_blocks; ++step) {
+                            for (std::size_t lane = 0; lane != n; ++lane) {
+                                if (step >= blocks[lane]) {
+                                    continue;
+                                }
+
+                                std::size_t taken = std::min(remaining[lane], RateBytes);
+                                octet_type *end = std::copy_n(position[lane], taken, block);
+                                std::advance(position[lane], taken);
+                                remaining[lane] -= taken;
+
+                                if (step + 1 == blocks[lane]) {
+                                    // pad10*1 with the domain separator
+                                    std::fill(end, block + RateBytes, 0);
+                                    *end = DomainSeparator;
+                                    block[RateBytes - 1] |= 0x80;
+                                }
+
+                                for (std::size_t i = 0; i != rate_words; ++i) {
+                                    state[i][lane] ^= load_word(block + i * 8);
+                                }
+                            }
+
+                            Impl::permute(state);
+
+                            for (std::size_t lane = 0; lane != n; ++lane) {
+                                if (step + 1 == blocks[lane]) {
+                                    for (std::size_t i = 0; i != DigestBytes; ++i) {
+                                        digests[lane][i] = static_cast<octet_type>(state[i / 8][lane] >> (8 * (i % 8)));
+                                    }
+                                }
+                            }
+                        }
+
+                        return std::copy(digests, digests + n, out);
+                    }
+
+                private:
+                    static inline std::uint64_t load_word(const octet_type *p) {
+                        std::uint64_t w = 0;
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            w |= std::uint64_t(p[i]) << (8 * i);
+                        }
+                        return w;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_KECCAK_MULTI_BUFFER_HPP
@@ -12,6 +12,8 @@
 
 #include <boost/crypto3/detail/basic_functions.hpp>
 
+#include <cstdint>
+
 namespace boost {
     namespace crypto3 {
         namespace hashes {
@@ -32,6 +34,10 @@ namespace boost {
 
                     constexpr static const std::size_t length_bits = 0;
 
+                    /// Original Keccak submission has no domain separation, only the first padding bit
+                    constexpr static const std::uint8_t domain_separator = 0x01;
+                    constexpr static const std::size_t domain_separator_bits = 1;
+
                     typedef typename stream_endian::big_octet_big_bit digest_endian;
 
                     constexpr static const std::size_t rounds = 24;
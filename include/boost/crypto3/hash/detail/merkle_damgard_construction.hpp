@@ -11,10 +11,14 @@
 #define CRYPTO3_HASH_MERKLE_DAMGARD_CONSTRUCTION_HPP
 
 #include <boost/crypto3/hash/detail/nop_finalizer.hpp>
+#include <boost/crypto3/hash/detail/compressor_traits.hpp>
 
 #include <boost/crypto3/detail/static_digest.hpp>
 #include <boost/crypto3/detail/pack.hpp>
 
+#include <algorithm>
+#include <array>
+
 namespace boost {
     namespace crypto3 {
         namespace hashes {
@@ -77,6 +81,18 @@ namespace boost {
                     return *this;
                 }
 
+                /*!
+                 * @brief Processes n consecutive blocks. Compressors able to handle several blocks at once
+                 * receive them with a single call.
+                 */
+                template<typename Integer = std::size_t>
+                inline merkle_damgard_construction &process_blocks(const block_type *blocks, std::size_t n,
+                                                                   Integer = Integer()) {
+                    process_blocks(blocks, n,
+                                   std::integral_constant<bool, detail::has_process_blocks<compressor_functor>::value>());
+                    return *this;
+                }
+
                 inline digest_type digest(const block_type &block = block_type(),
                                           length_type total_seen = length_type()) {
                     using namespace boost::crypto3::detail;
@@ -106,9 +122,12 @@ namespace boost {
                     // Apply finalizer
                     finalizer_functor()(state_);
 
-                    // Convert digest to byte representation
+                    // Convert digest to byte representation, truncating the state for wide pipe hashes
+                    std::array<octet_type, state_bits / octet_bits> d_full;
+                    pack_from<endian_type, word_bits, octet_bits>(state_.begin(), state_.end(), d_full.begin());
                     digest_type d;
-                    pack_from<endian_type, word_bits, octet_bits>(state_.begin(), state_.end(), d.begin());
+                    std::copy(d_full.begin(), d_full.begin() + digest_bytes, d.begin());
+
                     return d;
                 }
 
@@ -129,7 +148,24 @@ namespace boost {
                     return state_;
                 }
 
+                /*!
+                 * @brief Sets the chaining state of a partially processed message, as returned by state()
+                 */
+                inline void restore(const state_type &s) {
+                    state_ = s;
+                }
+
             protected:
+                inline void process_blocks(const block_type *blocks, std::size_t n, std::true_type) {
+                    compressor_functor::process_blocks(state_, blocks, n);
+                }
+
+                inline void process_blocks(const block_type *blocks, std::size_t n, std::false_type) {
+                    for (const block_type *last = blocks + n; blocks != last; ++blocks) {
+                        compressor_functor::process_block(state_, *blocks);
+                    }
+                }
+
                 template<typename Dummy>
                 typename std::enable_if<length_bits && sizeof(Dummy)>::type append_length(block_type &block,
                                                                                           length_type length) {
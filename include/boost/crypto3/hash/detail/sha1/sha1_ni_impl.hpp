@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_SHA1_NI_IMPL_HPP
+#define CRYPTO3_HASH_SHA1_NI_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include <boost/crypto3/detail/config.hpp>
+
+#include <boost/crypto3/block/detail/shacal/shacal1_policy.hpp>
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-1 compression function implemented with Intel SHA extensions.
+                 * Blocks are expected to be already converted to message words, the state is
+                 * kept in registers across consecutive blocks.
+                 */
+                struct sha1_ni_impl {
+                    typedef block::detail::shacal1_policy policy_type;
+
+                    typedef typename policy_type::block_type state_type;
+                    typedef typename policy_type::key_type block_type;
+
+                    static bool is_available() {
+                        return cpuid::has_intel_sha() && cpuid::has_sse41() && cpuid::has_ssse3();
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sha,sse4.1,ssse3")
+                    static void process_blocks(state_type &state, const block_type *blocks, std::size_t n) {
+                        __m128i abcd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state.data()));
+                        __m128i e0 = _mm_set_epi32(state[4], 0, 0, 0);
+                        abcd = _mm_shuffle_epi32(abcd, 0x1B);
+
+                        for (const block_type *last = blocks + n; blocks != last; ++blocks) {
+                            const __m128i abcd_save = abcd;
+                            const __m128i e0_save = e0;
+                            __m128i e1;
+
+                            // Message words come in native order, sha1rnds4 expects them reversed
+                            const __m128i *w = reinterpret_cast<const __m128i *>(blocks->data());
+                            __m128i m0 = _mm_shuffle_epi32(_mm_loadu_si128(w), 0x1B);
+                            __m128i m1 = _mm_shuffle_epi32(_mm_loadu_si128(w + 1), 0x1B);
+                            __m128i m2 = _mm_shuffle_epi32(_mm_loadu_si128(w + 2), 0x1B);
+                            __m128i m3 = _mm_shuffle_epi32(_mm_loadu_si128(w + 3), 0x1B);
+
+                            // Rounds 0-3
+                            e0 = _mm_add_epi32(e0, m0);
+                            e1 = abcd;
+                            abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+                            // Rounds 4-79, four at a time
+                            rounds<0, false, true, false>(abcd, e1, e0, m1, m2, m3, m0);
+                            rounds<0, false, true, true>(abcd, e0, e1, m2, m3, m0, m1);
+                            rounds<0, true, true, true>(abcd, e1, e0, m3, m0, m1, m2);
+                            rounds<0, true, true, true>(abcd, e0, e1, m0, m1, m2, m3);
+                            rounds<1, true, true, true>(abcd, e1, e0, m1, m2, m3, m0);
+                            rounds<1, true, true, true>(abcd, e0, e1, m2, m3, m0, m1);
+                            rounds<1, true, true, true>(abcd, e1, e0, m3, m0, m1, m2);
+                            rounds<1, true, true, true>(abcd, e0, e1, m0, m1, m2, m3);
+                            rounds<1, true, true, true>(abcd, e1, e0, m1, m2, m3, m0);
+                            rounds<2, true, true, true>(abcd, e0, e1, m2, m3, m0, m1);
+                            rounds<2, true, true, true>(abcd, e1, e0, m3, m0, m1, m2);
+                            rounds<2, true, true, true>(abcd, e0, e1, m0, m1, m2, m3);
+                            rounds<2, true, true, true>(abcd, e1, e0, m1, m2, m3, m0);
+                            rounds<2, true, true, true>(abcd, e0, e1, m2, m3, m0, m1);
+                            rounds<3, true, true, true>(abcd, e1, e0, m3, m0, m1, m2);
+                            rounds<3, true, true, true>(abcd, e0, e1, m0, m1, m2, m3);
+                            rounds<3, true, false, true>(abcd, e1, e0, m1, m2, m3, m0);
+                            rounds<3, true, false, false>(abcd, e0, e1, m2, m3, m0, m1);
+                            rounds<3, false, false, false>(abcd, e1, e0, m3, m0, m1, m2);
+
+                            e0 = _mm_sha1nexte_epu32(e0, e0_save);
+                            abcd = _mm_add_epi32(abcd, abcd_save);
+                        }
+
+                        abcd = _mm_shuffle_epi32(abcd, 0x1B);
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data()), abcd);
+                        state[4] = static_cast<std::uint32_t>(_mm_extract_epi32(e0, 3));
+                    }
+
+                private:
+                    /*!
+                     * @brief Performs four rounds with Func round function over message words m,
+                     * interleaved with the schedule of the following message words.
+                     *
+                     * @tparam Func Round function index, i.e. the round number divided by 20
+                     * @tparam Msg2 Whether m completes the schedule of next
+                     * @tparam Msg1 Whether m starts the schedule of prev
+                     * @tparam Xor Whether m is mixed into after
+                     */
+                    template<int Func, bool Msg2, bool Msg1, bool Xor>
+                    BOOST_ATTRIBUTE_TARGET("sha,sse4.1,ssse3")
+                    static inline void rounds(__m128i &abcd, __m128i &e, __m128i &e_next, __m128i m, __m128i &next,
+                                              __m128i &after, __m128i &prev) {
+                        e = _mm_sha1nexte_epu32(e, m);
+                        e_next = abcd;
+                        if (Msg2) {
+                            next = _mm_sha1msg2_epu32(next, m);
+                        }
+                        abcd = _mm_sha1rnds4_epu32(abcd, e, Func);
+                        if (Msg1) {
+                            prev = _mm_sha1msg1_epu32(prev, m);
+                        }
+                        if (Xor) {
+                            after = _mm_xor_si128(after, m);
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_SHA1_NI_IMPL_HPP
@@ -12,6 +12,12 @@
 
 #include <boost/crypto3/block/shacal1.hpp>
 
+#include <boost/crypto3/hash/detail/sha_ni_compressor.hpp>
+
+#ifdef CRYPTO3_HASH_HAS_SHA_NI
+#include <boost/crypto3/hash/detail/sha1/sha1_ni_impl.hpp>
+#endif
+
 #include <boost/crypto3/detail/static_digest.hpp>
 
 namespace boost {
@@ -36,6 +42,13 @@ namespace boost {
 
                     typedef typename stream_endian::big_octet_big_bit digest_endian;
 
+                    /// Hardware implementation of the compression function, void in case there is none
+#ifdef CRYPTO3_HASH_HAS_SHA_NI
+                    typedef sha1_ni_impl ni_impl_type;
+#else
+                    typedef void ni_impl_type;
+#endif
+
                     constexpr static const std::size_t digest_bits = 160;
                     constexpr static const std::uint8_t ieee1363_hash_id = 0x33;
 
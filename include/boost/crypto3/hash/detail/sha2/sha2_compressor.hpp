@@ -0,0 +1,125 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_SHA2_COMPRESSOR_HPP
+#define CRYPTO3_HASH_SHA2_COMPRESSOR_HPP
+
+#include <cstddef>
+
+#include <boost/crypto3/block/detail/shacal/shacal2_policy.hpp>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-2 compression function. Computes the same function as
+                 * davies_meyer_compressor over shacal2 with state_adder combiner, but
+                 * doesn't construct a cipher per block: the message schedule is expanded
+                 * in a rolling 16-word window interleaved with the rounds, rounds are
+                 * unrolled without shuffling the working variables and the result is added
+                 * to the state in place.
+                 *
+                 * @tparam Version shacal2 version, i.e. 256 or 512
+                 */
+                template<std::size_t Version>
+                struct sha2_compressor {
+                    typedef block::detail::shacal2_policy<Version> policy_type;
+
+                    constexpr static const std::size_t word_bits = policy_type::word_bits;
+                    typedef typename policy_type::word_type word_type;
+
+                    constexpr static const std::size_t state_bits = policy_type::block_bits;
+                    constexpr static const std::size_t state_words = policy_type::block_words;
+                    typedef typename policy_type::block_type state_type;
+
+                    constexpr static const std::size_t block_bits = policy_type::key_bits;
+                    constexpr static const std::size_t block_words = policy_type::key_words;
+                    typedef typename policy_type::key_type block_type;
+
+                    constexpr static const std::size_t rounds = policy_type::rounds;
+
+                    inline static void process_block(state_type &state, const block_type &block) {
+                        word_type a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5],
+                                  g = state[6], h = state[7];
+
+                        // Only the last 16 words of the schedule are ever needed, so the schedule is expanded
+                        // in place as the rounds go
+                        word_type w[block_words];
+                        for (std::size_t t = 0; t != block_words; ++t) {
+                            w[t] = block[t];
+                        }
+
+                        for (std::size_t t = 0; t != block_words; t += 8) {
+                            round(a, b, c, d, e, f, g, h, w[t + 0], t + 0);
+                            round(h, a, b, c, d, e, f, g, w[t + 1], t + 1);
+                            round(g, h, a, b, c, d, e, f, w[t + 2], t + 2);
+                            round(f, g, h, a, b, c, d, e, w[t + 3], t + 3);
+                            round(e, f, g, h, a, b, c, d, w[t + 4], t + 4);
+                            round(d, e, f, g, h, a, b, c, w[t + 5], t + 5);
+                            round(c, d, e, f, g, h, a, b, w[t + 6], t + 6);
+                            round(b, c, d, e, f, g, h, a, w[t + 7], t + 7);
+                        }
+
+                        for (std::size_t t = block_words; t != rounds; t += block_words) {
+                            round(a, b, c, d, e, f, g, h, expand(w, 0), t + 0);
+                            round(h, a, b, c, d, e, f, g, expand(w, 1), t + 1);
+                            round(g, h, a, b, c, d, e, f, expand(w, 2), t + 2);
+                            round(f, g, h, a, b, c, d, e, expand(w, 3), t + 3);
+                            round(e, f, g, h, a, b, c, d, expand(w, 4), t + 4);
+                            round(d, e, f, g, h, a, b, c, expand(w, 5), t + 5);
+                            round(c, d, e, f, g, h, a, b, expand(w, 6), t + 6);
+                            round(b, c, d, e, f, g, h, a, expand(w, 7), t + 7);
+                            round(a, b, c, d, e, f, g, h, expand(w, 8), t + 8);
+                            round(h, a, b, c, d, e, f, g, expand(w, 9), t + 9);
+                            round(g, h, a, b, c, d, e, f, expand(w, 10), t + 10);
+                            round(f, g, h, a, b, c, d, e, expand(w, 11), t + 11);
+                            round(e, f, g, h, a, b, c, d, expand(w, 12), t + 12);
+                            round(d, e, f, g, h, a, b, c, expand(w, 13), t + 13);
+                            round(c, d, e, f, g, h, a, b, expand(w, 14), t + 14);
+                            round(b, c, d, e, f, g, h, a, expand(w, 15), t + 15);
+                        }
+
+                        state[0] += a;
+                        state[1] += b;
+                        state[2] += c;
+                        state[3] += d;
+                        state[4] += e;
+                        state[5] += f;
+                        state[6] += g;
+                        state[7] += h;
+                    }
+
+                    inline static void process_blocks(state_type &state, const block_type *blocks, std::size_t n) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            process_block(state, blocks[i]);
+                        }
+                    }
+
+                private:
+                    /// Replaces schedule word i - 16 of the window with word i
+                    inline static word_type expand(word_type (&w)[block_words], std::size_t i) {
+                        return w[i] += policy_type::sigma_1(w[(i + 14) % block_words]) + w[(i + 9) % block_words] +
+                                       policy_type::sigma_0(w[(i + 1) % block_words]);
+                    }
+
+                    /// Performs a single round, the caller rotates the working variables
+                    inline static void round(word_type a, word_type b, word_type c, word_type &d, word_type e,
+                                             word_type f, word_type g, word_type &h, word_type w, std::size_t t) {
+                        const word_type t1 = h + policy_type::Sigma_1(e) + policy_type::Ch(e, f, g) +
+                                             policy_type::constants[t] + w;
+                        d += t1;
+                        h = t1 + policy_type::Sigma_0(a) + policy_type::Maj(a, b, c);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_SHA2_COMPRESSOR_HPP
@@ -0,0 +1,333 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_SHA2_MULTI_BUFFER_HPP
+#define CRYPTO3_HASH_SHA2_MULTI_BUFFER_HPP
+
+#include <boost/predef/architecture.h>
+
+#include <boost/crypto3/detail/config.hpp>
+#include <boost/crypto3/detail/octet.hpp>
+
+#include <boost/crypto3/block/detail/shacal/shacal2_policy.hpp>
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <boost/endian/conversion.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_HASH_HAS_SHA2_MULTI_BUFFER
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+#ifdef CRYPTO3_HASH_HAS_SHA2_MULTI_BUFFER
+                /*!
+                 * @brief SHA-256 compression function applied to eight independent states at once
+                 * with AVX2. Word i of every state and message block is kept in the i-th row of the
+                 * interleaved arrays, lanes missing from the mask keep their state untouched.
+                 */
+                struct sha256_x8_avx2_impl {
+                    typedef block::detail::shacal2_policy<256> policy_type;
+
+                    constexpr static const std::size_t lanes = 8;
+                    typedef std::array<std::array<std::uint32_t, lanes>, 8> state_type;
+                    typedef std::array<std::array<std::uint32_t, lanes>, 16> block_type;
+
+                    static bool is_available() {
+                        return cpuid::has_avx2();
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static void process_block(state_type &state, const block_type &block, unsigned mask) {
+                        __m256i w[16], s[8];
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            s[i] = load(state[i].data());
+                        }
+                        for (std::size_t t = 0; t != 16; ++t) {
+                            w[t] = load(block[t].data());
+                        }
+
+                        __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+                        for (std::size_t t = 0; t != policy_type::rounds; ++t) {
+                            if (t >= 16) {
+                                w[t % 16] = _mm256_add_epi32(
+                                    _mm256_add_epi32(sigma1(w[(t - 2) % 16]), w[(t - 7) % 16]),
+                                    _mm256_add_epi32(sigma0(w[(t - 15) % 16]), w[t % 16]));
+                            }
+
+                            __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+                            __m256i maj =
+                                _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+                            __m256i t1 = _mm256_add_epi32(
+                                _mm256_add_epi32(_mm256_add_epi32(h, Sigma1(e)), ch),
+                                _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(policy_type::constants[t])),
+                                                 w[t % 16]));
+                            __m256i t2 = _mm256_add_epi32(Sigma0(a), maj);
+
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = _mm256_add_epi32(d, t1);
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = _mm256_add_epi32(t1, t2);
+                        }
+
+                        const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+                        const __m256i active =
+                            _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(mask)), bits), bits);
+                        const __m256i v[8] = {a, b, c, d, e, f, g, h};
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[i].data()),
+                                                _mm256_blendv_epi8(s[i], _mm256_add_epi32(s[i], v[i]), active));
+                        }
+                    }
+
+                private:
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i load(const std::uint32_t *p) {
+                        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                    }
+
+                    template<int N>
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i rotr(__m256i x) {
+                        return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i Sigma0(__m256i x) {
+                        return _mm256_xor_si256(_mm256_xor_si256(rotr<2>(x), rotr<13>(x)), rotr<22>(x));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i Sigma1(__m256i x) {
+                        return _mm256_xor_si256(_mm256_xor_si256(rotr<6>(x), rotr<11>(x)), rotr<25>(x));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i sigma0(__m256i x) {
+                        return _mm256_xor_si256(_mm256_xor_si256(rotr<7>(x), rotr<18>(x)), _mm256_srli_epi32(x, 3));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i sigma1(__m256i x) {
+                        return _mm256_xor_si256(_mm256_xor_si256(rotr<17>(x), rotr<19>(x)), _mm256_srli_epi32(x, 10));
+                    }
+                };
+
+                /*!
+                 * @brief SHA-256 compression function applied to sixteen independent states at once
+                 * with AVX-512F.
+                 */
+                struct sha256_x16_avx512_impl {
+                    typedef block::detail::shacal2_policy<256> policy_type;
+
+                    constexpr static const std::size_t lanes = 16;
+                    typedef std::array<std::array<std::uint32_t, lanes>, 8> state_type;
+                    typedef std::array<std::array<std::uint32_t, lanes>, 16> block_type;
+
+                    static bool is_available() {
+                        return cpuid::has_avx512f();
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static void process_block(state_type &state, const block_type &block, unsigned mask) {
+                        __m512i w[16], s[8];
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            s[i] = _mm512_loadu_si512(state[i].data());
+                        }
+                        for (std::size_t t = 0; t != 16; ++t) {
+                            w[t] = _mm512_loadu_si512(block[t].data());
+                        }
+
+                        __m512i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+                        for (std::size_t t = 0; t != policy_type::rounds; ++t) {
+                            if (t >= 16) {
+                                w[t % 16] = _mm512_add_epi32(
+                                    _mm512_add_epi32(sigma1(w[(t - 2) % 16]), w[(t - 7) % 16]),
+                                    _mm512_add_epi32(sigma0(w[(t - 15) % 16]), w[t % 16]));
+                            }
+
+                            // Ch is e ? f : g, Maj is the majority of a, b and c
+                            __m512i t1 = _mm512_add_epi32(
+                                _mm512_add_epi32(_mm512_add_epi32(h, Sigma1(e)),
+                                                 _mm512_ternarylogic_epi32(e, f, g, 0xCA)),
+                                _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(policy_type::constants[t])),
+                                                 w[t % 16]));
+                            __m512i t2 = _mm512_add_epi32(Sigma0(a), _mm512_ternarylogic_epi32(a, b, c, 0xE8));
+
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = _mm512_add_epi32(d, t1);
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = _mm512_add_epi32(t1, t2);
+                        }
+
+                        const __mmask16 active = static_cast<__mmask16>(mask);
+                        const __m512i v[8] = {a, b, c, d, e, f, g, h};
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            _mm512_storeu_si512(state[i].data(), _mm512_mask_add_epi32(s[i], active, s[i], v[i]));
+                        }
+                    }
+
+                private:
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static inline __m512i xor3(__m512i x, __m512i y, __m512i z) {
+                        return _mm512_ternarylogic_epi32(x, y, z, 0x96);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static inline __m512i Sigma0(__m512i x) {
+                        return xor3(_mm512_ror_epi32(x, 2), _mm512_ror_epi32(x, 13), _mm512_ror_epi32(x, 22));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static inline __m512i Sigma1(__m512i x) {
+                        return xor3(_mm512_ror_epi32(x, 6), _mm512_ror_epi32(x, 11), _mm512_ror_epi32(x, 25));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static inline __m512i sigma0(__m512i x) {
+                        return xor3(_mm512_ror_epi32(x, 7), _mm512_ror_epi32(x, 18), _mm512_srli_epi32(x, 3));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static inline __m512i sigma1(__m512i x) {
+                        return xor3(_mm512_ror_epi32(x, 17), _mm512_ror_epi32(x, 19), _mm512_srli_epi32(x, 10));
+                    }
+                };
+#endif
+
+                /*!
+                 * @brief Hashes groups of Impl::lanes independent messages with SHA-256 compression
+                 * applied to interleaved states. Every message is padded on its own, lanes whose
+                 * message is already complete are masked out of the remaining compressions.
+                 *
+                 * @tparam Impl Interleaved compression function implementation
+                 * @tparam Policy SHA-224 or SHA-256 policy providing the initial state
+                 */
+                template<typename Impl, typename Policy>
+                struct sha256_multi_buffer {
+                    constexpr static const std::size_t lanes = Impl::lanes;
+                    constexpr static const std::size_t block_bytes = 64;
+                    constexpr static const std::size_t digest_bytes = Policy::digest_bits / octet_bits;
+
+                    typedef typename Impl::state_type state_type;
+                    typedef typename Impl::block_type block_type;
+
+                    /*!
+                     * @brief Hashes up to lanes messages [first, last) and writes the digests to out
+                     * in the same order. Messages are ranges of octets.
+                     */
+                    template<typename Digest, typename InputIterator, typename OutputIterator>
+                    static OutputIterator process_group(InputIterator first, InputIterator last, OutputIterator out) {
+                        typedef typename std::iterator_traits<InputIterator>::value_type range_type;
+                        typedef typename boost::range_const_iterator<range_type>::type octet_iterator;
+
+                        octet_iterator position[lanes];
+                        std::size_t length[lanes], full_blocks[lanes], blocks[lanes];
+                        std::size_t n = 0, max_blocks = 0;
+                        for (; first != last; ++first, ++n) {
+                            position[n] = boost::begin(*first);
+                            length[n] = std::distance(boost::begin(*first), boost::end(*first));
+                            full_blocks[n] = length[n] / block_bytes;
+                            // 0x80 and the 64-bit length have to fit after the remaining octets
+                            blocks[n] = full_blocks[n] + (length[n] % block_bytes + 9 > block_bytes ? 2 : 1);
+                            max_blocks = std::max(max_blocks, blocks[n]);
+                        }
+
+                        const typename Policy::state_type &iv = typename Policy::iv_generator()();
+                        state_type state;
+                        for (std::size_t i = 0; i != state.size(); ++i) {
+                            state[i].fill(iv[i]);
+                        }
+
+                        Digest digests[lanes];
+                        octet_type tail[lanes][2 * block_bytes];
+                        octet_type buffer[block_bytes];
+                        block_type block;
+                        for (std::size_t step = 0; step != max_blocks; ++step) {
+                            unsigned mask = 0;
+                            for (std::size_t lane = 0; lane != n; ++lane) {
+                                if (step >= blocks[lane]) {
+                                    continue;
+                                }
+                                mask |= 1u << lane;
+
+                                const octet_type *p;
+                                if (step < full_blocks[lane]) {
+                                    std::copy_n(position[lane], block_bytes, buffer);
+                                    std::advance(position[lane], block_bytes);
+                                    p = buffer;
+                                } else {
+                                    if (step == full_blocks[lane]) {
+                                        pad(tail[lane], position[lane], length[lane]);
+                                    }
+                                    p = tail[lane] + (step - full_blocks[lane]) * block_bytes;
+                                }
+
+                                for (std::size_t t = 0; t != 16; ++t, p += 4) {
+                                    std::uint32_t w;
+                                    std::memcpy(&w, p, sizeof(w));
+                                    block[t][lane] = boost::endian::big_to_native(w);
+                                }
+                            }
+
+                            Impl::process_block(state, block, mask);
+
+                            for (std::size_t lane = 0; lane != n; ++lane) {
+                                if (step + 1 == blocks[lane]) {
+                                    for (std::size_t i = 0; i != digest_bytes; ++i) {
+                                        digests[lane][i] =
+                                            static_cast<octet_type>(state[i / 4][lane] >> (8 * (3 - i % 4)));
+                                    }
+                                }
+                            }
+                        }
+
+                        return std::copy(digests, digests + n, out);
+                    }
+
+                private:
+                    template<typename OctetIterator>
+                    static void pad(octet_type *tail, OctetIterator position, std::size_t length) {
+                        std::size_t remaining = length % block_bytes;
+                        std::size_t tail_bytes = remaining + 9 > block_bytes ? 2 * block_bytes : block_bytes;
+
+                        std::fill(std::copy_n(position, remaining, tail), tail + tail_bytes, 0);
+                        tail[remaining] = 0x80;
+
+                        std::uint64_t length_bits = std::uint64_t(length) * octet_bits;
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            tail[tail_bytes - 1 - i] = static_cast<octet_type>(length_bits >> (8 * i));
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_SHA2_MULTI_BUFFER_HPP
@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_SHA2_NI_IMPL_HPP
+#define CRYPTO3_HASH_SHA2_NI_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include <boost/crypto3/detail/config.hpp>
+
+#include <boost/crypto3/block/detail/shacal/shacal2_policy.hpp>
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-256 compression function implemented with Intel SHA extensions.
+                 * Blocks are expected to be already converted to message words, the state is
+                 * kept in registers across consecutive blocks.
+                 */
+                struct sha256_ni_impl {
+                    typedef block::detail::shacal2_policy<256> policy_type;
+
+                    typedef typename policy_type::block_type state_type;
+                    typedef typename policy_type::key_type block_type;
+
+                    static bool is_available() {
+                        return cpuid::has_intel_sha() && cpuid::has_sse41() && cpuid::has_ssse3();
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sha,sse4.1,ssse3")
+                    static void process_blocks(state_type &state, const block_type *blocks, std::size_t n) {
+                        const std::uint32_t *k = policy_type::constants.data();
+
+                        // Rearrange the state into ABEF/CDGH halves expected by sha256rnds2
+                        __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state.data()));
+                        __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state.data() + 4));
+
+                        tmp = _mm_shuffle_epi32(tmp, 0xB1);
+                        state1 = _mm_shuffle_epi32(state1, 0x1B);
+                        __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+                        state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+                        for (const block_type *last = blocks + n; blocks != last; ++blocks) {
+                            const __m128i abef = state0;
+                            const __m128i cdgh = state1;
+
+                            const __m128i *w = reinterpret_cast<const __m128i *>(blocks->data());
+                            __m128i m0 = _mm_loadu_si128(w);
+                            __m128i m1 = _mm_loadu_si128(w + 1);
+                            __m128i m2 = _mm_loadu_si128(w + 2);
+                            __m128i m3 = _mm_loadu_si128(w + 3);
+
+                            rounds(state0, state1, m0, k);
+                            rounds(state0, state1, m1, k + 4);
+                            rounds(state0, state1, m2, k + 8);
+                            rounds(state0, state1, m3, k + 12);
+
+                            for (std::size_t t = 16; t != 64; t += 16) {
+                                m0 = schedule(m0, m1, m2, m3);
+                                rounds(state0, state1, m0, k + t);
+                                m1 = schedule(m1, m2, m3, m0);
+                                rounds(state0, state1, m1, k + t + 4);
+                                m2 = schedule(m2, m3, m0, m1);
+                                rounds(state0, state1, m2, k + t + 8);
+                                m3 = schedule(m3, m0, m1, m2);
+                                rounds(state0, state1, m3, k + t + 12);
+                            }
+
+                            state0 = _mm_add_epi32(state0, abef);
+                            state1 = _mm_add_epi32(state1, cdgh);
+                        }
+
+                        // Back to ABCD/EFGH
+                        tmp = _mm_shuffle_epi32(state0, 0x1B);
+                        state1 = _mm_shuffle_epi32(state1, 0xB1);
+                        state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+                        state1 = _mm_alignr_epi8(state1, tmp, 8);
+
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data()), state0);
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data() + 4), state1);
+                    }
+
+                private:
+                    /// Computes the next four message words out of the previous sixteen
+                    BOOST_ATTRIBUTE_TARGET("sha,sse4.1,ssse3")
+                    static inline __m128i schedule(__m128i m0, __m128i m1, __m128i m2, __m128i m3) {
+                        __m128i x = _mm_sha256msg1_epu32(m0, m1);
+                        x = _mm_add_epi32(x, _mm_alignr_epi8(m3, m2, 4));
+                        return _mm_sha256msg2_epu32(x, m3);
+                    }
+
+                    /// Performs four rounds
+                    BOOST_ATTRIBUTE_TARGET("sha,sse4.1,ssse3")
+                    static inline void rounds(__m128i &state0, __m128i &state1, __m128i m, const std::uint32_t *k) {
+                        __m128i x = _mm_add_epi32(m, _mm_loadu_si128(reinterpret_cast<const __m128i *>(k)));
+                        state1 = _mm_sha256rnds2_epu32(state1, state0, x);
+                        x = _mm_shuffle_epi32(x, 0x0E);
+                        state0 = _mm_sha256rnds2_epu32(state0, state1, x);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_SHA2_NI_IMPL_HPP
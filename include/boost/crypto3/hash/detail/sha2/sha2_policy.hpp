@@ -12,9 +12,17 @@
 
 #include <boost/crypto3/block/shacal2.hpp>
 
+#include <boost/crypto3/hash/detail/sha_ni_compressor.hpp>
+#include <boost/crypto3/hash/detail/sha2/sha2_compressor.hpp>
+
+#ifdef CRYPTO3_HASH_HAS_SHA_NI
+#include <boost/crypto3/hash/detail/sha2/sha2_ni_impl.hpp>
+#endif
+
 #include <boost/crypto3/detail/static_digest.hpp>
 
 #include <array>
+#include <type_traits>
 
 namespace boost {
     namespace crypto3 {
@@ -41,6 +49,16 @@ namespace boost {
                     constexpr static const std::size_t length_bits = word_bits * 2;
 
                     typedef typename stream_endian::big_octet_big_bit digest_endian;
+
+                    /// Portable compression function
+                    typedef sha2_compressor<cipher_version> compressor_type;
+
+                    /// Hardware implementation of the compression function, void in case there is none
+#ifdef CRYPTO3_HASH_HAS_SHA_NI
+                    typedef typename std::conditional<cipher_version == 256, sha256_ni_impl, void>::type ni_impl_type;
+#else
+                    typedef void ni_impl_type;
+#endif
                 };
 
                 template<std::size_t Version>
@@ -13,6 +13,9 @@
 #include <boost/crypto3/detail/inject.hpp>
 #include <boost/crypto3/detail/unbounded_shift.hpp>
 
+#include <algorithm>
+#include <cstdint>
+
 namespace boost {
     namespace crypto3 {
         namespace hashes {
@@ -35,12 +38,20 @@ namespace boost {
                     constexpr static const std::size_t digest_bits = policy_type::digest_bits;
                     typedef typename policy_type::digest_type digest_type;
 
+                    constexpr static const std::uint8_t domain_separator = policy_type::domain_separator;
+                    constexpr static const std::size_t domain_separator_bits = policy_type::domain_separator_bits;
+
                     typedef ::boost::crypto3::detail::injector<stream_endian::big_octet_little_bit, word_bits,
                                                              block_words, block_bits>
                         injector_type;
 
                     bool is_last;
 
+                    /// Domain separator bits left after skipping the first skip ones, placed as the first stream octet
+                    static word_type domain_separator_word(std::size_t skip) {
+                        return word_type(domain_separator >> skip) << (word_bits - octet_bits);
+                    }
+
                 public:
                     sha3_padding() : is_last(true) {
                     }
@@ -52,14 +63,9 @@ namespace boost {
                     void operator()(block_type &block, std::size_t &block_seen) {
                         using namespace boost::crypto3::detail;
 
-                        if ((block_bits - block_seen) > 3) {
-                            /*if (block_seen % octet_bits) {
-                                pack<stream_endian::big_octet_big_bit, stream_endian::big_octet_little_bit,
-                                word_bits, word_bits>(block.begin(), block.end(), block.begin());
-                            }*/
-                            // pad 011
-                            injector_type::inject(unbounded_shr(high_bits<word_bits>(~word_type(), 2), 5), 3, block,
-                                                  block_seen);
+                        if ((block_bits - block_seen) > domain_separator_bits) {
+                            // pad domain separator and the first 1
+                            injector_type::inject(domain_separator_word(0), domain_separator_bits, block, block_seen);
                             // pad 0*
                             block_type zeros;
                             std::fill(zeros.begin(), zeros.end(), 0);
@@ -70,23 +76,27 @@ namespace boost {
                         }
 
                         else {
+                            // Fill the block with the domain separator bits that fit, the rest goes to the next one
                             is_last = false;
-                            std::size_t ind = block_bits - block_seen - 1;
-                            block[block_words - 1] &= ~high_bits<word_bits>(~word_type(), ind + 1);
-                            block[block_words - 1] |= high_bits<word_bits>(~word_type(), ind);
+                            injector_type::inject(domain_separator_word(0), block_bits - block_seen, block,
+                                                  block_seen);
                         }
                     }
 
                     void process_last(block_type &block, std::size_t &block_seen) {
                         using namespace boost::crypto3::detail;
 
-                        std::size_t ind = 3 - (block_bits - block_seen);
-                        // Insert remaining padding bits
-                        injector_type::inject(low_bits<word_bits>(~word_type(), ind), ind, block, block_seen);
+                        std::size_t injected = block_bits - block_seen;
+                        block_seen = 0;
+                        // Insert remaining domain separator bits
+                        if (injected < domain_separator_bits) {
+                            injector_type::inject(domain_separator_word(injected), domain_separator_bits - injected,
+                                                  block, block_seen);
+                        }
                         // pad 0*
                         block_type zeros;
                         std::fill(zeros.begin(), zeros.end(), 0);
-                        injector_type::inject(zeros, block_bits - 1 - ind, block, block_seen);
+                        injector_type::inject(zeros, block_bits - 1 - block_seen, block, block_seen);
                         // pad 1
                         injector_type::inject(unbounded_shr(high_bits<word_bits>(~word_type(), 1), 7), 1, block,
                                               block_seen);
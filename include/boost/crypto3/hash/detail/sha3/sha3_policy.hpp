@@ -14,6 +14,7 @@
 #include <boost/crypto3/detail/static_digest.hpp>
 
 #include <array>
+#include <cstdint>
 
 namespace boost {
     namespace crypto3 {
@@ -39,6 +40,10 @@ namespace boost {
 
                     constexpr static const std::size_t rounds = 24;
 
+                    /// Domain separation suffix 01 followed by the first bit of pad10*1, least significant bit first
+                    constexpr static const std::uint8_t domain_separator = 0x06;
+                    constexpr static const std::size_t domain_separator_bits = 3;
+
                     struct iv_generator {
                         state_type const &operator()() const {
                             static state_type const H0 = {UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
@@ -0,0 +1,67 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_SHA_NI_COMPRESSOR_HPP
+#define CRYPTO3_HASH_SHA_NI_COMPRESSOR_HPP
+
+#include <cstddef>
+
+#include <boost/predef/architecture.h>
+
+#include <boost/crypto3/detail/config.hpp>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_HASH_HAS_SHA_NI
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Compressor wrapper dispatching to the hardware implementation
+                 * at runtime in case the CPU supports it (as reported by cpuid), and to the
+                 * portable Compressor otherwise.
+                 *
+                 * @tparam Compressor Portable compressor
+                 * @tparam NiImpl Hardware implementation providing is_available() and
+                 * process_blocks(state_type &, const block_type *, std::size_t). void
+                 * disables the dispatch.
+                 *
+                 * @note The hardware path can be disabled with
+                 * cpuid::clear_cpuid_bit(cpuid::CPUID_SHA_BIT) or with CRYPTO3_CLEAR_CPUID=sha
+                 * environment variable.
+                 */
+                template<typename Compressor, typename NiImpl>
+                struct sha_ni_compressor : public Compressor {
+                    typedef typename Compressor::state_type state_type;
+                    typedef typename Compressor::block_type block_type;
+
+                    inline static void process_block(state_type &state, const block_type &block) {
+                        process_blocks(state, &block, 1);
+                    }
+
+                    inline static void process_blocks(state_type &state, const block_type *blocks, std::size_t n) {
+                        if (NiImpl::is_available()) {
+                            NiImpl::process_blocks(state, blocks, n);
+                        } else {
+                            for (std::size_t i = 0; i != n; ++i) {
+                                Compressor::process_block(state, blocks[i]);
+                            }
+                        }
+                    }
+                };
+
+                template<typename Compressor>
+                struct sha_ni_compressor<Compressor, void> : public Compressor { };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_SHA_NI_COMPRESSOR_HPP
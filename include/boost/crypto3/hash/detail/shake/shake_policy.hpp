@@ -0,0 +1,58 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_SHAKE_POLICY_HPP
+#define CRYPTO3_SHAKE_POLICY_HPP
+
+#include <boost/crypto3/hash/detail/sha3/sha3_policy.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHAKE policy. Differs from SHA-3 with the same capacity in the domain
+                 * separator and in the default output length, which is twice the security level.
+                 *
+                 * @tparam Version Security level, i.e. 128 or 256
+                 */
+                template<std::size_t Version>
+                struct shake_policy : public sha3_policy<Version> {
+                    typedef sha3_policy<Version> sha3_policy_type;
+
+                    constexpr static const std::size_t version = Version;
+
+                    constexpr static const std::size_t digest_bits = 2 * Version;
+                    typedef static_digest<digest_bits> digest_type;
+
+                    /// Domain separation suffix 1111 followed by the first bit of pad10*1, least significant bit first
+                    constexpr static const std::uint8_t domain_separator = 0x1F;
+                    constexpr static const std::size_t domain_separator_bits = 5;
+                };
+
+                /*!
+                 * @brief cSHAKE policy, used as soon as either function name or customization string
+                 * is not empty.
+                 *
+                 * @tparam Version Security level, i.e. 128 or 256
+                 */
+                template<std::size_t Version>
+                struct cshake_policy : public shake_policy<Version> {
+                    /// Domain separation suffix 00 followed by the first bit of pad10*1, least significant bit first
+                    constexpr static const std::uint8_t domain_separator = 0x04;
+                    constexpr static const std::size_t domain_separator_bits = 3;
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_SHAKE_POLICY_HPP
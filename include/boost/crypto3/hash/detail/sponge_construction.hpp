@@ -14,6 +14,7 @@
 #include <boost/crypto3/detail/pack.hpp>
 
 #include <boost/crypto3/hash/detail/nop_finalizer.hpp>
+#include <boost/crypto3/hash/detail/compressor_traits.hpp>
 
 namespace boost {
     namespace crypto3 {
@@ -68,19 +69,28 @@ namespace boost {
                     return *this;
                 }
 
-                inline digest_type digest(const block_type &block = block_type(),
-                                          std::size_t total_seen = std::size_t()) {
-                    using namespace boost::crypto3::detail;
+                /*!
+                 * @brief Absorbs n consecutive blocks. Compressors able to handle several blocks at once
+                 * receive them with a single call.
+                 */
+                template<typename Integer = std::size_t>
+                inline sponge_construction &process_blocks(const block_type *blocks, std::size_t n,
+                                                           Integer = Integer()) {
+                    process_blocks(blocks, n,
+                                   std::integral_constant<bool, detail::has_process_blocks<compressor_functor>::value>());
+                    return *this;
+                }
 
+                /*!
+                 * @brief Pads and absorbs the last message block, which holds block_seen bits. Extendable
+                 * output functions may pass another padding, i.e. with another domain separator.
+                 */
+                template<typename LastPadding = padding_functor>
+                inline sponge_construction &process_last_block(const block_type &block, std::size_t block_seen) {
                     block_type b = block;
-                    std::size_t block_seen = total_seen % block_bits;
-                    // Process block if it is full
-                    if (total_seen && !block_seen)
-                        process_block(b);
-
                     std::size_t copy_seen = block_seen;
                     // Pad last message block
-                    padding_functor padding;
+                    LastPadding padding;
                     padding(b, block_seen);
                     process_block(b);
 
@@ -90,6 +100,19 @@ namespace boost {
                         padding.process_last(b, copy_seen);
                         process_block(b);
                     }
+                    return *this;
+                }
+
+                inline digest_type digest(const block_type &block = block_type(),
+                                          std::size_t total_seen = std::size_t()) {
+                    using namespace boost::crypto3::detail;
+
+                    std::size_t block_seen = total_seen % block_bits;
+                    // Process block if it is full
+                    if (total_seen && !block_seen)
+                        process_block(block);
+
+                    process_last_block(block, block_seen);
 
                     // Apply finalizer
                     finalizer_functor()(state_);
@@ -121,7 +144,24 @@ namespace boost {
                     return state_;
                 }
 
+                /*!
+                 * @brief Sets the state of a partially absorbed message, as returned by state()
+                 */
+                void restore(state_type const &s) {
+                    state_ = s;
+                }
+
             private:
+                inline void process_blocks(const block_type *blocks, std::size_t n, std::true_type) {
+                    compressor_functor::process_blocks(state_, blocks, n);
+                }
+
+                inline void process_blocks(const block_type *blocks, std::size_t n, std::false_type) {
+                    for (const block_type *last = blocks + n; blocks != last; ++blocks) {
+                        compressor_functor::process_block(state_, *blocks);
+                    }
+                }
+
                 state_type state_;
             };
 
@@ -0,0 +1,292 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_CHECKPOINT_HPP
+#define CRYPTO3_HASH_CHECKPOINT_HPP
+
+#include <boost/exception/exception.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <boost/crypto3/detail/octet.hpp>
+
+#include <boost/crypto3/hash/hash_state.hpp>
+
+#include <boost/crypto3/hash/detail/haifa_construction.hpp>
+#include <boost/crypto3/hash/detail/merkle_damgard_construction.hpp>
+#include <boost/crypto3/hash/detail/sponge_construction.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @struct bad_hash_state
+             * @brief Thrown when a saved hash state is truncated, of an unknown version or saved by a hash
+             * function of another construction or size
+             */
+            struct bad_hash_state : virtual boost::exception, virtual std::exception {};
+
+            namespace detail {
+                /*!
+                 * @brief Construction identifiers of the saved state format, 0 stands for an unknown one
+                 */
+                template<typename Construction>
+                struct construction_kind : std::integral_constant<std::uint8_t, 0> {};
+
+                template<typename Params, typename IV, typename Compressor, typename Padding, typename Finalizer>
+                struct construction_kind<merkle_damgard_construction<Params, IV, Compressor, Padding, Finalizer>>
+                    : std::integral_constant<std::uint8_t, 1> {};
+
+                template<typename Params, typename IV, typename Compressor, typename Padding, typename Finalizer>
+                struct construction_kind<sponge_construction<Params, IV, Compressor, Padding, Finalizer>>
+                    : std::integral_constant<std::uint8_t, 2> {};
+
+                template<typename Params, typename IV, typename Compressor, typename Padding, typename Finalizer>
+                struct construction_kind<haifa_construction<Params, IV, Compressor, Padding, Finalizer>>
+                    : std::integral_constant<std::uint8_t, 3> {};
+
+                /*!
+                 * @brief Saved state format, version 1. All integers are little-endian.
+                 *
+                 * | Octets          | Contents                                                  |
+                 * |-----------------|-----------------------------------------------------------|
+                 * | 4               | "C3HS"                                                    |
+                 * | 1               | Format version                                            |
+                 * | 1               | Construction: 1 Merkle-Damgard, 2 sponge, 3 HAIFA         |
+                 * | 4 x 4           | Digest, word, block and state sizes in bits               |
+                 * | 1               | Whether the cache holds a full block not yet processed    |
+                 * | 8               | Amount of bits hashed                                     |
+                 * | state_bits / 8  | Construction state words                                  |
+                 * | block_bits / 8  | Cache words                                               |
+                 *
+                 * The header tells hash functions of different constructions or sizes apart, but not the
+                 * ones which only differ in their compressor, such as MD4 and MD5.
+                 */
+                template<typename Hash>
+                struct hash_checkpoint {
+                    typedef accumulators::impl::hash_impl<Hash> impl_type;
+                    typedef typename impl_type::checkpoint_type checkpoint_type;
+
+                    typedef typename Hash::construction::type construction_type;
+                    typedef typename construction_type::word_type word_type;
+
+                    constexpr static const std::uint8_t version = 1;
+                    constexpr static const std::uint8_t kind = construction_kind<construction_type>::value;
+
+                    constexpr static const std::size_t word_bits = construction_type::word_bits;
+                    constexpr static const std::size_t word_octets = word_bits / octet_bits;
+                    constexpr static const std::size_t state_words = construction_type::state_words;
+                    constexpr static const std::size_t block_words = construction_type::block_words;
+
+                    BOOST_STATIC_ASSERT(kind != 0);
+                    BOOST_STATIC_ASSERT(word_bits % octet_bits == 0);
+                    BOOST_STATIC_ASSERT(std::tuple_size<typename construction_type::state_type>::value ==
+                                        state_words);
+                    BOOST_STATIC_ASSERT(std::tuple_size<typename construction_type::block_type>::value ==
+                                        block_words);
+
+                    constexpr static const std::size_t header_octets = 4 + 1 + 1 + 4 * 4;
+                    constexpr static const std::size_t size =
+                        header_octets + 1 + 8 + (state_words + block_words) * word_octets;
+
+                    typedef std::array<octet_type, size> buffer_type;
+
+                    static buffer_type header() {
+                        buffer_type b = {'C', '3', 'H', 'S', version, kind};
+                        octet_type *p = b.data() + 6;
+                        p = put(p, std::uint64_t(construction_type::digest_bits), 4);
+                        p = put(p, std::uint64_t(word_bits), 4);
+                        p = put(p, std::uint64_t(construction_type::block_bits), 4);
+                        put(p, std::uint64_t(construction_type::state_bits), 4);
+                        return b;
+                    }
+
+                    static buffer_type save(const checkpoint_type &c) {
+                        buffer_type b = header();
+                        octet_type *p = b.data() + header_octets;
+                        *p++ = c.filled;
+                        p = put(p, std::uint64_t(c.total_seen), 8);
+                        for (word_type w : c.state) {
+                            p = put(p, w, word_octets);
+                        }
+                        for (word_type w : c.cache) {
+                            p = put(p, w, word_octets);
+                        }
+                        return b;
+                    }
+
+                    static checkpoint_type load(const buffer_type &b) {
+                        buffer_type h = header();
+                        if (!std::equal(h.begin(), h.begin() + header_octets, b.begin()) || b[header_octets] > 1) {
+                            BOOST_THROW_EXCEPTION(bad_hash_state());
+                        }
+
+                        checkpoint_type c;
+                        const octet_type *p = b.data() + header_octets;
+                        c.filled = *p++;
+                        std::uint64_t total_seen = get(p, 8);
+                        p += 8;
+                        // A cache can only be filled with a whole block
+                        if (total_seen > std::numeric_limits<std::size_t>::max() ||
+                            (c.filled && (!total_seen || total_seen % construction_type::block_bits))) {
+                            BOOST_THROW_EXCEPTION(bad_hash_state());
+                        }
+                        c.total_seen = static_cast<std::size_t>(total_seen);
+                        for (word_type &w : c.state) {
+                            w = static_cast<word_type>(get(p, word_octets));
+                            p += word_octets;
+                        }
+                        for (word_type &w : c.cache) {
+                            w = static_cast<word_type>(get(p, word_octets));
+                            p += word_octets;
+                        }
+                        return c;
+                    }
+
+                private:
+                    static octet_type *put(octet_type *p, std::uint64_t v, std::size_t octets) {
+                        for (std::size_t i = 0; i != octets; ++i, v >>= octet_bits) {
+                            *p++ = static_cast<octet_type>(v);
+                        }
+                        return p;
+                    }
+
+                    static std::uint64_t get(const octet_type *p, std::size_t octets) {
+                        std::uint64_t v = 0;
+                        for (std::size_t i = octets; i != 0; --i) {
+                            v = (v << octet_bits) | p[i - 1];
+                        }
+                        return v;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+
+        /*!
+         * @brief Amount of octets the state of a Hash accumulator set is saved into
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         */
+        template<typename Hash>
+        constexpr std::size_t saved_state_size() {
+            return hashes::detail::hash_checkpoint<Hash>::size;
+        }
+
+        /*!
+         * @brief Saves the state of a partially hashed stream, so that it may be resumed with load_state,
+         * possibly by another process or on another machine. To fork a stream within the process, copy the
+         * accumulator set instead.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         * @tparam AccumulatorSet Accumulator set of Hash
+         * @tparam OutputIterator Octet output iterator
+         *
+         * @param acc Accumulator set the stream is hashed with
+         * @param out Receives saved_state_size<Hash>() octets
+         *
+         * @return Output iterator past the last octet written
+         */
+        template<typename Hash, typename AccumulatorSet, typename OutputIterator>
+        OutputIterator save_state(const AccumulatorSet &acc, OutputIterator out) {
+            typedef hashes::detail::hash_checkpoint<Hash> checkpoint_type;
+
+            typename checkpoint_type::buffer_type b = checkpoint_type::save(
+                boost::accumulators::find_accumulator<accumulators::tag::hash<Hash>>(acc).checkpoint());
+            return std::copy(b.begin(), b.end(), out);
+        }
+
+        /*!
+         * @brief Saves the state of a partially hashed stream
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         * @tparam AccumulatorSet Accumulator set of Hash
+         *
+         * @param acc Accumulator set the stream is hashed with
+         *
+         * @return Saved state, saved_state_size<Hash>() octets long
+         */
+        template<typename Hash, typename AccumulatorSet>
+        std::vector<octet_type> save_state(const AccumulatorSet &acc) {
+            std::vector<octet_type> v(saved_state_size<Hash>());
+            save_state<Hash>(acc, v.begin());
+            return v;
+        }
+
+        /*!
+         * @brief Resumes a stream saved with save_state. Hashing into the accumulator set then goes on as
+         * if it had been fed everything the saved one had.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         * @tparam AccumulatorSet Accumulator set of Hash
+         * @tparam InputIterator Octet input iterator
+         *
+         * @param acc Accumulator set to resume the stream in, whatever it has been fed is discarded
+         * @param first Beginning of the saved state
+         * @param last End of the input, only saved_state_size<Hash>() octets are read
+         *
+         * @return Input iterator past the last octet read
+         *
+         * @throws bad_hash_state if the saved state is truncated or does not match Hash, acc is left intact
+         */
+        template<typename Hash, typename AccumulatorSet, typename InputIterator>
+        InputIterator load_state(AccumulatorSet &acc, InputIterator first, InputIterator last) {
+            typedef hashes::detail::hash_checkpoint<Hash> checkpoint_type;
+
+            typename checkpoint_type::buffer_type b;
+            for (octet_type &o : b) {
+                if (first == last) {
+                    BOOST_THROW_EXCEPTION(hashes::bad_hash_state());
+                }
+                o = static_cast<octet_type>(*first++);
+            }
+
+            boost::accumulators::find_accumulator<accumulators::tag::hash<Hash>>(acc).resume(
+                checkpoint_type::load(b));
+            return first;
+        }
+
+        /*!
+         * @brief Resumes a stream saved with save_state
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash Hash function
+         * @tparam AccumulatorSet Accumulator set of Hash
+         * @tparam SinglePassRange Octet range
+         *
+         * @param acc Accumulator set to resume the stream in, whatever it has been fed is discarded
+         * @param r Saved state
+         *
+         * @throws bad_hash_state if the saved state is truncated or does not match Hash, acc is left intact
+         */
+        template<typename Hash, typename AccumulatorSet, typename SinglePassRange>
+        void load_state(AccumulatorSet &acc, const SinglePassRange &r) {
+            load_state<Hash>(acc, boost::begin(r), boost::end(r));
+        }
+    }    // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_CHECKPOINT_HPP
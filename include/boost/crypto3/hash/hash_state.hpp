@@ -18,6 +18,11 @@
 
 namespace boost {
     namespace crypto3 {
+        /*!
+         * @brief Hashes a stream piece by piece. Accumulator sets are plain values of a fixed size, so copying
+         * one forks the stream in constant time, and each copy may be fed a different suffix. To carry a
+         * stream over to another process, see save_state and load_state.
+         */
         template<typename Hash, typename = typename std::enable_if<detail::is_hash<Hash>::value>::type>
         using accumulator_set =
             boost::accumulators::accumulator_set<static_digest<Hash::digest_bits>,
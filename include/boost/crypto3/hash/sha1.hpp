@@ -14,6 +14,7 @@
 #include <boost/crypto3/hash/detail/sha1/sha1_policy.hpp>
 #include <boost/crypto3/hash/detail/state_adder.hpp>
 #include <boost/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <boost/crypto3/hash/detail/sha_ni_compressor.hpp>
 #include <boost/crypto3/hash/detail/merkle_damgard_construction.hpp>
 #include <boost/crypto3/hash/detail/block_stream_processor.hpp>
 #include <boost/crypto3/hash/detail/merkle_damgard_padding.hpp>
@@ -51,7 +52,8 @@ namespace boost {
                     };
 
                     typedef merkle_damgard_construction<params_type, typename policy_type::iv_generator,
-                                                        davies_meyer_compressor<block_cipher_type, detail::state_adder>,
+                                                        detail::sha_ni_compressor<davies_meyer_compressor<block_cipher_type, detail::state_adder>,
+                                                                                  typename policy_type::ni_impl_type>,
                                                         detail::merkle_damgard_padding<policy_type>>
                         type;
                 };
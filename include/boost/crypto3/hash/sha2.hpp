@@ -12,8 +12,7 @@
 #define CRYPTO3_HASH_SHA2_HPP
 
 #include <boost/crypto3/hash/detail/sha2/sha2_policy.hpp>
-#include <boost/crypto3/hash/detail/state_adder.hpp>
-#include <boost/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <boost/crypto3/hash/detail/sha_ni_compressor.hpp>
 #include <boost/crypto3/hash/detail/merkle_damgard_construction.hpp>
 #include <boost/crypto3/hash/detail/block_stream_processor.hpp>
 #include <boost/crypto3/hash/detail/merkle_damgard_padding.hpp>
@@ -53,7 +52,8 @@ namespace boost {
                     };
 
                     typedef merkle_damgard_construction<params_type, typename policy_type::iv_generator,
-                                                        davies_meyer_compressor<block_cipher_type, detail::state_adder>,
+                                                        detail::sha_ni_compressor<typename policy_type::compressor_type,
+                                                                                  typename policy_type::ni_impl_type>,
                                                         detail::merkle_damgard_padding<policy_type>>
                         type;
                 };
@@ -0,0 +1,321 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_SHAKE_HPP
+#define CRYPTO3_HASH_SHAKE_HPP
+
+#include <boost/crypto3/hash/sha3.hpp>
+#include <boost/crypto3/hash/detail/shake/shake_policy.hpp>
+
+#include <boost/crypto3/detail/type_traits.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace boost {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief SHAKE extendable-output function used as a fixed output length hash,
+             * with the output length of twice the security level. Use shake_xof for
+             * arbitrary-length output or cSHAKE.
+             * @tparam Version Security level, i.e. 128 or 256
+             * @ingroup hashes
+             */
+            template<std::size_t Version = 256>
+            class shake {
+                typedef detail::shake_policy<Version> policy_type;
+
+            public:
+                constexpr static const std::size_t version = Version;
+
+                constexpr static const std::size_t word_bits = policy_type::word_bits;
+                typedef typename policy_type::word_type word_type;
+
+                constexpr static const std::size_t block_bits = policy_type::block_bits;
+                constexpr static const std::size_t block_words = policy_type::block_words;
+                typedef typename policy_type::block_type block_type;
+
+                constexpr static const std::size_t digest_bits = policy_type::digest_bits;
+                typedef typename policy_type::digest_type digest_type;
+
+                struct construction {
+                    struct params_type {
+                        typedef typename policy_type::digest_endian digest_endian;
+
+                        constexpr static const std::size_t length_bits = policy_type::length_bits;
+                        constexpr static const std::size_t digest_bits = policy_type::digest_bits;
+                    };
+
+                    typedef sponge_construction<params_type, typename policy_type::iv_generator,
+                                                sha3_compressor<Version>, detail::sha3_padding<policy_type>,
+                                                detail::sha3_finalizer<policy_type>>
+                        type;
+                };
+
+                template<typename StateAccumulator, std::size_t ValueBits>
+                struct stream_processor {
+                    struct params_type {
+                        typedef typename policy_type::digest_endian digest_endian;
+
+                        constexpr static const std::size_t value_bits = ValueBits;
+                    };
+                    typedef block_stream_processor<construction, StateAccumulator, params_type> type;
+                };
+            };
+
+            /*!
+             * @brief SHAKE and cSHAKE extendable-output functions (FIPS 202, NIST SP 800-185).
+             * Input octets are absorbed with update, arbitrary amount of output octets is
+             * read with consecutive squeeze calls. Absorbing is not allowed after the first
+             * squeeze until reset.
+             *
+             * @tparam Version Security level, i.e. 128 or 256
+             * @ingroup hashes
+             *
+             * @code
+             * shake_xof<128> xof(std::string(), std::string("Email Signature"));
+             * xof.update(message);
+             * std::vector<std::uint8_t> mask(n);
+             * xof.squeeze(mask.begin(), mask.size());
+             * @endcode
+             */
+            template<std::size_t Version = 256>
+            class shake_xof {
+                typedef detail::shake_policy<Version> policy_type;
+                typedef detail::cshake_policy<Version> cshake_policy_type;
+
+                typedef typename shake<Version>::construction::type construction_type;
+
+            public:
+                constexpr static const std::size_t version = Version;
+
+                constexpr static const std::size_t word_bits = policy_type::word_bits;
+                constexpr static const std::size_t word_bytes = word_bits / octet_bits;
+                typedef typename policy_type::word_type word_type;
+
+                constexpr static const std::size_t state_words = policy_type::state_words;
+                typedef typename policy_type::state_type state_type;
+
+                constexpr static const std::size_t block_bits = policy_type::block_bits;
+                constexpr static const std::size_t block_bytes = block_bits / octet_bits;
+                constexpr static const std::size_t block_words = policy_type::block_words;
+                typedef typename policy_type::block_type block_type;
+
+                /*!
+                 * @brief Constructs SHAKE
+                 */
+                shake_xof() : cshake(false) {
+                    reset();
+                }
+
+                /*!
+                 * @brief Constructs cSHAKE with function name and customization string. Falls back
+                 * to SHAKE in case both are empty.
+                 */
+                template<typename SinglePassRange1, typename SinglePassRange2>
+                shake_xof(const SinglePassRange1 &function_name, const SinglePassRange2 &customization) :
+                    cshake(false) {
+                    reset();
+
+                    if (boost::begin(function_name) != boost::end(function_name) ||
+                        boost::begin(customization) != boost::end(customization)) {
+                        cshake = true;
+
+                        // bytepad(encode_string(N) || encode_string(S), rate)
+                        left_encode(block_bytes);
+                        encode_string(boost::begin(function_name), boost::end(function_name));
+                        encode_string(boost::begin(customization), boost::end(customization));
+                        if (position) {
+                            process_cache();
+                        }
+
+                        initial_sponge = sponge;
+                    }
+                }
+
+                /*!
+                 * @brief Restores the state right after construction
+                 */
+                void reset() {
+                    sponge = initial_sponge;
+                    cache.fill(0);
+                    position = 0;
+                    squeezing = false;
+                }
+
+                template<typename InputIterator>
+                shake_xof &update(InputIterator first, InputIterator last) {
+                    BOOST_ASSERT(!squeezing);
+
+                    typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+                    update(first, last,
+                           std::integral_constant<bool,
+                                                  ::boost::crypto3::detail::is_contiguous_iterator<InputIterator>::value &&
+                                                      sizeof(value_type) == 1>());
+                    return *this;
+                }
+
+                template<typename SinglePassRange>
+                shake_xof &update(const SinglePassRange &r) {
+                    return update(boost::begin(r), boost::end(r));
+                }
+
+                /*!
+                 * @brief Writes next n output octets
+                 * @return Output iterator past the last written octet
+                 */
+                template<typename OutputIterator>
+                OutputIterator squeeze(OutputIterator out, std::size_t n) {
+                    if (!squeezing) {
+                        finalize();
+                    }
+
+                    while (n) {
+                        if (position == block_bytes) {
+                            // Absorbing a zero block is a bare permutation
+                            sponge.process_block(block_type());
+                            position = 0;
+                        }
+
+                        const state_type &state = sponge.state();
+                        if (!(position % word_bytes) && n >= word_bytes) {
+                            std::size_t words = std::min(n, block_bytes - position) / word_bytes;
+                            for (std::size_t i = position / word_bytes; words--; ++i) {
+                                for (std::size_t j = word_bytes; j--;) {
+                                    *out++ = static_cast<octet_type>(state[i] >> (j * octet_bits));
+                                }
+                                position += word_bytes;
+                                n -= word_bytes;
+                            }
+                        } else {
+                            *out++ = static_cast<octet_type>(state[position / word_bytes] >> octet_shift(position));
+                            ++position;
+                            --n;
+                        }
+                    }
+
+                    return out;
+                }
+
+            private:
+                /// Whole blocks absorbed with a single process_blocks call at most
+                constexpr static const std::size_t bulk_blocks = 8;
+
+                /*!
+                 * @brief Shift of octet i within its word. Sponge words hold the stream octets most
+                 * significant first, as block_stream_processor packs them.
+                 */
+                constexpr static std::size_t octet_shift(std::size_t i) {
+                    return (word_bytes - 1 - i % word_bytes) * octet_bits;
+                }
+
+                inline void process_cache() {
+                    sponge.process_block(cache);
+                    cache.fill(0);
+                    position = 0;
+                }
+
+                inline void absorb(octet_type x) {
+                    cache[position / word_bytes] |= word_type(x) << octet_shift(position);
+                    if (++position == block_bytes) {
+                        process_cache();
+                    }
+                }
+
+                template<typename InputIterator>
+                inline void update(InputIterator first, InputIterator last, std::false_type) {
+                    for (; first != last; ++first) {
+                        absorb(static_cast<octet_type>(*first));
+                    }
+                }
+
+                template<typename InputIterator>
+                inline void update(InputIterator first, InputIterator last, std::true_type) {
+                    std::size_t n = std::distance(first, last);
+                    if (!n) {
+                        return;
+                    }
+                    const unsigned char *p = reinterpret_cast<const unsigned char *>(&*first);
+
+                    for (; n && position; --n) {
+                        absorb(*p++);
+                    }
+
+                    // Whole blocks go straight from the input to the sponge bulk path
+                    block_type blocks[bulk_blocks];
+                    while (n >= block_bytes) {
+                        std::size_t k = std::min(n / block_bytes, std::size_t(bulk_blocks));
+                        for (std::size_t i = 0; i != k; ++i) {
+                            for (std::size_t j = 0; j != block_words; ++j, p += word_bytes) {
+                                word_type w;
+                                std::memcpy(&w, p, word_bytes);
+                                blocks[i][j] = boost::endian::big_to_native(w);
+                            }
+                        }
+                        sponge.process_blocks(blocks, k);
+                        n -= k * block_bytes;
+                    }
+
+                    for (; n; --n) {
+                        absorb(*p++);
+                    }
+                }
+
+                void finalize() {
+                    if (cshake) {
+                        sponge.template process_last_block<detail::sha3_padding<cshake_policy_type>>(
+                            cache, position * octet_bits);
+                    } else {
+                        sponge.process_last_block(cache, position * octet_bits);
+                    }
+                    position = 0;
+                    squeezing = true;
+                }
+
+                void left_encode(std::size_t x) {
+                    octet_type encoded[sizeof(std::size_t)];
+                    std::size_t n = 0;
+                    do {
+                        encoded[n++] = static_cast<octet_type>(x);
+                        x >>= octet_bits;
+                    } while (x);
+
+                    absorb(static_cast<octet_type>(n));
+                    while (n) {
+                        absorb(encoded[--n]);
+                    }
+                }
+
+                template<typename InputIterator>
+                void encode_string(InputIterator first, InputIterator last) {
+                    left_encode(static_cast<std::size_t>(std::distance(first, last)) * octet_bits);
+                    for (; first != last; ++first) {
+                        absorb(static_cast<octet_type>(*first));
+                    }
+                }
+
+                construction_type sponge;
+                construction_type initial_sponge;
+                block_type cache;
+                std::size_t position;
+                bool squeezing;
+                bool cshake;
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_HASH_SHAKE_HPP
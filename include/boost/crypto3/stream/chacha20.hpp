@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_STREAM_CHACHA20_HPP
+#define CRYPTO3_STREAM_CHACHA20_HPP
+
+#include <boost/crypto3/detail/stream_endian.hpp>
+#include <boost/crypto3/detail/secure_zero.hpp>
+
+#include <boost/crypto3/block/detail/block_stream_processor.hpp>
+
+#include <boost/crypto3/stream/detail/cipher_modes.hpp>
+
+#include <boost/crypto3/stream/detail/chacha20/chacha20_backend.hpp>
+#include <boost/crypto3/stream/detail/chacha20/chacha20_impl.hpp>
+
+#ifdef CRYPTO3_STREAM_HAS_CHACHA20_X86
+
+#include <boost/crypto3/stream/detail/chacha20/chacha20_sse2_impl.hpp>
+#include <boost/crypto3/stream/detail/chacha20/chacha20_avx2_impl.hpp>
+
+#endif
+
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace boost {
+    namespace crypto3 {
+        namespace stream {
+            /*!
+             * @brief ChaCha20 stream cipher of RFC 8439 with a 96-bit nonce and a 32-bit block counter.
+             *
+             * @ingroup stream
+             *
+             * The cipher holds the key only, nonce and counter are passed to every call, so a keyed
+             * cipher may be shared by any amount of messages and threads. Keystream is generated by
+             * the SSE2 or AVX2 kernels, four or eight blocks at once, when the processor has them.
+             * The 512-bit keystream blocks make it usable with the block accumulator through
+             * modes::keystream and chacha20_poly1305.
+             *
+             * @code
+             * typedef stream::modes::keystream<stream::chacha20> mode_type;
+             * typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+             *
+             * block::accumulator_set<encryption_mode> acc(encryption_mode(stream::chacha20(key), nonce, 1));
+             * encrypt<stream::chacha20>(plaintext, acc);
+             * @endcode
+             */
+            class chacha20 {
+                typedef detail::chacha20_impl portable_impl_type;
+#ifdef CRYPTO3_STREAM_HAS_CHACHA20_X86
+                typedef detail::chacha20_sse2_impl sse2_impl_type;
+                typedef detail::chacha20_avx2_impl avx2_impl_type;
+#endif
+
+                typedef portable_impl_type::state_type state_type;
+
+            public:
+                constexpr static const std::size_t key_bits = 256;
+                typedef std::array<std::uint8_t, key_bits / 8> key_type;
+
+                constexpr static const std::size_t nonce_bits = 96;
+                typedef std::array<std::uint8_t, nonce_bits / 8> nonce_type;
+
+                constexpr static const std::size_t word_bits = 32;
+                typedef std::uint32_t word_type;
+
+                constexpr static const std::size_t block_bits = 512;
+                constexpr static const std::size_t block_words = block_bits / word_bits;
+                typedef std::array<std::uint8_t, block_bits / 8> block_type;
+
+                BOOST_STATIC_ASSERT(sizeof(block_type) == portable_impl_type::block_bytes);
+
+                template<class Mode, typename StateAccumulator, std::size_t ValueBits>
+                struct stream_processor {
+                    struct params_type {
+                        constexpr static const std::size_t value_bits = ValueBits;
+                        constexpr static const std::size_t length_bits = word_bits * 2;
+                    };
+
+                    typedef block::block_stream_processor<Mode, StateAccumulator, params_type> type;
+                };
+
+                typedef typename stream_endian::little_octet_big_bit endian_type;
+
+                /*!
+                 * @param key Cipher key
+                 * @param backend Implementation to use, the fastest one the processor supports by default.
+                 *
+                 * @throws std::invalid_argument if the backend is not available on this processor, see
+                 * is_available
+                 */
+                explicit chacha20(const key_type &key, chacha20_backend backend = chacha20_backend::automatic) :
+                    selected_backend(detail::select_chacha20_backend(backend)) {
+                    if (!detail::is_chacha20_backend_available(selected_backend)) {
+                        throw std::invalid_argument("chacha20 backend is not available on this processor");
+                    }
+                    for (std::size_t i = 0; i != key_words.size(); ++i) {
+                        key_words[i] = portable_impl_type::load_le(key.data() + 4 * i);
+                    }
+                }
+
+                ~chacha20() {
+                    ::boost::crypto3::detail::secure_zero(key_words.data(), key_words.size());
+                }
+
+                /*!
+                 * @brief Whether the backend can be requested on this processor
+                 */
+                static bool is_available(chacha20_backend backend) {
+                    return detail::is_chacha20_backend_available(detail::select_chacha20_backend(backend));
+                }
+
+                /*!
+                 * @brief Backend selected on construction
+                 */
+                chacha20_backend backend() const {
+                    return selected_backend;
+                }
+
+                /*!
+                 * @brief XORs n blocks of keystream into in and writes them to out, which may be the same.
+                 * Block i is generated with counter + i modulo 2^32, modes::keystream is the one to keep a
+                 * message from wrapping the counter around.
+                 */
+                void process_blocks(const nonce_type &nonce, std::uint32_t counter, const block_type *in,
+                                    block_type *out, std::size_t n) const {
+                    state_type state = initial_state(nonce, counter);
+                    const std::uint8_t *i = reinterpret_cast<const std::uint8_t *>(in);
+                    std::uint8_t *o = reinterpret_cast<std::uint8_t *>(out);
+
+                    switch (selected_backend) {
+#ifdef CRYPTO3_STREAM_HAS_CHACHA20_X86
+                        case chacha20_backend::avx2:
+                            avx2_impl_type::process_blocks(state, i, o, n);
+                            break;
+                        case chacha20_backend::sse2:
+                            sse2_impl_type::process_blocks(state, i, o, n);
+                            break;
+#endif
+                        default:
+                            portable_impl_type::process_blocks(state, i, o, n);
+                    }
+                    ::boost::crypto3::detail::secure_zero(state.data(), state.size());
+                }
+
+                /*!
+                 * @brief Keystream block of the nonce and the counter
+                 */
+                block_type keystream(const nonce_type &nonce, std::uint32_t counter) const {
+                    block_type block = block_type();
+                    process_blocks(nonce, counter, &block, &block, 1);
+                    return block;
+                }
+
+            protected:
+                state_type initial_state(const nonce_type &nonce, std::uint32_t counter) const {
+                    // "expand 32-byte k"
+                    state_type state = {{0x61707865, 0x3320646e, 0x79622d32, 0x6b206574}};
+                    for (std::size_t i = 0; i != key_words.size(); ++i) {
+                        state[4 + i] = key_words[i];
+                    }
+                    state[portable_impl_type::counter_word] = counter;
+                    for (std::size_t i = 0; i != 3; ++i) {
+                        state[13 + i] = portable_impl_type::load_le(nonce.data() + 4 * i);
+                    }
+                    return state;
+                }
+
+                std::array<std::uint32_t, key_bits / word_bits> key_words;
+                chacha20_backend selected_backend;
+            };
+        }    // namespace stream
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_STREAM_CHACHA20_HPP
@@ -0,0 +1,42 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_STREAM_CHACHA20_POLY1305_HPP
+#define CRYPTO3_STREAM_CHACHA20_POLY1305_HPP
+
+#include <boost/crypto3/stream/chacha20.hpp>
+#include <boost/crypto3/stream/poly1305.hpp>
+
+#include <boost/crypto3/stream/detail/cipher_modes.hpp>
+
+namespace boost {
+    namespace crypto3 {
+        namespace stream {
+            /*!
+             * @brief AEAD_CHACHA20_POLY1305 of RFC 8439, a 256-bit key, a 96-bit nonce and a 128-bit tag.
+             *
+             * @ingroup stream
+             *
+             * @code
+             * typedef stream::chacha20_poly1305::bind<stream::chacha20_poly1305::encryption_policy>::type mode_type;
+             *
+             * mode_type mode(stream::chacha20(key), nonce);
+             * mode.process_aad(aad);
+             *
+             * block::accumulator_set<mode_type> acc(mode);
+             * encrypt<stream::chacha20>(plaintext, acc);
+             * // Ciphertext followed by the tag
+             * auto sealed = accumulators::extract::block<mode_type>(acc);
+             * @endcode
+             */
+            typedef modes::poly1305_aead<chacha20> chacha20_poly1305;
+        }    // namespace stream
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_STREAM_CHACHA20_POLY1305_HPP
@@ -0,0 +1,149 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_STREAM_CHACHA20_AVX2_IMPL_HPP
+#define CRYPTO3_STREAM_CHACHA20_AVX2_IMPL_HPP
+
+#include <boost/crypto3/stream/detail/chacha20/chacha20_backend.hpp>
+#include <boost/crypto3/stream/detail/chacha20/chacha20_impl.hpp>
+#include <boost/crypto3/stream/detail/chacha20/chacha20_sse2_impl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CRYPTO3_STREAM_HAS_CHACHA20_X86
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace stream {
+            namespace detail {
+#ifdef CRYPTO3_STREAM_HAS_CHACHA20_X86
+                /*!
+                 * @brief ChaCha20 on eight blocks at once, laid out as in chacha20_sse2_impl. Rotations by
+                 * 16 and 8 bits are byte shuffles. After the in-lane transposition the low and the high
+                 * halves of a register belong to blocks four apart and are recombined across lanes.
+                 */
+                struct chacha20_avx2_impl {
+                    typedef chacha20_impl::state_type state_type;
+
+                    constexpr static const std::size_t block_bytes = chacha20_impl::block_bytes;
+                    constexpr static const std::size_t parallel_blocks = 8;
+
+                    static bool is_available() {
+                        return cpuid::has_avx2();
+                    }
+
+                    /*!
+                     * @brief Same as chacha20_impl::process_blocks, a tail shorter than parallel_blocks is
+                     * left to the SSE2 and the portable implementations
+                     */
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static void process_blocks(const state_type &input, const std::uint8_t *in, std::uint8_t *out,
+                                               std::size_t n) {
+                        state_type s = input;
+                        for (; n >= parallel_blocks; n -= parallel_blocks) {
+                            process_parallel(s, in, out);
+                            s[chacha20_impl::counter_word] += parallel_blocks;
+                            in += parallel_blocks * block_bytes;
+                            out += parallel_blocks * block_bytes;
+                        }
+                        chacha20_sse2_impl::process_blocks(s, in, out, n);
+                    }
+
+                protected:
+                    template<int N>
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i rotl(__m256i x) {
+                        return _mm256_or_si256(_mm256_slli_epi32(x, N), _mm256_srli_epi32(x, 32 - N));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline void quarter_round(__m256i &a, __m256i &b, __m256i &c, __m256i &d) {
+                        const __m256i rot16 = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+                                                              13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+                        const __m256i rot8 = _mm256_set_epi8(14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3,
+                                                             14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3);
+
+                        a = _mm256_add_epi32(a, b);
+                        d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rot16);
+                        c = _mm256_add_epi32(c, d);
+                        b = rotl<12>(_mm256_xor_si256(b, c));
+                        a = _mm256_add_epi32(a, b);
+                        d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rot8);
+                        c = _mm256_add_epi32(c, d);
+                        b = rotl<7>(_mm256_xor_si256(b, c));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline void process_parallel(const state_type &s, const std::uint8_t *in,
+                                                        std::uint8_t *out) {
+                        __m256i input[16], x[16];
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            input[i] = _mm256_set1_epi32(static_cast<int>(s[i]));
+                        }
+                        input[chacha20_impl::counter_word] = _mm256_add_epi32(input[chacha20_impl::counter_word],
+                                                                              _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            x[i] = input[i];
+                        }
+
+                        for (std::size_t i = 0; i != chacha20_impl::double_rounds; ++i) {
+                            quarter_round(x[0], x[4], x[8], x[12]);
+                            quarter_round(x[1], x[5], x[9], x[13]);
+                            quarter_round(x[2], x[6], x[10], x[14]);
+                            quarter_round(x[3], x[7], x[11], x[15]);
+                            quarter_round(x[0], x[5], x[10], x[15]);
+                            quarter_round(x[1], x[6], x[11], x[12]);
+                            quarter_round(x[2], x[7], x[8], x[13]);
+                            quarter_round(x[3], x[4], x[9], x[14]);
+                        }
+
+                        // rows[g][j] holds words 4g to 4g + 3 of block j in the low lane, of block j + 4 in the
+                        // high one
+                        __m256i rows[4][4];
+                        for (std::size_t g = 0; g != 4; ++g) {
+                            __m256i a = _mm256_add_epi32(x[4 * g], input[4 * g]);
+                            __m256i b = _mm256_add_epi32(x[4 * g + 1], input[4 * g + 1]);
+                            __m256i c = _mm256_add_epi32(x[4 * g + 2], input[4 * g + 2]);
+                            __m256i d = _mm256_add_epi32(x[4 * g + 3], input[4 * g + 3]);
+
+                            __m256i ab_lo = _mm256_unpacklo_epi32(a, b), cd_lo = _mm256_unpacklo_epi32(c, d);
+                            __m256i ab_hi = _mm256_unpackhi_epi32(a, b), cd_hi = _mm256_unpackhi_epi32(c, d);
+
+                            rows[g][0] = _mm256_unpacklo_epi64(ab_lo, cd_lo);
+                            rows[g][1] = _mm256_unpackhi_epi64(ab_lo, cd_lo);
+                            rows[g][2] = _mm256_unpacklo_epi64(ab_hi, cd_hi);
+                            rows[g][3] = _mm256_unpackhi_epi64(ab_hi, cd_hi);
+                        }
+
+                        for (std::size_t j = 0; j != 4; ++j) {
+                            std::size_t low = j * block_bytes, high = (j + 4) * block_bytes;
+                            xor_store(in, out, low, _mm256_permute2x128_si256(rows[0][j], rows[1][j], 0x20));
+                            xor_store(in, out, low + 32, _mm256_permute2x128_si256(rows[2][j], rows[3][j], 0x20));
+                            xor_store(in, out, high, _mm256_permute2x128_si256(rows[0][j], rows[1][j], 0x31));
+                            xor_store(in, out, high + 32, _mm256_permute2x128_si256(rows[2][j], rows[3][j], 0x31));
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline void xor_store(const std::uint8_t *in, std::uint8_t *out, std::size_t offset,
+                                                 __m256i keystream) {
+                        __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + offset));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + offset),
+                                            _mm256_xor_si256(m, keystream));
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace stream
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_STREAM_CHACHA20_AVX2_IMPL_HPP
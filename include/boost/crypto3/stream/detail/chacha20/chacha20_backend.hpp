@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_STREAM_CHACHA20_BACKEND_HPP
+#define CRYPTO3_STREAM_CHACHA20_BACKEND_HPP
+
+#include <boost/predef/architecture.h>
+
+#include <boost/crypto3/detail/config.hpp>
+
+#include <boost/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_STREAM_HAS_CHACHA20_X86
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace stream {
+            /*!
+             * @brief ChaCha20 implementations selectable at runtime. The x86 ones are compiled in with
+             * per-function target attributes and picked through cpuid, so CRYPTO3_CLEAR_CPUID
+             * (e.g. CRYPTO3_CLEAR_CPUID=avx2,sse2) masks them as well.
+             */
+            enum class chacha20_backend {
+                /// The fastest backend the processor supports
+                automatic,
+                /// Portable implementation, one block at a time
+                portable,
+                /// Four blocks at once, a block per 32-bit lane
+                sse2,
+                /// Eight blocks at once, a block per 32-bit lane
+                avx2
+            };
+
+            namespace detail {
+                /*!
+                 * @brief Whether the backend is compiled in and supported by the processor
+                 */
+                inline bool is_chacha20_backend_available(chacha20_backend backend) {
+                    switch (backend) {
+                        case chacha20_backend::automatic:
+                        case chacha20_backend::portable:
+                            return true;
+#ifdef CRYPTO3_STREAM_HAS_CHACHA20_X86
+                        case chacha20_backend::sse2:
+                            return cpuid::has_sse2();
+                        case chacha20_backend::avx2:
+                            return cpuid::has_avx2();
+#endif
+                        default:
+                            return false;
+                    }
+                }
+
+                /*!
+                 * @brief Resolves automatic to the fastest available backend
+                 */
+                inline chacha20_backend select_chacha20_backend(chacha20_backend backend) {
+                    if (backend != chacha20_backend::automatic) {
+                        return backend;
+                    }
+                    const chacha20_backend preferred[] = {chacha20_backend::avx2, chacha20_backend::sse2};
+                    for (chacha20_backend b : preferred) {
+                        if (is_chacha20_backend_available(b)) {
+                            return b;
+                        }
+                    }
+                    return chacha20_backend::portable;
+                }
+            }    // namespace detail
+        }        // namespace stream
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_STREAM_CHACHA20_BACKEND_HPP
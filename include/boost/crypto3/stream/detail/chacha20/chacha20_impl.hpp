@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_STREAM_CHACHA20_IMPL_HPP
+#define CRYPTO3_STREAM_CHACHA20_IMPL_HPP
+
+#include <boost/crypto3/detail/basic_functions.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+    namespace crypto3 {
+        namespace stream {
+            namespace detail {
+                /*!
+                 * @brief Portable ChaCha20 block function of RFC 8439, one block at a time
+                 */
+                struct chacha20_impl {
+                    typedef ::boost::crypto3::detail::basic_functions<32> policy_type;
+
+                    /*!
+                     * @brief Input words: constants, key, block counter, nonce
+                     */
+                    typedef std::array<std::uint32_t, 16> state_type;
+
+                    constexpr static const std::size_t block_bytes = 64;
+                    constexpr static const std::size_t double_rounds = 10;
+                    constexpr static const std::size_t counter_word = 12;
+
+                    static inline std::uint32_t load_le(const std::uint8_t *p) {
+                        return std::uint32_t(p[0]) | std::uint32_t(p[1]) << 8 | std::uint32_t(p[2]) << 16 |
+                               std::uint32_t(p[3]) << 24;
+                    }
+
+                    static inline void store_le(std::uint8_t *p, std::uint32_t x) {
+                        p[0] = static_cast<std::uint8_t>(x);
+                        p[1] = static_cast<std::uint8_t>(x >> 8);
+                        p[2] = static_cast<std::uint8_t>(x >> 16);
+                        p[3] = static_cast<std::uint8_t>(x >> 24);
+                    }
+
+                    static inline void quarter_round(std::uint32_t &a, std::uint32_t &b, std::uint32_t &c,
+                                                     std::uint32_t &d) {
+                        a += b;
+                        d = policy_type::rotl<16>(d ^ a);
+                        c += d;
+                        b = policy_type::rotl<12>(b ^ c);
+                        a += b;
+                        d = policy_type::rotl<8>(d ^ a);
+                        c += d;
+                        b = policy_type::rotl<7>(b ^ c);
+                    }
+
+                    /*!
+                     * @brief XORs the keystream of n blocks into in and writes it to out, which may be the
+                     * same. Block i uses the counter of the input plus i, wrapping modulo 2^32.
+                     */
+                    static void process_blocks(const state_type &input, const std::uint8_t *in, std::uint8_t *out,
+                                               std::size_t n) {
+                        state_type s = input;
+                        for (; n; --n, in += block_bytes, out += block_bytes) {
+                            state_type x = s;
+                            for (std::size_t i = 0; i != double_rounds; ++i) {
+                                quarter_round(x[0], x[4], x[8], x[12]);
+                                quarter_round(x[1], x[5], x[9], x[13]);
+                                quarter_round(x[2], x[6], x[10], x[14]);
+                                quarter_round(x[3], x[7], x[11], x[15]);
+                                quarter_round(x[0], x[5], x[10], x[15]);
+                                quarter_round(x[1], x[6], x[11], x[12]);
+                                quarter_round(x[2], x[7], x[8], x[13]);
+                                quarter_round(x[3], x[4], x[9], x[14]);
+                            }
+                            for (std::size_t i = 0; i != s.size(); ++i) {
+                                store_le(out + 4 * i, load_le(in + 4 * i) ^ (x[i] + s[i]));
+                            }
+                            ++s[counter_word];
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace stream
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_STREAM_CHACHA20_IMPL_HPP
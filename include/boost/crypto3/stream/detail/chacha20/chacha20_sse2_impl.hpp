@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_STREAM_CHACHA20_SSE2_IMPL_HPP
+#define CRYPTO3_STREAM_CHACHA20_SSE2_IMPL_HPP
+
+#include <boost/crypto3/stream/detail/chacha20/chacha20_backend.hpp>
+#include <boost/crypto3/stream/detail/chacha20/chacha20_impl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CRYPTO3_STREAM_HAS_CHACHA20_X86
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace crypto3 {
+        namespace stream {
+            namespace detail {
+#ifdef CRYPTO3_STREAM_HAS_CHACHA20_X86
+                /*!
+                 * @brief ChaCha20 on four blocks at once. Register i holds the input word i of four
+                 * consecutive blocks, so quarter rounds need no shuffles. The results are transposed
+                 * back into blocks before being XORed into the input.
+                 */
+                struct chacha20_sse2_impl {
+                    typedef chacha20_impl::state_type state_type;
+
+                    constexpr static const std::size_t block_bytes = chacha20_impl::block_bytes;
+                    constexpr static const std::size_t parallel_blocks = 4;
+
+                    static bool is_available() {
+                        return cpuid::has_sse2();
+                    }
+
+                    /*!
+                     * @brief Same as chacha20_impl::process_blocks, a tail shorter than parallel_blocks is
+                     * left to the portable implementation
+                     */
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static void process_blocks(const state_type &input, const std::uint8_t *in, std::uint8_t *out,
+                                               std::size_t n) {
+                        state_type s = input;
+                        for (; n >= parallel_blocks; n -= parallel_blocks) {
+                            process_parallel(s, in, out);
+                            s[chacha20_impl::counter_word] += parallel_blocks;
+                            in += parallel_blocks * block_bytes;
+                            out += parallel_blocks * block_bytes;
+                        }
+                        chacha20_impl::process_blocks(s, in, out, n);
+                    }
+
+                protected:
+                    template<int N>
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static inline __m128i rotl(__m128i x) {
+                        return _mm_or_si128(_mm_slli_epi32(x, N), _mm_srli_epi32(x, 32 - N));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static inline void quarter_round(__m128i &a, __m128i &b, __m128i &c, __m128i &d) {
+                        a = _mm_add_epi32(a, b);
+                        d = rotl<16>(_mm_xor_si128(d, a));
+                        c = _mm_add_epi32(c, d);
+                        b = rotl<12>(_mm_xor_si128(b, c));
+                        a = _mm_add_epi32(a, b);
+                        d = rotl<8>(_mm_xor_si128(d, a));
+                        c = _mm_add_epi32(c, d);
+                        b = rotl<7>(_mm_xor_si128(b, c));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static inline void process_parallel(const state_type &s, const std::uint8_t *in,
+                                                        std::uint8_t *out) {
+                        __m128i input[16], x[16];
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            input[i] = _mm_set1_epi32(static_cast<int>(s[i]));
+                        }
+                        input[chacha20_impl::counter_word] =
+                            _mm_add_epi32(input[chacha20_impl::counter_word], _mm_set_epi32(3, 2, 1, 0));
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            x[i] = input[i];
+                        }
+
+                        for (std::size_t i = 0; i != chacha20_impl::double_rounds; ++i) {
+                            quarter_round(x[0], x[4], x[8], x[12]);
+                            quarter_round(x[1], x[5], x[9], x[13]);
+                            quarter_round(x[2], x[6], x[10], x[14]);
+                            quarter_round(x[3], x[7], x[11], x[15]);
+                            quarter_round(x[0], x[5], x[10], x[15]);
+                            quarter_round(x[1], x[6], x[11], x[12]);
+                            quarter_round(x[2], x[7], x[8], x[13]);
+                            quarter_round(x[3], x[4], x[9], x[14]);
+                        }
+
+                        // Words 4g to 4g + 3 of the four blocks are transposed into a register per block
+                        for (std::size_t g = 0; g != 4; ++g) {
+                            __m128i a = _mm_add_epi32(x[4 * g], input[4 * g]);
+                            __m128i b = _mm_add_epi32(x[4 * g + 1], input[4 * g + 1]);
+                            __m128i c = _mm_add_epi32(x[4 * g + 2], input[4 * g + 2]);
+                            __m128i d = _mm_add_epi32(x[4 * g + 3], input[4 * g + 3]);
+
+                            __m128i ab_lo = _mm_unpacklo_epi32(a, b), cd_lo = _mm_unpacklo_epi32(c, d);
+                            __m128i ab_hi = _mm_unpackhi_epi32(a, b), cd_hi = _mm_unpackhi_epi32(c, d);
+
+                            xor_store(in, out, 0 * block_bytes + 16 * g, _mm_unpacklo_epi64(ab_lo, cd_lo));
+                            xor_store(in, out, 1 * block_bytes + 16 * g, _mm_unpackhi_epi64(ab_lo, cd_lo));
+                            xor_store(in, out, 2 * block_bytes + 16 * g, _mm_unpacklo_epi64(ab_hi, cd_hi));
+                            xor_store(in, out, 3 * block_bytes + 16 * g, _mm_unpackhi_epi64(ab_hi, cd_hi));
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static inline void xor_store(const std::uint8_t *in, std::uint8_t *out, std::size_t offset,
+                                                 __m128i keystream) {
+                        __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + offset));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + offset), _mm_xor_si128(m, keystream));
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace stream
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_STREAM_CHACHA20_SSE2_IMPL_HPP
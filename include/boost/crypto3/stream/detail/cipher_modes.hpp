@@ -0,0 +1,493 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_STREAM_CIPHER_MODES_HPP
+#define CRYPTO3_STREAM_CIPHER_MODES_HPP
+
+#include <boost/crypto3/block/algorithm/block.hpp>
+#include <boost/crypto3/block/detail/cipher_modes.hpp>
+
+#include <boost/crypto3/stream/poly1305.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace boost {
+    namespace crypto3 {
+        namespace stream {
+            /*!
+             * @brief Thrown when a message would need more keystream blocks than the block counter has
+             * left. Wrapping the counter around would reuse the keystream under the same nonce.
+             */
+            struct counter_exhausted : virtual boost::exception, virtual std::exception {};
+
+            namespace detail {
+                template<typename Cipher>
+                struct stream_policy {
+                    typedef std::size_t size_type;
+
+                    typedef Cipher cipher_type;
+                    typedef block::nop_padding<Cipher> padding_type;
+
+                    constexpr static const size_type block_bits = cipher_type::block_bits;
+                    constexpr static const size_type block_words = cipher_type::block_words;
+                    typedef typename cipher_type::block_type block_type;
+
+                    typedef typename cipher_type::endian_type endian_type;
+                };
+
+                template<typename Cipher>
+                struct stream_encryption_policy : public stream_policy<Cipher> {
+                    constexpr static const bool encrypting = true;
+                };
+
+                template<typename Cipher>
+                struct stream_decryption_policy : public stream_policy<Cipher> {
+                    constexpr static const bool encrypting = false;
+                };
+
+                /*!
+                 * @brief Plain stream encryption, the input is XORed with the keystream starting at the
+                 * initial block counter. Runs of pipeline_blocks blocks are XORed by the cipher kernels
+                 * right in the output, single blocks passed by the block accumulator take keystream
+                 * generated pipeline_blocks at a time. Encryption and decryption are the same operation,
+                 * the last partial block is truncated to the input length.
+                 *
+                 * A message may use the blocks from the initial counter up to the counter of all ones,
+                 * going past them throws counter_exhausted and leaves the mode as it was.
+                 */
+                template<typename Policy>
+                class keystream {
+                    typedef Policy policy_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+                    typedef typename cipher_type::nonce_type nonce_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    constexpr static const bool length_preserving = true;
+
+                    constexpr static const size_type pipeline_blocks = 8;
+
+                    /*!
+                     * @param cipher Keyed stream cipher
+                     * @param nonce Nonce, never to be reused with the same key
+                     * @param counter Block counter of the first block
+                     * @throws std::invalid_argument unless nonce is exactly as long as nonce_type
+                     */
+                    template<typename NonceRange>
+                    keystream(const cipher_type &cipher, const NonceRange &nonce, std::uint32_t counter = 0) :
+                        cipher(cipher), counter(counter), blocks_left((std::uint64_t(1) << 32) - counter),
+                        keystream_used(pipeline_blocks) {
+                        std::size_t n = 0;
+                        for (auto it = boost::begin(nonce); it != boost::end(nonce); ++it) {
+                            if (n == iv.size()) {
+                                BOOST_THROW_EXCEPTION(std::invalid_argument("nonce is too long"));
+                            }
+                            iv[n++] = static_cast<std::uint8_t>(*it);
+                        }
+                        if (n != iv.size()) {
+                            BOOST_THROW_EXCEPTION(std::invalid_argument("nonce is too short"));
+                        }
+                    }
+
+                    const nonce_type &nonce() const {
+                        return iv;
+                    }
+
+                    /*!
+                     * @brief Amount of blocks the message may still take before the counter runs out
+                     */
+                    std::uint64_t available_blocks() const {
+                        return blocks_left;
+                    }
+
+                    block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
+                        return process_block(plaintext, total_seen);
+                    }
+
+                    block_type process_block(const block_type &input, std::size_t /*total_seen*/) {
+                        block_type output;
+                        process_blocks(&input, &output, 1);
+                        return output;
+                    }
+
+                    block_type end_message(const block_type &input, std::size_t /*total_seen*/) const {
+                        if (!blocks_left) {
+                            BOOST_THROW_EXCEPTION(counter_exhausted());
+                        }
+                        return xor_block(input, keystream_used == pipeline_blocks ? cipher.keystream(iv, counter) :
+                                                                                    buffer[keystream_used]);
+                    }
+
+                    /*!
+                     * @brief Encrypts or decrypts n whole blocks, in and out may be the same
+                     */
+                    void process_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        if (n > blocks_left) {
+                            BOOST_THROW_EXCEPTION(counter_exhausted());
+                        }
+                        blocks_left -= n;
+
+                        for (; n && keystream_used != pipeline_blocks; --n) {
+                            *out++ = xor_block(*in++, buffer[keystream_used++]);
+                        }
+
+                        std::size_t whole = n - n % pipeline_blocks;
+                        if (whole) {
+                            cipher.process_blocks(iv, counter, in, out, whole);
+                            counter += static_cast<std::uint32_t>(whole);
+                            in += whole;
+                            out += whole;
+                            n -= whole;
+                        }
+
+                        if (n) {
+                            buffer.fill(block_type());
+                            cipher.process_blocks(iv, counter, buffer.data(), buffer.data(), pipeline_blocks);
+                            counter += pipeline_blocks;
+                            for (keystream_used = 0; keystream_used != n; ++keystream_used) {
+                                out[keystream_used] = xor_block(in[keystream_used], buffer[keystream_used]);
+                            }
+                        }
+                    }
+
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        process_blocks(in, out, n);
+                    }
+
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        process_blocks(in, out, n);
+                    }
+
+                protected:
+                    static block_type xor_block(const block_type &a, const block_type &b) {
+                        block_type r;
+                        for (std::size_t i = 0; i != r.size(); ++i) {
+                            r[i] = a[i] ^ b[i];
+                        }
+                        return r;
+                    }
+
+                    cipher_type cipher;
+                    nonce_type iv;
+                    std::uint32_t counter;
+                    std::uint64_t blocks_left;
+
+                    std::array<block_type, pipeline_blocks> buffer;
+                    std::size_t keystream_used;
+                };
+
+                /*!
+                 * @brief Authenticated encryption with associated data of RFC 8439, section 2.8. The
+                 * Poly1305 key is the first half of the keystream block 0, the payload is encrypted from
+                 * block 1 on. Poly1305 authenticates the associated data and the ciphertext, each padded
+                 * to 16 octets, followed by their lengths.
+                 *
+                 * Associated data is passed with process_aad before the payload. Through the block
+                 * accumulator the encryption appends the tag to the ciphertext, the decryption checks
+                 * the tag given on construction and throws block::authentication_error on mismatch.
+                 */
+                template<typename Policy>
+                class poly1305_aead {
+                    typedef Policy policy_type;
+
+                    typedef keystream<stream_policy<typename policy_type::cipher_type>> keystream_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+                    typedef typename cipher_type::nonce_type nonce_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    constexpr static const bool length_preserving = true;
+
+                    constexpr static const size_type tag_bits = poly1305::tag_bits;
+                    typedef poly1305::tag_type tag_type;
+
+                    /*!
+                     * @brief Tag bits the accumulator appends to its output, the decryption appends none
+                     */
+                    constexpr static const size_type appended_tag_bits = policy_type::encrypting ? tag_bits : 0;
+
+                    BOOST_STATIC_ASSERT_MSG(sizeof(block_type) % poly1305::block_bytes == 0,
+                                            "Keystream blocks have to consist of whole Poly1305 blocks");
+
+                    /*!
+                     * @param cipher Keyed stream cipher
+                     * @param nonce Nonce, never to be reused with the same key
+                     * @throws std::invalid_argument unless nonce is exactly as long as nonce_type
+                     */
+                    template<typename NonceRange>
+                    poly1305_aead(const cipher_type &cipher, const NonceRange &nonce) :
+                        stream(cipher, nonce, 1), mac(one_time_key(cipher, stream.nonce())), aad_octets(0),
+                        text_octets(0), expected_tag_octets(0) {
+                    }
+
+                    /*!
+                     * @param cipher Keyed stream cipher
+                     * @param nonce Nonce, never to be reused with the same key
+                     * @param tag Tag the decrypted message is expected to have
+                     * @throws std::invalid_argument unless nonce and tag are exactly as long as their types
+                     */
+                    template<typename NonceRange, typename TagRange>
+                    poly1305_aead(const cipher_type &cipher, const NonceRange &nonce, const TagRange &tag) :
+                        poly1305_aead(cipher, nonce) {
+                        for (auto it = boost::begin(tag); it != boost::end(tag); ++it) {
+                            if (expected_tag_octets == expected_tag.size()) {
+                                BOOST_THROW_EXCEPTION(std::invalid_argument("tag is too long"));
+                            }
+                            expected_tag[expected_tag_octets++] = static_cast<std::uint8_t>(*it);
+                        }
+                        if (expected_tag_octets != expected_tag.size()) {
+                            BOOST_THROW_EXCEPTION(std::invalid_argument("tag is too short"));
+                        }
+                    }
+
+                    /*!
+                     * @brief Absorbs associated data, may be called several times before the payload
+                     */
+                    template<typename InputIterator>
+                    void process_aad(InputIterator first, InputIterator last) {
+                        BOOST_ASSERT_MSG(!text_octets, "Associated data has to precede the payload");
+
+                        std::uint8_t chunk[poly1305::block_bytes * 4];
+                        while (first != last) {
+                            std::size_t n = 0;
+                            for (; n != sizeof(chunk) && first != last; ++first) {
+                                chunk[n++] = static_cast<std::uint8_t>(*first);
+                            }
+                            mac.update(chunk, n);
+                            aad_octets += n;
+                        }
+                    }
+
+                    template<typename SinglePassRange>
+                    void process_aad(const SinglePassRange &r) {
+                        process_aad(boost::begin(r), boost::end(r));
+                    }
+
+                    block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
+                        return process_block(plaintext, total_seen);
+                    }
+
+                    block_type process_block(const block_type &input, std::size_t /*total_seen*/) {
+                        block_type output;
+                        process_blocks(&input, &output, 1);
+                        return output;
+                    }
+
+                    block_type end_message(const block_type &input, std::size_t total_seen) const {
+                        return stream.end_message(input, total_seen);
+                    }
+
+                    /*!
+                     * @brief Encrypts or decrypts, depending on the policy, n whole blocks. In and out
+                     * may be the same.
+                     */
+                    void process_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        if (n > stream.available_blocks()) {
+                            BOOST_THROW_EXCEPTION(counter_exhausted());
+                        }
+
+                        mac.pad();
+                        text_octets += n * sizeof(block_type);
+
+                        if (policy_type::encrypting) {
+                            stream.process_blocks(in, out, n);
+                            mac.update(reinterpret_cast<const std::uint8_t *>(out), n * sizeof(block_type));
+                        } else {
+                            mac.update(reinterpret_cast<const std::uint8_t *>(in), n * sizeof(block_type));
+                            stream.process_blocks(in, out, n);
+                        }
+                    }
+
+                    void encrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        BOOST_STATIC_ASSERT_MSG(policy_type::encrypting, "Decryption mode can not encrypt");
+                        process_blocks(in, out, n);
+                    }
+
+                    void decrypt_blocks(const block_type *in, block_type *out, std::size_t n) {
+                        BOOST_STATIC_ASSERT_MSG(!policy_type::encrypting, "Encryption mode can not decrypt");
+                        process_blocks(in, out, n);
+                    }
+
+                    /*!
+                     * @brief Tag of the message, total_seen bits long, which ends with the partial block last
+                     * following the whole blocks already processed
+                     */
+                    tag_type tag(const block_type &last, std::size_t total_seen) const {
+                        std::size_t last_octets = (total_seen + 7) / 8 - text_octets;
+                        BOOST_ASSERT(last_octets <= sizeof(block_type));
+
+                        poly1305 m = mac;
+                        m.pad();
+                        if (last_octets) {
+                            block_type ciphertext = policy_type::encrypting ? end_message(last, total_seen) : last;
+                            m.update(ciphertext.data(), last_octets);
+                            m.pad();
+                        }
+
+                        std::uint8_t lengths[16];
+                        store_le64(lengths, aad_octets);
+                        store_le64(lengths + 8, text_octets + last_octets);
+                        m.update(lengths, sizeof(lengths));
+
+                        return m.digest();
+                    }
+
+                    /*!
+                     * @brief Tag of the message made of the whole blocks already processed
+                     */
+                    tag_type tag() const {
+                        return tag(block_type(), text_octets * 8);
+                    }
+
+                    /*!
+                     * @brief Compares the tag of the message with the expected one in constant time
+                     */
+                    template<typename TagRange>
+                    bool verify(const TagRange &expected, const block_type &last, std::size_t total_seen) const {
+                        tag_type t = tag(last, total_seen);
+                        std::size_t n = 0;
+                        std::uint8_t diff = 0;
+                        for (auto it = boost::begin(expected); it != boost::end(expected); ++it, ++n) {
+                            if (n == t.size()) {
+                                return false;
+                            }
+                            diff |= t[n] ^ static_cast<std::uint8_t>(*it);
+                        }
+                        return n == t.size() && !diff;
+                    }
+
+                    template<typename TagRange>
+                    bool verify(const TagRange &expected) const {
+                        return verify(expected, block_type(), text_octets * 8);
+                    }
+
+                    /*!
+                     * @brief Writes the appended_tag_bits of the tag, the decryption checks the expected
+                     * tag instead and throws block::authentication_error when it does not match
+                     */
+                    template<typename OutputIterator>
+                    OutputIterator end_authentication(const block_type &last, std::size_t total_seen,
+                                                      OutputIterator out) const {
+                        if (policy_type::encrypting) {
+                            tag_type t = tag(last, total_seen);
+                            return std::copy(t.begin(), t.end(), out);
+                        }
+
+                        if (!verify(boost::make_iterator_range(expected_tag.begin(),
+                                                               expected_tag.begin() + expected_tag_octets),
+                                    last, total_seen)) {
+                            BOOST_THROW_EXCEPTION(block::authentication_error());
+                        }
+                        return out;
+                    }
+
+                protected:
+                    static poly1305::key_type one_time_key(const cipher_type &cipher, const nonce_type &nonce) {
+                        block_type block = cipher.keystream(nonce, 0);
+                        poly1305::key_type key;
+                        std::copy(block.begin(), block.begin() + key.size(), key.begin());
+                        std::fill(block.begin(), block.end(), 0);
+                        return key;
+                    }
+
+                    static void store_le64(std::uint8_t *p, std::uint64_t x) {
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            p[i] = static_cast<std::uint8_t>(x >> (8 * i));
+                        }
+                    }
+
+                    keystream_type stream;
+                    poly1305 mac;
+
+                    std::uint64_t aad_octets, text_octets;
+
+                    tag_type expected_tag;
+                    std::size_t expected_tag_octets;
+                };
+            }    // namespace detail
+
+            namespace modes {
+                /*!
+                 * @brief Stream encryption with the keystream of the cipher
+                 * @tparam Cipher Stream cipher, e.g. chacha20
+                 */
+                template<typename Cipher>
+                struct keystream {
+                    typedef Cipher cipher_type;
+                    typedef block::nop_padding<Cipher> padding_type;
+
+                    typedef detail::stream_encryption_policy<cipher_type> encryption_policy;
+                    typedef detail::stream_decryption_policy<cipher_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::keystream<Policy> type;
+                    };
+                };
+
+                /*!
+                 * @brief Authenticated encryption with associated data combining the cipher with Poly1305
+                 * @tparam Cipher Stream cipher, e.g. chacha20
+                 */
+                template<typename Cipher>
+                struct poly1305_aead {
+                    typedef Cipher cipher_type;
+                    typedef block::nop_padding<Cipher> padding_type;
+
+                    typedef detail::stream_encryption_policy<cipher_type> encryption_policy;
+                    typedef detail::stream_decryption_policy<cipher_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::poly1305_aead<Policy> type;
+                    };
+                };
+            }    // namespace modes
+        }        // namespace stream
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_STREAM_CIPHER_MODES_HPP
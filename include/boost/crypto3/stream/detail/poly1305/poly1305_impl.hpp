@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_STREAM_POLY1305_IMPL_HPP
+#define CRYPTO3_STREAM_POLY1305_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+    namespace crypto3 {
+        namespace stream {
+            namespace detail {
+                /*!
+                 * @brief Poly1305 of RFC 8439 on five 26-bit limbs, so products of limbs fit into 64 bits on
+                 * any platform. Constant time, no table lookups and no secret-dependent branches.
+                 */
+                struct poly1305_impl {
+                    constexpr static const std::size_t block_bytes = 16;
+                    constexpr static const std::uint32_t limb_mask = 0x3ffffff;
+
+                    struct state_type {
+                        std::array<std::uint32_t, 5> r, h;
+                        std::array<std::uint32_t, 4> pad;
+                    };
+
+                    static inline std::uint32_t load_le(const std::uint8_t *p) {
+                        return std::uint32_t(p[0]) | std::uint32_t(p[1]) << 8 | std::uint32_t(p[2]) << 16 |
+                               std::uint32_t(p[3]) << 24;
+                    }
+
+                    static inline void store_le(std::uint8_t *p, std::uint32_t x) {
+                        p[0] = static_cast<std::uint8_t>(x);
+                        p[1] = static_cast<std::uint8_t>(x >> 8);
+                        p[2] = static_cast<std::uint8_t>(x >> 16);
+                        p[3] = static_cast<std::uint8_t>(x >> 24);
+                    }
+
+                    /*!
+                     * @brief Clamps r, the first half of the 32-octet one-time key, the second half is the pad s
+                     */
+                    static void schedule_key(state_type &state, const std::uint8_t *key) {
+                        state.r[0] = load_le(key) & 0x3ffffff;
+                        state.r[1] = (load_le(key + 3) >> 2) & 0x3ffff03;
+                        state.r[2] = (load_le(key + 6) >> 4) & 0x3ffc0ff;
+                        state.r[3] = (load_le(key + 9) >> 6) & 0x3f03fff;
+                        state.r[4] = (load_le(key + 12) >> 8) & 0x00fffff;
+                        state.h.fill(0);
+                        for (std::size_t i = 0; i != state.pad.size(); ++i) {
+                            state.pad[i] = load_le(key + 16 + 4 * i);
+                        }
+                    }
+
+                    /*!
+                     * @brief Absorbs n blocks of 16 octets. hibit is the 2^128 term added to each of them,
+                     * 1 << 24 for whole blocks and 0 for the final one padded with 1 by the caller.
+                     */
+                    static void process_blocks(state_type &state, const std::uint8_t *m, std::size_t n,
+                                               std::uint32_t hibit = 1 << 24) {
+                        const std::uint64_t r0 = state.r[0], r1 = state.r[1], r2 = state.r[2], r3 = state.r[3],
+                                            r4 = state.r[4];
+                        const std::uint64_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+                        std::uint32_t h0 = state.h[0], h1 = state.h[1], h2 = state.h[2], h3 = state.h[3],
+                                      h4 = state.h[4];
+
+                        for (; n; --n, m += block_bytes) {
+                            h0 += load_le(m) & limb_mask;
+                            h1 += (load_le(m + 3) >> 2) & limb_mask;
+                            h2 += (load_le(m + 6) >> 4) & limb_mask;
+                            h3 += (load_le(m + 9) >> 6) & limb_mask;
+                            h4 += (load_le(m + 12) >> 8) | hibit;
+
+                            // h *= r modulo 2^130 - 5, limbs above 2^130 wrap around multiplied by 5
+                            std::uint64_t d0 = h0 * r0 + h1 * s4 + h2 * s3 + h3 * s2 + h4 * s1;
+                            std::uint64_t d1 = h0 * r1 + h1 * r0 + h2 * s4 + h3 * s3 + h4 * s2;
+                            std::uint64_t d2 = h0 * r2 + h1 * r1 + h2 * r0 + h3 * s4 + h4 * s3;
+                            std::uint64_t d3 = h0 * r3 + h1 * r2 + h2 * r1 + h3 * r0 + h4 * s4;
+                            std::uint64_t d4 = h0 * r4 + h1 * r3 + h2 * r2 + h3 * r1 + h4 * r0;
+
+                            std::uint32_t c = static_cast<std::uint32_t>(d0 >> 26);
+                            h0 = static_cast<std::uint32_t>(d0) & limb_mask;
+                            d1 += c;
+                            c = static_cast<std::uint32_t>(d1 >> 26);
+                            h1 = static_cast<std::uint32_t>(d1) & limb_mask;
+                            d2 += c;
+                            c = static_cast<std::uint32_t>(d2 >> 26);
+                            h2 = static_cast<std::uint32_t>(d2) & limb_mask;
+                            d3 += c;
+                            c = static_cast<std::uint32_t>(d3 >> 26);
+                            h3 = static_cast<std::uint32_t>(d3) & limb_mask;
+                            d4 += c;
+                            c = static_cast<std::uint32_t>(d4 >> 26);
+                            h4 = static_cast<std::uint32_t>(d4) & limb_mask;
+                            h0 += c * 5;
+                            c = h0 >> 26;
+                            h0 &= limb_mask;
+                            h1 += c;
+                        }
+
+                        state.h = {{h0, h1, h2, h3, h4}};
+                    }
+
+                    /*!
+                     * @brief Fully reduces the accumulator and adds the pad, the state is left as it is
+                     */
+                    static void finish(const state_type &state, std::uint8_t *tag) {
+                        std::uint32_t h0 = state.h[0], h1 = state.h[1], h2 = state.h[2], h3 = state.h[3],
+                                      h4 = state.h[4];
+
+                        std::uint32_t c = h1 >> 26;
+                        h1 &= limb_mask;
+                        h2 += c;
+                        c = h2 >> 26;
+                        h2 &= limb_mask;
+                        h3 += c;
+                        c = h3 >> 26;
+                        h3 &= limb_mask;
+                        h4 += c;
+                        c = h4 >> 26;
+                        h4 &= limb_mask;
+                        h0 += c * 5;
+                        c = h0 >> 26;
+                        h0 &= limb_mask;
+                        h1 += c;
+
+                        // g = h + 5 - 2^130 is taken instead of h when it does not underflow
+                        std::uint32_t g0 = h0 + 5;
+                        c = g0 >> 26;
+                        g0 &= limb_mask;
+                        std::uint32_t g1 = h1 + c;
+                        c = g1 >> 26;
+                        g1 &= limb_mask;
+                        std::uint32_t g2 = h2 + c;
+                        c = g2 >> 26;
+                        g2 &= limb_mask;
+                        std::uint32_t g3 = h3 + c;
+                        c = g3 >> 26;
+                        g3 &= limb_mask;
+                        std::uint32_t g4 = h4 + c - (1UL << 26);
+
+                        std::uint32_t mask = (g4 >> 31) - 1;
+                        h0 = (h0 & ~mask) | (g0 & mask);
+                        h1 = (h1 & ~mask) | (g1 & mask);
+                        h2 = (h2 & ~mask) | (g2 & mask);
+                        h3 = (h3 & ~mask) | (g3 & mask);
+                        h4 = (h4 & ~mask) | (g4 & mask);
+
+                        // h modulo 2^128 as four 32-bit words plus the pad
+                        h0 = h0 | (h1 << 26);
+                        h1 = (h1 >> 6) | (h2 << 20);
+                        h2 = (h2 >> 12) | (h3 << 14);
+                        h3 = (h3 >> 18) | (h4 << 8);
+
+                        std::uint64_t f = std::uint64_t(h0) + state.pad[0];
+                        store_le(tag, static_cast<std::uint32_t>(f));
+                        f = std::uint64_t(h1) + state.pad[1] + (f >> 32);
+                        store_le(tag + 4, static_cast<std::uint32_t>(f));
+                        f = std::uint64_t(h2) + state.pad[2] + (f >> 32);
+                        store_le(tag + 8, static_cast<std::uint32_t>(f));
+                        f = std::uint64_t(h3) + state.pad[3] + (f >> 32);
+                        store_le(tag + 12, static_cast<std::uint32_t>(f));
+                    }
+                };
+            }    // namespace detail
+        }        // namespace stream
+    }            // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_STREAM_POLY1305_IMPL_HPP
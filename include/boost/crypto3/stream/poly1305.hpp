@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_STREAM_POLY1305_HPP
+#define CRYPTO3_STREAM_POLY1305_HPP
+
+#include <boost/crypto3/stream/detail/poly1305/poly1305_impl.hpp>
+
+#include <boost/crypto3/detail/secure_zero.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+    namespace crypto3 {
+        namespace stream {
+            /*!
+             * @brief Poly1305 one-time authenticator of RFC 8439. A key must never authenticate more
+             * than one message, ChaCha20-Poly1305 derives a fresh one for every nonce.
+             *
+             * @ingroup stream
+             *
+             * @code
+             * stream::poly1305 mac(key);
+             * mac.update(message.data(), message.size());
+             * stream::poly1305::tag_type tag = mac.digest();
+             * @endcode
+             */
+            class poly1305 {
+                typedef detail::poly1305_impl impl_type;
+
+            public:
+                constexpr static const std::size_t key_bits = 256;
+                typedef std::array<std::uint8_t, key_bits / 8> key_type;
+
+                constexpr static const std::size_t block_bytes = impl_type::block_bytes;
+
+                constexpr static const std::size_t tag_bits = 128;
+                typedef std::array<std::uint8_t, tag_bits / 8> tag_type;
+
+                explicit poly1305(const key_type &key) : buffered(0) {
+                    impl_type::schedule_key(state, key.data());
+                }
+
+                ~poly1305() {
+                    ::boost::crypto3::detail::secure_zero(state.r.data(), state.r.size());
+                    ::boost::crypto3::detail::secure_zero(state.h.data(), state.h.size());
+                    ::boost::crypto3::detail::secure_zero(state.pad.data(), state.pad.size());
+                    ::boost::crypto3::detail::secure_zero(buffer.data(), buffer.size());
+                }
+
+                /*!
+                 * @brief Absorbs n octets, whole blocks are processed right from the input
+                 */
+                void update(const std::uint8_t *data, std::size_t n) {
+                    if (buffered) {
+                        std::size_t count = block_bytes - buffered < n ? block_bytes - buffered : n;
+                        std::memcpy(buffer.data() + buffered, data, count);
+                        buffered += count;
+                        data += count;
+                        n -= count;
+                        if (buffered != block_bytes) {
+                            return;
+                        }
+                        impl_type::process_blocks(state, buffer.data(), 1);
+                        buffered = 0;
+                    }
+
+                    impl_type::process_blocks(state, data, n / block_bytes);
+                    data += n - n % block_bytes;
+                    n %= block_bytes;
+
+                    if (n) {
+                        std::memcpy(buffer.data(), data, n);
+                    }
+                    buffered = n;
+                }
+
+                template<typename InputIterator>
+                void update(InputIterator first, InputIterator last) {
+                    for (; first != last; ++first) {
+                        buffer[buffered++] = static_cast<std::uint8_t>(*first);
+                        if (buffered == block_bytes) {
+                            impl_type::process_blocks(state, buffer.data(), 1);
+                            buffered = 0;
+                        }
+                    }
+                }
+
+                template<typename SinglePassRange>
+                void update(const SinglePassRange &r) {
+                    update(boost::begin(r), boost::end(r));
+                }
+
+                /*!
+                 * @brief Completes a partial block with zeros, the pad16 of RFC 8439 section 2.8
+                 */
+                void pad() {
+                    if (buffered) {
+                        std::memset(buffer.data() + buffered, 0, block_bytes - buffered);
+                        impl_type::process_blocks(state, buffer.data(), 1);
+                        buffered = 0;
+                    }
+                }
+
+                /*!
+                 * @brief Tag of the octets absorbed so far, more octets may follow
+                 */
+                tag_type digest() const {
+                    impl_type::state_type s = state;
+                    if (buffered) {
+                        std::array<std::uint8_t, block_bytes> last = {};
+                        std::memcpy(last.data(), buffer.data(), buffered);
+                        last[buffered] = 1;
+                        impl_type::process_blocks(s, last.data(), 1, 0);
+                    }
+
+                    tag_type t;
+                    impl_type::finish(s, t.data());
+                    return t;
+                }
+
+            protected:
+                impl_type::state_type state;
+                std::array<std::uint8_t, block_bytes> buffer;
+                std::size_t buffered;
+            };
+        }    // namespace stream
+    }        // namespace crypto3
+}    // namespace boost
+
+#endif    // CRYPTO3_STREAM_POLY1305_HPP
@@ -0,0 +1,344 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE cbc_cipher_mode_test
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+#include <boost/crypto3/block/algorithm/decrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+template<typename Cipher, template<typename> class Padding = block::nop_padding>
+struct cbc_types {
+    typedef block::modes::cbc<Cipher, Padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type encryption_mode;
+    typedef typename mode_type::template bind<typename mode_type::decryption_policy>::type decryption_mode;
+    typedef typename Cipher::block_type block_type;
+};
+
+template<typename Block>
+std::vector<Block> make_blocks(const std::string &hex) {
+    std::vector<std::uint8_t> in = from_hex(hex);
+    std::vector<Block> blocks(in.size() / sizeof(Block));
+    if (!blocks.empty()) {
+        std::copy(in.begin(), in.end(), blocks.front().begin());
+    }
+    return blocks;
+}
+
+template<typename Block>
+std::string blocks_hex(const std::vector<Block> &blocks) {
+    std::string out;
+    for (const Block &b : blocks) {
+        out += to_hex(b);
+    }
+    return out;
+}
+
+/*!
+ * @brief Encrypts or decrypts the whole message at once with encrypt_blocks or decrypt_blocks
+ */
+template<typename Cipher>
+std::string cbc_bulk(const std::string &key, const std::string &iv, const std::string &input, bool encrypting) {
+    typedef cbc_types<Cipher> types;
+    typedef typename types::block_type block_type;
+
+    std::vector<block_type> blocks = make_blocks<block_type>(input);
+    if (encrypting) {
+        typename types::encryption_mode mode(make_cipher<Cipher>(key), make_array<block_type>(iv));
+        mode.encrypt_blocks(blocks.data(), blocks.data(), blocks.size());
+    } else {
+        typename types::decryption_mode mode(make_cipher<Cipher>(key), make_array<block_type>(iv));
+        mode.decrypt_blocks(blocks.data(), blocks.data(), blocks.size());
+    }
+    return blocks_hex(blocks);
+}
+
+/*!
+ * @brief Encrypts the message through the block cipher accumulator
+ */
+template<typename Cipher, template<typename> class Padding>
+std::string cbc_encrypt(const std::string &key, const std::string &iv, const std::string &input) {
+    typedef cbc_types<Cipher, Padding> types;
+    typedef typename types::encryption_mode mode_type;
+
+    block::accumulator_set<mode_type> acc(
+        mode_type(make_cipher<Cipher>(key), make_array<typename types::block_type>(iv)));
+    encrypt<Cipher>(from_hex(input), acc);
+
+    return to_hex(accumulators::extract::block<mode_type>(acc));
+}
+
+/*!
+ * @brief Decrypts the message through the block cipher accumulator
+ */
+template<typename Cipher, template<typename> class Padding>
+std::string cbc_decrypt(const std::string &key, const std::string &iv, const std::string &input) {
+    typedef cbc_types<Cipher, Padding> types;
+    typedef typename types::decryption_mode mode_type;
+
+    block::accumulator_set<mode_type> acc(
+        mode_type(make_cipher<Cipher>(key), make_array<typename types::block_type>(iv)));
+    decrypt<Cipher>(from_hex(input), acc);
+
+    return to_hex(accumulators::extract::block<mode_type>(acc));
+}
+
+// NIST SP 800-38A, F.2
+const std::string sp800_38a_iv = "000102030405060708090a0b0c0d0e0f";
+const std::string sp800_38a_plaintext =
+    "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+    "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+
+BOOST_AUTO_TEST_SUITE(cbc_sp800_38a_test_suite)
+
+BOOST_AUTO_TEST_CASE(cbc_aes128) {
+    // F.2.1 CBC-AES128.Encrypt, F.2.2 CBC-AES128.Decrypt
+    const std::string key = "2b7e151628aed2a6abf7158809cf4f3c";
+    const std::string ciphertext =
+        "7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b2"
+        "73bed6b8e3c1743b7116e69e222295163ff1caa1681fac09120eca307586e1a7";
+
+    BOOST_CHECK_EQUAL(cbc_bulk<block::aes<128>>(key, sp800_38a_iv, sp800_38a_plaintext, true), ciphertext);
+    BOOST_CHECK_EQUAL(cbc_bulk<block::aes<128>>(key, sp800_38a_iv, ciphertext, false), sp800_38a_plaintext);
+    BOOST_CHECK_EQUAL((cbc_encrypt<block::aes<128>, block::nop_padding>(key, sp800_38a_iv, sp800_38a_plaintext)),
+                      ciphertext);
+    BOOST_CHECK_EQUAL((cbc_decrypt<block::aes<128>, block::nop_padding>(key, sp800_38a_iv, ciphertext)),
+                      sp800_38a_plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(cbc_aes192) {
+    // F.2.3 CBC-AES192.Encrypt, F.2.4 CBC-AES192.Decrypt
+    const std::string key = "8e73b0f7da0e6452c810f32b809079e562f8ead2522c6b7b";
+    const std::string ciphertext =
+        "4f021db243bc633d7178183a9fa071e8b4d9ada9ad7dedf4e5e738763f69145a"
+        "571b242012fb7ae07fa9baac3df102e008b0e27988598881d920a9e64f5615cd";
+
+    BOOST_CHECK_EQUAL(cbc_bulk<block::aes<192>>(key, sp800_38a_iv, sp800_38a_plaintext, true), ciphertext);
+    BOOST_CHECK_EQUAL(cbc_bulk<block::aes<192>>(key, sp800_38a_iv, ciphertext, false), sp800_38a_plaintext);
+    BOOST_CHECK_EQUAL((cbc_encrypt<block::aes<192>, block::nop_padding>(key, sp800_38a_iv, sp800_38a_plaintext)),
+                      ciphertext);
+}
+
+BOOST_AUTO_TEST_CASE(cbc_aes256) {
+    // F.2.5 CBC-AES256.Encrypt, F.2.6 CBC-AES256.Decrypt
+    const std::string key = "603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4";
+    const std::string ciphertext =
+        "f58c4c04d6e5f1ba779eabfb5f7bfbd69cfc4e967edb808d679f777bc6702c7d"
+        "39f23369a9d9bacfa530e26304231461b2eb05e2c39be9fcda6c19078c6a9d1b";
+
+    BOOST_CHECK_EQUAL(cbc_bulk<block::aes<256>>(key, sp800_38a_iv, sp800_38a_plaintext, true), ciphertext);
+    BOOST_CHECK_EQUAL(cbc_bulk<block::aes<256>>(key, sp800_38a_iv, ciphertext, false), sp800_38a_plaintext);
+    BOOST_CHECK_EQUAL((cbc_decrypt<block::aes<256>, block::nop_padding>(key, sp800_38a_iv, ciphertext)),
+                      sp800_38a_plaintext);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(cbc_bulk_test_suite)
+
+BOOST_AUTO_TEST_CASE(cbc_aes128_split_calls) {
+    // Any split into decrypt_blocks calls, across the pipeline width, yields the same plaintext
+    typedef cbc_types<block::aes<128>> types;
+    typedef types::block_type block_type;
+
+    block::aes<128> cipher = make_cipher<block::aes<128>>("2b7e151628aed2a6abf7158809cf4f3c");
+    block_type iv = make_array<block_type>(sp800_38a_iv);
+
+    std::vector<block_type> plaintext(61);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        plaintext[i].fill(static_cast<std::uint8_t>(i * 13 + 1));
+    }
+
+    std::vector<block_type> ciphertext(plaintext.size());
+    types::encryption_mode(cipher, iv).encrypt_blocks(plaintext.data(), ciphertext.data(), plaintext.size());
+
+    types::encryption_mode encryption(cipher, iv);
+    types::decryption_mode decryption(cipher, iv);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        BOOST_CHECK(encryption.process_block(plaintext[i], 0) == ciphertext[i]);
+        BOOST_CHECK(decryption.process_block(ciphertext[i], 0) == plaintext[i]);
+    }
+
+    const std::size_t splits[] = {1, 3, 7, 8, 9, 16, 17, 61};
+    for (std::size_t split : splits) {
+        types::decryption_mode mode(cipher, iv);
+        std::vector<block_type> out = ciphertext;
+        for (std::size_t i = 0; i < out.size(); i += split) {
+            std::size_t n = std::min(split, out.size() - i);
+            mode.decrypt_blocks(out.data() + i, out.data() + i, n);
+        }
+        BOOST_CHECK(out == plaintext);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(cbc_aes128_inplace) {
+    // F.2.1, F.2.2 in place, the message is split into two calls
+    typedef cbc_types<block::aes<128>> types;
+
+    block::aes<128> cipher = make_cipher<block::aes<128>>("2b7e151628aed2a6abf7158809cf4f3c");
+    types::block_type iv = make_array<types::block_type>(sp800_38a_iv);
+
+    std::vector<std::uint8_t> buffer = from_hex(sp800_38a_plaintext);
+    types::encryption_mode encryption(cipher, iv);
+    encrypt_inplace<block::aes<128>>(buffer.data(), buffer.data() + 16, encryption);
+    encrypt_inplace<block::aes<128>>(buffer.data() + 16, buffer.data() + buffer.size(), encryption);
+    BOOST_CHECK_EQUAL(to_hex(buffer), "7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b2"
+                                      "73bed6b8e3c1743b7116e69e222295163ff1caa1681fac09120eca307586e1a7");
+
+    types::decryption_mode decryption(cipher, iv);
+    BOOST_CHECK_EQUAL(to_hex(decrypt_inplace<block::aes<128>>(buffer, decryption)), sp800_38a_plaintext);
+
+    // Block modes do not take partial blocks
+    std::vector<std::uint8_t> partial(17);
+    types::encryption_mode mode(cipher, iv);
+    BOOST_CHECK_THROW(encrypt_inplace<block::aes<128>>(partial, mode), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(cbc_pkcs7_test_suite)
+
+BOOST_AUTO_TEST_CASE(cbc_aes128_partial_block) {
+    // Without padding a partial last block is rejected rather than extended with zeros
+    const std::string key = "2b7e151628aed2a6abf7158809cf4f3c";
+
+    BOOST_CHECK_EQUAL((cbc_encrypt<block::aes<128>, block::nop_padding>(key, sp800_38a_iv, "")), "");
+    BOOST_CHECK_THROW((cbc_encrypt<block::aes<128>, block::nop_padding>(key, sp800_38a_iv, "6bc1bee22e40")),
+                      block::padding_error);
+    BOOST_CHECK_THROW((cbc_encrypt<block::aes<128>, block::nop_padding>(key, sp800_38a_iv,
+                                                                        sp800_38a_plaintext.substr(0, 40))),
+                      block::padding_error);
+    BOOST_CHECK_THROW((cbc_decrypt<block::aes<128>, block::nop_padding>(key, sp800_38a_iv,
+                                                                        "7649abac8119b246cee98e9b12e9197d5086")),
+                      block::padding_error);
+}
+
+BOOST_AUTO_TEST_CASE(cbc_aes128_pkcs7) {
+    // openssl enc -aes-128-cbc, the plaintexts are prefixes of the SP 800-38A one
+    const std::string key = "2b7e151628aed2a6abf7158809cf4f3c";
+    const std::pair<std::size_t, std::string> vectors[] = {
+        {0, "c84af0b613435d5d9182801a9bd9320b"},
+        {1, "2a7a633fad54e2146edcef80c59eebc6"},
+        {15, "9be1e579d107a136c031b645a88da750"},
+        {16, "7649abac8119b246cee98e9b12e9197d8964e0b149c10b7b682e6e39aaeb731c"},
+        {17, "7649abac8119b246cee98e9b12e9197d34d2d260173113008c28112c77668c86"},
+        {33, "7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b28952d70a60e8382748f7e75c965d86d2"},
+        {64, "7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b273bed6b8e3c1743b7116e69e22229516"
+             "3ff1caa1681fac09120eca307586e1a78cb82807230e1321d3fae00d18cc2012"}};
+
+    for (const auto &v : vectors) {
+        std::string plaintext = sp800_38a_plaintext.substr(0, 2 * v.first);
+        BOOST_CHECK_EQUAL((cbc_encrypt<block::aes<128>, block::pkcs7_padding>(key, sp800_38a_iv, plaintext)),
+                          v.second);
+        BOOST_CHECK_EQUAL((cbc_decrypt<block::aes<128>, block::pkcs7_padding>(key, sp800_38a_iv, v.second)),
+                          plaintext);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(cbc_aes128_pkcs7_malformed) {
+    const std::string key = "2b7e151628aed2a6abf7158809cf4f3c";
+
+    // Empty and truncated ciphertexts
+    BOOST_CHECK_THROW((cbc_decrypt<block::aes<128>, block::pkcs7_padding>(key, sp800_38a_iv, "")),
+                      block::padding_error);
+    BOOST_CHECK_THROW(
+        (cbc_decrypt<block::aes<128>, block::pkcs7_padding>(key, sp800_38a_iv, "7649abac8119b246cee98e9b12e919")),
+        block::padding_error);
+    // Valid length, the SP 800-38A ciphertext decrypts to a block without padding
+    BOOST_CHECK_THROW((cbc_decrypt<block::aes<128>, block::pkcs7_padding>(key, sp800_38a_iv,
+                                                                          "7649abac8119b246cee98e9b12e9197d")),
+                      block::padding_error);
+    // Padding octets disagreeing with the padding length
+    BOOST_CHECK_THROW((cbc_decrypt<block::aes<128>, block::pkcs7_padding>(key, sp800_38a_iv,
+                                                                          "9be1e579d107a136c031b645a88da751")),
+                      block::padding_error);
+}
+
+BOOST_AUTO_TEST_CASE(cbc_aes128_pkcs7_not_inplace) {
+    // The extension does not fit the buffer, padding modes are only driven through the accumulator
+    typedef cbc_types<block::aes<128>, block::pkcs7_padding> types;
+
+    BOOST_STATIC_ASSERT(!block::detail::is_inplace_mode<types::encryption_mode>::value);
+    BOOST_STATIC_ASSERT(!block::detail::is_inplace_mode<types::decryption_mode>::value);
+    BOOST_STATIC_ASSERT(block::detail::is_inplace_mode<cbc_types<block::aes<128>>::encryption_mode>::value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(cbc_cts_test_suite)
+
+// RFC 3962, Appendix B, CBC-CS3 ciphertext stealing
+const std::string rfc3962_key = "636869636b656e207465726979616b69";
+const std::string rfc3962_iv = "00000000000000000000000000000000";
+const std::string rfc3962_plaintext =
+    "4920776f756c64206c696b65207468652047656e6572616c20476175277320436869636b656e2c20706c656173652c"
+    "20616e6420776f6e746f6e20736f75702e";
+
+BOOST_AUTO_TEST_CASE(cbc_aes128_cts) {
+    const std::pair<std::size_t, std::string> vectors[] = {
+        {17, "c6353568f2bf8cb4d8a580362da7ff7f97"},
+        {31, "fc00783e0efdb2c1d445d4c8eff7ed2297687268d6ecccc0c07b25e25ecfe5"},
+        {32, "39312523a78662d5be7fcbcc98ebf5a897687268d6ecccc0c07b25e25ecfe584"},
+        {47, "97687268d6ecccc0c07b25e25ecfe584b3fffd940c16a18c1b5549d2f838029e39312523a78662d5be7fcbcc98ebf5"},
+        {48, "97687268d6ecccc0c07b25e25ecfe5849dad8bbb96c4cdc03bc103e1a194bbd839312523a78662d5be7fcbcc98ebf5a8"},
+        {64, "97687268d6ecccc0c07b25e25ecfe58439312523a78662d5be7fcbcc98ebf5a84807efe836ee89a526730dbc2f7bc840"
+             "9dad8bbb96c4cdc03bc103e1a194bbd8"}};
+
+    for (const auto &v : vectors) {
+        std::string plaintext = rfc3962_plaintext.substr(0, 2 * v.first);
+        BOOST_CHECK_EQUAL((cbc_encrypt<block::aes<128>, block::cts_padding>(rfc3962_key, rfc3962_iv, plaintext)),
+                          v.second);
+        BOOST_CHECK_EQUAL((cbc_decrypt<block::aes<128>, block::cts_padding>(rfc3962_key, rfc3962_iv, v.second)),
+                          plaintext);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(cbc_aes128_cts_lengths) {
+    // Ciphertext stealing keeps the message length, a single block is plain CBC
+    const std::string key = "2b7e151628aed2a6abf7158809cf4f3c";
+
+    BOOST_CHECK_EQUAL((cbc_encrypt<block::aes<128>, block::cts_padding>(key, sp800_38a_iv, "")), "");
+    BOOST_CHECK_EQUAL(
+        (cbc_encrypt<block::aes<128>, block::cts_padding>(key, sp800_38a_iv, sp800_38a_plaintext.substr(0, 32))),
+        "7649abac8119b246cee98e9b12e9197d");
+
+    for (std::size_t n = 16; n <= 64; ++n) {
+        std::string plaintext = sp800_38a_plaintext.substr(0, 2 * n);
+        std::string ciphertext = cbc_encrypt<block::aes<128>, block::cts_padding>(key, sp800_38a_iv, plaintext);
+        BOOST_CHECK_EQUAL(ciphertext.size(), plaintext.size());
+        BOOST_CHECK_EQUAL((cbc_decrypt<block::aes<128>, block::cts_padding>(key, sp800_38a_iv, ciphertext)),
+                          plaintext);
+    }
+
+    BOOST_CHECK_THROW((cbc_encrypt<block::aes<128>, block::cts_padding>(key, sp800_38a_iv, "6bc1bee22e40")),
+                      block::padding_error);
+    BOOST_CHECK_THROW((cbc_decrypt<block::aes<128>, block::cts_padding>(key, sp800_38a_iv, "6bc1bee22e40")),
+                      block::padding_error);
+}
+
+BOOST_AUTO_TEST_CASE(cbc_aes128_cts_not_inplace) {
+    // The last two blocks are swapped on the message end, so the mode is only driven through the accumulator
+    typedef cbc_types<block::aes<128>, block::cts_padding> types;
+
+    BOOST_STATIC_ASSERT(types::encryption_mode::length_preserving);
+    BOOST_STATIC_ASSERT(!block::detail::is_inplace_mode<types::encryption_mode>::value);
+    BOOST_STATIC_ASSERT(!block::detail::is_inplace_mode<types::decryption_mode>::value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,215 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE ctr_cipher_mode_test
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+#include <boost/crypto3/block/algorithm/decrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+template<typename Cipher>
+struct ctr_types {
+    typedef block::modes::ctr<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type encryption_mode;
+    typedef typename mode_type::template bind<typename mode_type::decryption_policy>::type decryption_mode;
+    typedef typename Cipher::block_type block_type;
+};
+
+/*!
+ * @brief Encrypts the whole message at once with encrypt_blocks
+ */
+template<typename Cipher>
+std::string ctr_bulk(const std::string &key, const std::string &iv, const std::string &input) {
+    typedef ctr_types<Cipher> types;
+    typedef typename types::block_type block_type;
+
+    std::vector<std::uint8_t> in = from_hex(input);
+    std::vector<block_type> blocks(in.size() / sizeof(block_type));
+    std::copy(in.begin(), in.end(), blocks.front().begin());
+
+    typename types::encryption_mode mode(make_cipher<Cipher>(key), make_array<block_type>(iv));
+    mode.encrypt_blocks(blocks.data(), blocks.data(), blocks.size());
+
+    std::string out;
+    for (const block_type &b : blocks) {
+        out += to_hex(b);
+    }
+    return out;
+}
+
+/*!
+ * @brief Encrypts the message through the block cipher accumulator
+ */
+template<typename Cipher>
+std::string ctr_accumulator(const std::string &key, const std::string &iv, const std::string &input) {
+    typedef ctr_types<Cipher> types;
+    typedef typename types::encryption_mode mode_type;
+
+    block::accumulator_set<mode_type> acc(
+        mode_type(make_cipher<Cipher>(key), make_array<typename types::block_type>(iv)));
+    encrypt<Cipher>(from_hex(input), acc);
+
+    return to_hex(accumulators::extract::block<mode_type>(acc));
+}
+
+// NIST SP 800-38A, F.5
+const std::string sp800_38a_iv = "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+const std::string sp800_38a_plaintext =
+    "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+    "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+
+BOOST_AUTO_TEST_SUITE(ctr_sp800_38a_test_suite)
+
+BOOST_AUTO_TEST_CASE(ctr_aes128_encrypt) {
+    // F.5.1 CTR-AES128.Encrypt
+    const std::string key = "2b7e151628aed2a6abf7158809cf4f3c";
+    const std::string ciphertext =
+        "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+        "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee";
+
+    BOOST_CHECK_EQUAL(ctr_bulk<block::aes<128>>(key, sp800_38a_iv, sp800_38a_plaintext), ciphertext);
+    BOOST_CHECK_EQUAL(ctr_accumulator<block::aes<128>>(key, sp800_38a_iv, sp800_38a_plaintext), ciphertext);
+}
+
+BOOST_AUTO_TEST_CASE(ctr_aes128_decrypt) {
+    // F.5.2 CTR-AES128.Decrypt
+    typedef ctr_types<block::aes<128>> types;
+
+    std::vector<std::uint8_t> in = from_hex(
+        "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+        "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee");
+    std::vector<types::block_type> blocks(in.size() / 16);
+    std::copy(in.begin(), in.end(), blocks.front().begin());
+
+    types::decryption_mode mode(make_cipher<block::aes<128>>("2b7e151628aed2a6abf7158809cf4f3c"),
+                                make_array<types::block_type>(sp800_38a_iv));
+    mode.decrypt_blocks(blocks.data(), blocks.data(), blocks.size());
+
+    std::string out;
+    for (const types::block_type &b : blocks) {
+        out += to_hex(b);
+    }
+    BOOST_CHECK_EQUAL(out, sp800_38a_plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(ctr_aes192_encrypt) {
+    // F.5.3 CTR-AES192.Encrypt
+    const std::string key = "8e73b0f7da0e6452c810f32b809079e562f8ead2522c6b7b";
+    const std::string ciphertext =
+        "1abc932417521ca24f2b0459fe7e6e0b090339ec0aa6faefd5ccc2c6f4ce8e94"
+        "1e36b26bd1ebc670d1bd1d665620abf74f78a7f6d29809585a97daec58c6b050";
+
+    BOOST_CHECK_EQUAL(ctr_bulk<block::aes<192>>(key, sp800_38a_iv, sp800_38a_plaintext), ciphertext);
+    BOOST_CHECK_EQUAL(ctr_accumulator<block::aes<192>>(key, sp800_38a_iv, sp800_38a_plaintext), ciphertext);
+}
+
+BOOST_AUTO_TEST_CASE(ctr_aes256_encrypt) {
+    // F.5.5 CTR-AES256.Encrypt
+    const std::string key = "603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4";
+    const std::string ciphertext =
+        "601ec313775789a5b7a7f504bbf3d228f443e3ca4d62b59aca84e990cacaf5c5"
+        "2b0930daa23de94ce87017ba2d84988ddfc9c58db67aada613c2dd08457941a6";
+
+    BOOST_CHECK_EQUAL(ctr_bulk<block::aes<256>>(key, sp800_38a_iv, sp800_38a_plaintext), ciphertext);
+    BOOST_CHECK_EQUAL(ctr_accumulator<block::aes<256>>(key, sp800_38a_iv, sp800_38a_plaintext), ciphertext);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(ctr_stream_test_suite)
+
+BOOST_AUTO_TEST_CASE(ctr_aes128_partial_block_counter_wrap) {
+    // Counter wraps around 2^128 in the middle of the message, the last block is partial
+    std::string input;
+    for (std::size_t i = 0; i != 100; ++i) {
+        input += to_hex(std::vector<std::uint8_t>(1, static_cast<std::uint8_t>(i * 7 + 3)));
+    }
+
+    BOOST_CHECK_EQUAL(ctr_accumulator<block::aes<128>>("2b7e151628aed2a6abf7158809cf4f3c",
+                                                       "fffffffffffffffffffffffffffffffd", input),
+                      "fdf02902f9618f1cac5c92520b30178ea2cd953e74636255832857ea8b80387f"
+                      "691877f9bdf18be01212552a0840efe02ead0a6475cee437b5d069e71eb5e1d3"
+                      "94d8ac98eb57534b55f66fa9d06c4aeaa4056fbb072fbf6614654db0b87c8a15"
+                      "e536ce73");
+}
+
+BOOST_AUTO_TEST_CASE(ctr_aes128_empty_input) {
+    BOOST_CHECK_EQUAL(ctr_accumulator<block::aes<128>>("2b7e151628aed2a6abf7158809cf4f3c", sp800_38a_iv, ""), "");
+}
+
+BOOST_AUTO_TEST_CASE(ctr_aes128_split_calls) {
+    // Any split of the message into encrypt_blocks calls yields the same keystream
+    typedef ctr_types<block::aes<128>> types;
+    typedef types::block_type block_type;
+
+    block::aes<128> cipher = make_cipher<block::aes<128>>("2b7e151628aed2a6abf7158809cf4f3c");
+    block_type iv = make_array<block_type>(sp800_38a_iv);
+
+    std::vector<block_type> plaintext(61);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        plaintext[i].fill(static_cast<std::uint8_t>(i));
+    }
+
+    std::vector<block_type> expected(plaintext.size());
+    types::encryption_mode(cipher, iv).encrypt_blocks(plaintext.data(), expected.data(), plaintext.size());
+
+    const std::size_t splits[] = {1, 3, 7, 8, 9, 16, 17};
+    for (std::size_t split : splits) {
+        types::encryption_mode mode(cipher, iv);
+        std::vector<block_type> out(plaintext.size());
+        for (std::size_t i = 0; i < plaintext.size(); i += split) {
+            std::size_t n = std::min(split, plaintext.size() - i);
+            mode.encrypt_blocks(plaintext.data() + i, out.data() + i, n);
+        }
+        BOOST_CHECK(out == expected);
+    }
+
+    types::encryption_mode mode(cipher, iv);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        BOOST_CHECK(mode.process_block(plaintext[i], 0) == expected[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ctr_aes128_inplace) {
+    // F.5.1, F.5.2 in place, the message is split into whole blocks and a partial last block
+    typedef ctr_types<block::aes<128>> types;
+
+    block::aes<128> cipher = make_cipher<block::aes<128>>("2b7e151628aed2a6abf7158809cf4f3c");
+    types::block_type iv = make_array<types::block_type>(sp800_38a_iv);
+    const std::string ciphertext =
+        "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+        "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee";
+
+    const std::size_t lengths[] = {0, 1, 15, 16, 17, 33, 63, 64};
+    for (std::size_t length : lengths) {
+        std::vector<std::uint8_t> buffer = from_hex(sp800_38a_plaintext.substr(0, 2 * length));
+
+        types::encryption_mode encryption(cipher, iv);
+        std::size_t whole = length / 16 * 16 > 16 ? 16 : length / 16 * 16;
+        encrypt_inplace<block::aes<128>>(buffer.data(), buffer.data() + whole, encryption);
+        encrypt_inplace<block::aes<128>>(buffer.data() + whole, buffer.data() + length, encryption);
+        BOOST_CHECK_EQUAL(to_hex(buffer), ciphertext.substr(0, 2 * length));
+
+        types::decryption_mode decryption(cipher, iv);
+        BOOST_CHECK_EQUAL(to_hex(decrypt_inplace<block::aes<128>>(buffer, decryption)),
+                          sp800_38a_plaintext.substr(0, 2 * length));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
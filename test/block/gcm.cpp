@@ -0,0 +1,375 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE gcm_cipher_mode_test
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+#include <boost/crypto3/block/algorithm/decrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+template<typename Cipher>
+struct gcm_types {
+    typedef block::modes::gcm<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type encryption_mode;
+    typedef typename mode_type::template bind<typename mode_type::decryption_policy>::type decryption_mode;
+    typedef typename Cipher::block_type block_type;
+};
+
+std::vector<std::uint8_t> message(std::size_t n) {
+    std::vector<std::uint8_t> m(n);
+    for (std::size_t i = 0; i != n; ++i) {
+        m[i] = static_cast<std::uint8_t>(i * 7 + 3);
+    }
+    return m;
+}
+
+/*!
+ * @brief Encrypts through the block cipher accumulator, returns the ciphertext followed by the tag
+ */
+template<typename Cipher>
+std::string gcm_accumulator(const std::string &key, const std::string &iv, const std::string &aad,
+                            const std::string &input) {
+    typedef typename gcm_types<Cipher>::encryption_mode mode_type;
+
+    mode_type mode(make_cipher<Cipher>(key), from_hex(iv));
+    mode.process_aad(from_hex(aad));
+
+    block::accumulator_set<mode_type> acc(mode);
+    encrypt<Cipher>(from_hex(input), acc);
+
+    return to_hex(accumulators::extract::block<mode_type>(acc));
+}
+
+/*!
+ * @brief Encrypts whole blocks with process_blocks and the tail with end_message
+ */
+template<typename Cipher>
+std::string gcm_bulk(const std::string &key, const std::string &iv, const std::string &aad, const std::string &input) {
+    typedef gcm_types<Cipher> types;
+    typedef typename types::block_type block_type;
+
+    std::vector<std::uint8_t> in = from_hex(input);
+    std::vector<block_type> blocks(in.size() / 16 + 1);
+    std::copy(in.begin(), in.end(), blocks.front().begin());
+
+    typename types::encryption_mode mode(make_cipher<Cipher>(key), from_hex(iv));
+    mode.process_aad(from_hex(aad));
+    mode.encrypt_blocks(blocks.data(), blocks.data(), blocks.size() - 1);
+
+    block_type last = blocks.back();
+    blocks.back() = mode.end_message(last, in.size() * 8);
+
+    std::string out;
+    for (const block_type &b : blocks) {
+        out += to_hex(b);
+    }
+    return out.substr(0, in.size() * 2) + to_hex(mode.tag(last, in.size() * 8));
+}
+
+/*!
+ * @brief Decrypts through the block cipher accumulator, verifying the tag
+ */
+template<typename Cipher>
+std::string gcm_decrypt(const std::string &key, const std::string &iv, const std::string &aad,
+                        const std::string &input, const std::string &tag) {
+    typedef typename gcm_types<Cipher>::decryption_mode mode_type;
+
+    mode_type mode(make_cipher<Cipher>(key), from_hex(iv), from_hex(tag));
+    mode.process_aad(from_hex(aad));
+
+    block::accumulator_set<mode_type> acc(mode);
+    decrypt<Cipher>(from_hex(input), acc);
+
+    return to_hex(accumulators::extract::block<mode_type>(acc));
+}
+
+struct gcm_vector {
+    const char *key;
+    const char *iv;
+    const char *aad;
+    const char *plaintext;
+    const char *ciphertext;
+    const char *tag;
+};
+
+template<typename Cipher>
+void check_vector(const gcm_vector &v) {
+    std::string expected = std::string(v.ciphertext) + v.tag;
+
+    BOOST_CHECK_EQUAL(gcm_accumulator<Cipher>(v.key, v.iv, v.aad, v.plaintext), expected);
+    BOOST_CHECK_EQUAL(gcm_bulk<Cipher>(v.key, v.iv, v.aad, v.plaintext), expected);
+    BOOST_CHECK_EQUAL(gcm_decrypt<Cipher>(v.key, v.iv, v.aad, v.ciphertext, v.tag), v.plaintext);
+}
+
+// The Galois/Counter Mode of Operation (GCM), McGrew and Viega, Appendix B
+const char *const gcm_key = "feffe9928665731c6d6a8f9467308308";
+const char *const gcm_plaintext =
+    "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+    "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255";
+const char *const gcm_plaintext_60 =
+    "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+    "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39";
+const char *const gcm_aad = "feedfacedeadbeeffeedfacedeadbeefabaddad2";
+
+BOOST_AUTO_TEST_SUITE(gcm_reference_test_suite)
+
+BOOST_AUTO_TEST_CASE(gcm_aes128_test_cases) {
+    const gcm_vector vectors[] = {
+        // Test Case 1
+        {"00000000000000000000000000000000", "000000000000000000000000", "", "", "",
+         "58e2fccefa7e3061367f1d57a4e7455a"},
+        // Test Case 2
+        {"00000000000000000000000000000000", "000000000000000000000000", "", "00000000000000000000000000000000",
+         "0388dace60b6a392f328c2b971b2fe78", "ab6e47d42cec13bdf53a67b21257bddf"},
+        // Test Case 3
+        {gcm_key, "cafebabefacedbaddecaf888", "", gcm_plaintext,
+         "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+         "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985",
+         "4d5c2af327cd64a62cf35abd2ba6fab4"},
+        // Test Case 4
+        {gcm_key, "cafebabefacedbaddecaf888", gcm_aad, gcm_plaintext_60,
+         "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+         "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091",
+         "5bc94fbc3221a5db94fae95ae7121a47"},
+        // Test Case 5, 64-bit IV
+        {gcm_key, "cafebabefacedbad", gcm_aad, gcm_plaintext_60,
+         "61353b4c2806934a777ff51fa22a4755699b2a714fcdc6f83766e5f97b6c7423"
+         "73806900e49f24b22b097544d4896b424989b5e1ebac0f07c23f4598",
+         "3612d2e79e3b0785561be14aaca2fccb"},
+        // Test Case 6, 480-bit IV
+        {gcm_key,
+         "9313225df88406e555909c5aff5269aa6a7a9538534f7da1e4c303d2a318a728"
+         "c3c0c95156809539fcf0e2429a6b525416aedbf5a0de6a57a637b39b",
+         gcm_aad, gcm_plaintext_60,
+         "8ce24998625615b603a033aca13fb894be9112a5c3a211a8ba262a3cca7e2ca7"
+         "01e4a9a4fba43c90ccdcb281d48c7c6fd62875d2aca417034c34aee5",
+         "619cc5aefffe0bfa462af43c1699d050"}};
+
+    for (const gcm_vector &v : vectors) {
+        check_vector<block::aes<128>>(v);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(gcm_aes256_test_cases) {
+    const char *const key = "feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308";
+    const gcm_vector vectors[] = {
+        // Test Case 13
+        {"0000000000000000000000000000000000000000000000000000000000000000", "000000000000000000000000", "", "",
+         "", "530f8afbc74536b9a963b4f1c4cb738b"},
+        // Test Case 14
+        {"0000000000000000000000000000000000000000000000000000000000000000", "000000000000000000000000", "",
+         "00000000000000000000000000000000", "cea7403d4d606b6e074ec5d3baf39d18",
+         "d0d1c8a799996bf0265b98b5d48ab919"},
+        // Test Case 15
+        {key, "cafebabefacedbaddecaf888", "", gcm_plaintext,
+         "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+         "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662898015ad",
+         "b094dac5d93471bdec1a502270e3cc6c"},
+        // Test Case 16
+        {key, "cafebabefacedbaddecaf888", gcm_aad, gcm_plaintext_60,
+         "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+         "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662",
+         "76fc6ece0f4e1768cddf8853bb2d551b"}};
+
+    for (const gcm_vector &v : vectors) {
+        check_vector<block::aes<256>>(v);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(gmac_long_aad) {
+    // Reference tags are produced with OpenSSL GMAC over message(1000)
+    std::string aad = to_hex(message(1000));
+
+    BOOST_CHECK_EQUAL(gcm_accumulator<block::aes<128>>("2b7e151628aed2a6abf7158809cf4f3c", "cafebabefacedbad", aad, ""),
+                      "2a2f880bed8665342d3400dbe8e6e2e3");
+    BOOST_CHECK_EQUAL(gcm_accumulator<block::aes<256>>(
+                          "603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4",
+                          "cafebabefacedbaddecaf888", aad, ""),
+                      "608d7b97ea445f2b96fa7ff886490e28");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(gcm_authentication_test_suite)
+
+BOOST_AUTO_TEST_CASE(gcm_tampered_message) {
+    const char *const iv = "cafebabefacedbaddecaf888";
+    const std::string ciphertext =
+        "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+        "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091";
+    const std::string tag = "5bc94fbc3221a5db94fae95ae7121a47";
+
+    BOOST_CHECK_EQUAL(gcm_decrypt<block::aes<128>>(gcm_key, iv, gcm_aad, ciphertext, tag), gcm_plaintext_60);
+    // Truncated tags are compared by their prefix
+    BOOST_CHECK_EQUAL(gcm_decrypt<block::aes<128>>(gcm_key, iv, gcm_aad, ciphertext, tag.substr(0, 24)),
+                      gcm_plaintext_60);
+
+    std::string bad_ciphertext = ciphertext;
+    bad_ciphertext[bad_ciphertext.size() - 1] = '0';
+    std::string bad_tag = tag;
+    bad_tag[0] = '4';
+
+    BOOST_CHECK_THROW(gcm_decrypt<block::aes<128>>(gcm_key, iv, gcm_aad, bad_ciphertext, tag),
+                      block::authentication_error);
+    BOOST_CHECK_THROW(gcm_decrypt<block::aes<128>>(gcm_key, iv, gcm_aad, ciphertext, bad_tag),
+                      block::authentication_error);
+    BOOST_CHECK_THROW(gcm_decrypt<block::aes<128>>(gcm_key, iv, "feedface", ciphertext, tag),
+                      block::authentication_error);
+}
+
+BOOST_AUTO_TEST_CASE(gcm_streaming_consistency) {
+    // Any split of the associated data and the payload yields the same ciphertext and tag
+    typedef gcm_types<block::aes<128>> types;
+    typedef types::block_type block_type;
+
+    block::aes<128> cipher = make_cipher<block::aes<128>>(gcm_key);
+    std::vector<std::uint8_t> iv = from_hex("cafebabefacedbaddecaf888");
+    std::vector<std::uint8_t> aad = message(77);
+
+    std::vector<block_type> plaintext(61);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        plaintext[i].fill(static_cast<std::uint8_t>(i));
+    }
+
+    types::encryption_mode reference(cipher, iv);
+    reference.process_aad(aad);
+    std::vector<block_type> expected(plaintext.size());
+    reference.encrypt_blocks(plaintext.data(), expected.data(), plaintext.size());
+    types::encryption_mode::tag_type expected_tag = reference.tag();
+
+    const std::size_t splits[] = {1, 3, 7, 8, 9, 16, 17};
+    for (std::size_t split : splits) {
+        types::encryption_mode mode(cipher, iv);
+        for (std::size_t i = 0; i < aad.size(); i += split) {
+            mode.process_aad(aad.begin() + i, aad.begin() + std::min(aad.size(), i + split));
+        }
+
+        std::vector<block_type> out(plaintext.size());
+        for (std::size_t i = 0; i < plaintext.size(); i += split) {
+            std::size_t n = std::min(split, plaintext.size() - i);
+            mode.encrypt_blocks(plaintext.data() + i, out.data() + i, n);
+        }
+        BOOST_CHECK(out == expected);
+        BOOST_CHECK(mode.tag() == expected_tag);
+
+        types::decryption_mode decryption(cipher, iv);
+        decryption.process_aad(aad);
+        std::vector<block_type> decrypted(out);
+        for (std::size_t i = 0; i < decrypted.size(); i += split) {
+            std::size_t n = std::min(split, decrypted.size() - i);
+            decryption.decrypt_blocks(decrypted.data() + i, decrypted.data() + i, n);
+        }
+        BOOST_CHECK(decrypted == plaintext);
+        BOOST_CHECK(decryption.verify(expected_tag));
+    }
+
+    types::encryption_mode mode(cipher, iv);
+    mode.process_aad(aad);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        BOOST_CHECK(mode.process_block(plaintext[i], 0) == expected[i]);
+    }
+    BOOST_CHECK(mode.tag() == expected_tag);
+}
+
+BOOST_AUTO_TEST_CASE(gcm_invalid_arguments) {
+    typedef gcm_types<block::aes<128>> types;
+
+    block::aes<128> cipher = make_cipher<block::aes<128>>(gcm_key);
+    std::vector<std::uint8_t> iv = from_hex("cafebabefacedbaddecaf888");
+
+    BOOST_CHECK_THROW(types::encryption_mode(cipher, std::vector<std::uint8_t>()), std::invalid_argument);
+    BOOST_CHECK_THROW(types::decryption_mode(cipher, iv, std::vector<std::uint8_t>(17)), std::invalid_argument);
+    BOOST_CHECK_THROW(types::decryption_mode(cipher, iv, std::vector<std::uint8_t>(3)), std::invalid_argument);
+    BOOST_CHECK_NO_THROW(types::decryption_mode(cipher, iv, std::vector<std::uint8_t>(4)));
+    BOOST_CHECK_NO_THROW(types::decryption_mode(cipher, iv, std::vector<std::uint8_t>(16)));
+}
+
+/*!
+ * @brief Encryption mode with only a few blocks left before the counter would wrap around
+ */
+struct nearly_exhausted_gcm : gcm_types<block::aes<128>>::encryption_mode {
+    nearly_exhausted_gcm(const block::aes<128> &cipher, const std::vector<std::uint8_t> &iv,
+                         std::uint64_t blocks) :
+        gcm_types<block::aes<128>>::encryption_mode(cipher, iv) {
+        blocks_left = blocks;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(gcm_counter_exhausted) {
+    typedef gcm_types<block::aes<128>>::block_type block_type;
+
+    BOOST_CHECK_EQUAL(gcm_types<block::aes<128>>::encryption_mode(make_cipher<block::aes<128>>(gcm_key),
+                                                                  from_hex("cafebabefacedbaddecaf888"))
+                          .available_blocks(),
+                      (std::uint64_t(1) << 32) - 2);
+
+    nearly_exhausted_gcm mode(make_cipher<block::aes<128>>(gcm_key), from_hex("cafebabefacedbaddecaf888"), 3);
+    block_type blocks[3] = {};
+
+    mode.encrypt_blocks(blocks, blocks, 2);
+    BOOST_CHECK_THROW(mode.encrypt_blocks(blocks, blocks, 2), block::counter_exhausted);
+    BOOST_CHECK_EQUAL(mode.available_blocks(), 1);
+
+    mode.encrypt_blocks(blocks + 2, blocks + 2, 1);
+    BOOST_CHECK_EQUAL(mode.available_blocks(), 0);
+    BOOST_CHECK_THROW(mode.end_message(block_type(), 3 * 128 + 8), block::counter_exhausted);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(ghash_test_suite)
+
+BOOST_AUTO_TEST_CASE(ghash_implementations_agree) {
+    typedef block::detail::ghash_portable_impl::block_type block_type;
+
+    std::mt19937 rng(2020);
+    std::vector<block_type> blocks(67);
+    for (block_type &b : blocks) {
+        for (std::uint8_t &c : b) {
+            c = static_cast<std::uint8_t>(rng());
+        }
+    }
+
+    block_type h = blocks.back();
+    block_type portable = block_type(), dispatched;
+    block::detail::ghash_portable_impl::process_blocks(portable, h, blocks.data(), blocks.size());
+
+    block::detail::ghash hash(h);
+    hash.update(blocks.data(), 5);
+    hash.update(blocks.data() + 5, 20);
+    hash.update(blocks.data() + 25, blocks.size() - 25);
+    dispatched = hash.digest();
+
+    BOOST_CHECK_EQUAL(to_hex(dispatched), to_hex(portable));
+
+#ifdef CRYPTO3_BLOCK_HAS_GHASH_CLMUL
+    if (block::detail::ghash_clmul_impl::is_available()) {
+        block::detail::ghash_clmul_impl::powers_type powers;
+        block::detail::ghash_clmul_impl::schedule_key(h, powers);
+
+        block_type clmul = block_type();
+        block::detail::ghash_clmul_impl::process_blocks(clmul, powers, blocks.data(), blocks.size());
+        BOOST_CHECK_EQUAL(to_hex(clmul), to_hex(portable));
+    }
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,8 @@
 #define BOOST_TEST_MODULE kasumi_cipher_test
 
 #include <iostream>
+#include <memory>
+#include <stdexcept>
 #include <unordered_map>
 
 #include <boost/test/unit_test.hpp>
@@ -36,4 +38,35 @@ BOOST_AUTO_TEST_CASE(kasumi_1) {
     BOOST_CHECK_EQUAL(out, "df1f9b251c0bf45f");
 }
 
+BOOST_AUTO_TEST_CASE(kasumi_64_bit_block) {
+    // KASUMI is a 64-bit block cipher, two blocks of the message are encrypted independently
+    BOOST_STATIC_ASSERT(block::kasumi::block_bits == 64);
+    BOOST_STATIC_ASSERT(std::tuple_size<block::kasumi::block_type>::value == 4);
+
+    std::vector<char> input = {'\xea', '\x02', '\x47', '\x14', '\xad', '\x5c', '\x4d', '\x84',
+                               '\xea', '\x02', '\x47', '\x14', '\xad', '\x5c', '\x4d', '\x84'};
+    std::vector<char> key = {'\x2b', '\xd6', '\x45', '\x9f', '\x82', '\xc5', '\xb3', '\x00',
+                             '\x95', '\x2c', '\x49', '\x10', '\x48', '\x81', '\xff', '\x48'};
+
+    std::string out = encrypt<block::kasumi>(input, key);
+    BOOST_CHECK_EQUAL(out, "df1f9b251c0bf45fdf1f9b251c0bf45f");
+}
+
+BOOST_AUTO_TEST_CASE(kasumi_expanded_key) {
+    block::kasumi::key_type key = {{0x2bd6, 0x459f, 0x82c5, 0xb300, 0x952c, 0x4910, 0x4881, 0xff48}};
+    block::kasumi::block_type plaintext = {{0xea02, 0x4714, 0xad5c, 0x4d84}};
+
+    std::shared_ptr<const block::kasumi::expanded_key> schedule =
+        std::make_shared<const block::kasumi::expanded_key>(key);
+    block::kasumi first(schedule), second(schedule);
+
+    BOOST_CHECK(first.key() == schedule && second.key() == schedule);
+    BOOST_CHECK(first.encrypt(plaintext) == block::kasumi(key).encrypt(plaintext));
+    BOOST_CHECK(second.decrypt(first.encrypt(plaintext)) == plaintext);
+
+    block::kasumi inline_cipher(key);
+    BOOST_CHECK(!inline_cipher.key());
+    BOOST_CHECK_THROW(block::kasumi(std::shared_ptr<const block::kasumi::expanded_key>()), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
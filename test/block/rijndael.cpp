@@ -11,6 +11,9 @@
 
 #include <iostream>
 #include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -368,6 +371,325 @@ BOOST_AUTO_TEST_CASE(aes_256_cipher) {
 
 BOOST_AUTO_TEST_SUITE_END() 
 
+BOOST_AUTO_TEST_SUITE(rijndael_backend_test_suite)
+
+const rijndael_backend all_backends[] = {rijndael_backend::automatic, rijndael_backend::portable,
+                                         rijndael_backend::bitsliced, rijndael_backend::ssse3,
+                                         rijndael_backend::aes_ni,    rijndael_backend::armv8,
+                                         rijndael_backend::power8};
+
+template<typename Cipher>
+void check_backends(const std::string &key, const std::string &plaintext, const std::string &ciphertext) {
+    byte_string k(key), p(plaintext), c(ciphertext);
+
+    typename Cipher::key_type cipher_key;
+    typename Cipher::block_type block;
+    std::copy(k.begin(), k.end(), cipher_key.begin());
+    std::copy(p.begin(), p.end(), block.begin());
+
+    for (rijndael_backend backend : all_backends) {
+        if (!Cipher::is_available(backend)) {
+            BOOST_CHECK_THROW(Cipher(cipher_key, backend), std::invalid_argument);
+            continue;
+        }
+
+        Cipher cipher(cipher_key, backend);
+        BOOST_CHECK(backend == rijndael_backend::automatic || cipher.backend() == backend);
+
+        typename Cipher::block_type encrypted = cipher.encrypt(block);
+        BOOST_CHECK(std::equal(encrypted.begin(), encrypted.end(), c.begin()));
+        BOOST_CHECK(cipher.decrypt(encrypted) == block);
+
+        typename Cipher::block_type blocks[9], out[9];
+        std::fill(blocks, blocks + 9, block);
+        cipher.encrypt_blocks(blocks, out, 9);
+        BOOST_CHECK(std::count(out, out + 9, encrypted) == 9);
+
+        cipher.decrypt_blocks(out, blocks, 9);
+        BOOST_CHECK(std::count(blocks, blocks + 9, block) == 9);
+    }
+}
+
+// FIPS-197, C.1 - C.3
+BOOST_AUTO_TEST_CASE(aes_128_backends) {
+    check_backends<aes<128>>("000102030405060708090a0b0c0d0e0f", "00112233445566778899aabbccddeeff",
+                             "69c4e0d86a7b0430d8cdb78070b4c55a");
+}
+
+BOOST_AUTO_TEST_CASE(aes_192_backends) {
+    check_backends<aes<192>>("000102030405060708090a0b0c0d0e0f1011121314151617", "00112233445566778899aabbccddeeff",
+                             "dda97ca4864cdfe06eaf70a0ec0d7191");
+}
+
+BOOST_AUTO_TEST_CASE(aes_256_backends) {
+    check_backends<aes<256>>("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+                             "00112233445566778899aabbccddeeff", "8ea2b7ca516745bfeafc49904b496089");
+}
+
+template<typename Cipher>
+void check_bitsliced_against_portable() {
+    // Every amount of blocks up to two full bitsliced batches and a partial one
+    typename Cipher::key_type key;
+    std::vector<typename Cipher::block_type> in(11), expected(11), out(11);
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i * 29 + 7);
+    }
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        for (std::size_t j = 0; j != 16; ++j) {
+            in[i][j] = static_cast<std::uint8_t>(i * 16 + j * 13);
+        }
+    }
+
+    Cipher portable(key, rijndael_backend::portable), bitsliced(key, rijndael_backend::bitsliced);
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        expected[i] = portable.encrypt(in[i]);
+    }
+
+    for (std::size_t n = 0; n <= in.size(); ++n) {
+        std::fill(out.begin(), out.end(), typename Cipher::block_type());
+        bitsliced.encrypt_blocks(in.data(), out.data(), n);
+        BOOST_CHECK(std::equal(out.begin(), out.begin() + n, expected.begin()));
+        BOOST_CHECK_EQUAL(std::count(out.begin() + n, out.end(), typename Cipher::block_type()),
+                          static_cast<std::ptrdiff_t>(in.size() - n));
+    }
+
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        BOOST_CHECK(bitsliced.decrypt(expected[i]) == in[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(aes_bitsliced_backend) {
+    check_bitsliced_against_portable<aes<128>>();
+    check_bitsliced_against_portable<aes<192>>();
+    check_bitsliced_against_portable<aes<256>>();
+}
+
+BOOST_AUTO_TEST_CASE(rijndael_wide_block_backend) {
+    // Blocks wider than 128 bits have no hardware implementation
+    typedef rijndael<128, 256> cipher_type;
+    cipher_type::key_type key = {0};
+    BOOST_CHECK(cipher_type(key).backend() == rijndael_backend::portable);
+    BOOST_CHECK(cipher_type(key, rijndael_backend::aes_ni).backend() == rijndael_backend::portable);
+}
+
+template<typename Cipher>
+void check_round_trip() {
+    // ShiftRows rotates every row by up to block_words - 1 columns, the inverse one the other way
+    typename Cipher::key_type key;
+    typename Cipher::block_type block;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i * 29 + 7);
+    }
+    for (std::size_t i = 0; i != block.size(); ++i) {
+        block[i] = static_cast<std::uint8_t>(i * 13 + 1);
+    }
+
+    Cipher cipher(key, rijndael_backend::portable);
+    typename Cipher::block_type ciphertext = cipher.encrypt(block);
+    BOOST_CHECK(ciphertext != block);
+    BOOST_CHECK(cipher.decrypt(ciphertext) == block);
+}
+
+BOOST_AUTO_TEST_CASE(rijndael_portable_block_sizes) {
+    check_round_trip<rijndael<128, 128>>();
+    check_round_trip<rijndael<128, 160>>();
+    check_round_trip<rijndael<128, 192>>();
+    check_round_trip<rijndael<128, 224>>();
+    check_round_trip<rijndael<128, 256>>();
+    check_round_trip<rijndael<256, 256>>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(rijndael_output_test_suite)
+
+BOOST_AUTO_TEST_CASE(aes_128_streamed_output) {
+    // Several output chunks of the iterator interface and a partial one
+    typedef aes<128> cipher_type;
+
+    std::vector<std::uint8_t> key(16), in((3 * 4096 + 37) * 16);
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i * 29 + 7);
+    }
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        in[i] = static_cast<std::uint8_t>(i * 13 + i / 251);
+    }
+
+    cipher_type::key_type cipher_key;
+    std::copy(key.begin(), key.end(), cipher_key.begin());
+    cipher_type cipher(cipher_key);
+
+    std::vector<std::uint8_t> expected(in.size());
+    for (std::size_t i = 0; i != in.size(); i += 16) {
+        cipher_type::block_type block;
+        std::copy(in.begin() + i, in.begin() + i + 16, block.begin());
+        block = cipher.encrypt(block);
+        std::copy(block.begin(), block.end(), expected.begin() + i);
+    }
+
+    std::vector<std::uint8_t> out(in.size());
+    BOOST_CHECK(encrypt<cipher_type>(in.begin(), in.end(), key, out.begin()) == out.end());
+    BOOST_CHECK(out == expected);
+
+    std::vector<std::uint8_t> appended;
+    encrypt<cipher_type>(in.begin(), in.end(), key, std::back_inserter(appended));
+    BOOST_CHECK(appended == expected);
+
+    std::vector<std::uint8_t> converted = encrypt<cipher_type>(in, key);
+    BOOST_CHECK(converted == expected);
+}
+
+BOOST_AUTO_TEST_CASE(aes_128_inplace) {
+    // F.1.1, F.1.2 in place at an unaligned offset
+    std::string plaintext = "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+                            "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+    byte_string key("2b7e151628aed2a6abf7158809cf4f3c"), p(plaintext);
+
+    std::string buffer(1, '\0');
+    buffer.append(p.begin(), p.end());
+
+    std::string message = buffer.substr(1);
+    encrypt_inplace<aes<128>>(message, key);
+    BOOST_CHECK_EQUAL(byte_string(message.begin(), message.end()),
+                      byte_string("3ad77bb40d7a3660a89ecaf32466ef97f5d3d58503b9699de785895a96fdbaaf"
+                                  "43b1cd7f598ece23881b00e3ed0306887b0c785e27e8ad3f8223207104725dd4"));
+
+    octet_type *first = reinterpret_cast<octet_type *>(&buffer[1]);
+    aes<128>::key_type cipher_key;
+    std::copy(key.begin(), key.end(), cipher_key.begin());
+    modes::isomorphic<aes<128>, nop_padding>::bind<encryption_policy<aes<128>>>::type mode((aes<128>(cipher_key)));
+    encrypt_inplace<aes<128>>(first, first + p.size(), mode);
+    BOOST_CHECK(buffer.substr(1) == message);
+
+    decrypt_inplace<aes<128>>(message, key);
+    BOOST_CHECK_EQUAL(byte_string(message.begin(), message.end()), byte_string(plaintext));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(rijndael_expanded_key_test_suite)
+
+template<typename Cipher>
+void check_expanded_key(const std::string &key, const std::string &plaintext, const std::string &ciphertext) {
+    typedef typename Cipher::expanded_key expanded_key_type;
+    typedef typename Cipher::block_type block_type;
+
+    byte_string k(key), p(plaintext), c(ciphertext);
+
+    typename Cipher::key_type cipher_key;
+    block_type block, expected;
+    std::copy(k.begin(), k.end(), cipher_key.begin());
+    std::copy(p.begin(), p.end(), block.begin());
+    std::copy(c.begin(), c.end(), expected.begin());
+
+    for (rijndael_backend backend : rijndael_backend_test_suite::all_backends) {
+        if (!Cipher::is_available(backend)) {
+            BOOST_CHECK_THROW(expanded_key_type(cipher_key, key_usage::both, backend), std::invalid_argument);
+            continue;
+        }
+
+        std::shared_ptr<const expanded_key_type> both =
+            std::make_shared<const expanded_key_type>(cipher_key, key_usage::both, backend);
+        BOOST_CHECK(backend == rijndael_backend::automatic || both->backend() == backend);
+        BOOST_CHECK(both->usage() == key_usage::both);
+
+        // Ciphers refer to the shared schedule instead of copying it
+        Cipher first(both), second(both);
+        BOOST_CHECK(first.key() == both && second.key() == both);
+        BOOST_CHECK(first.backend() == both->backend());
+        BOOST_CHECK(first.encrypt(block) == expected);
+        BOOST_CHECK(second.decrypt(expected) == block);
+
+        Cipher encryptor(std::make_shared<const expanded_key_type>(cipher_key, key_usage::encryption, backend));
+        BOOST_CHECK(encryptor.key()->usage() == key_usage::encryption);
+        BOOST_CHECK(encryptor.encrypt(block) == expected);
+
+        block_type blocks[9], out[9];
+        std::fill(blocks, blocks + 9, block);
+        encryptor.encrypt_blocks(blocks, out, 9);
+        BOOST_CHECK(std::count(out, out + 9, expected) == 9);
+
+        Cipher decryptor(std::make_shared<const expanded_key_type>(cipher_key, key_usage::decryption, backend));
+        BOOST_CHECK(decryptor.key()->usage() == key_usage::decryption);
+        BOOST_CHECK(decryptor.decrypt(expected) == block);
+
+        decryptor.decrypt_blocks(out, blocks, 9);
+        BOOST_CHECK(std::count(blocks, blocks + 9, block) == 9);
+
+        // The wiped schedule of the other direction is never used
+        BOOST_CHECK_THROW(encryptor.decrypt(expected), std::invalid_argument);
+        BOOST_CHECK_THROW(encryptor.decrypt_blocks(out, blocks, 9), std::invalid_argument);
+        BOOST_CHECK_THROW(decryptor.encrypt(block), std::invalid_argument);
+        BOOST_CHECK_THROW(decryptor.encrypt_blocks(blocks, out, 9), std::invalid_argument);
+
+        BOOST_CHECK_THROW(Cipher(std::shared_ptr<const expanded_key_type>()), std::invalid_argument);
+
+        // Raw keys are expanded in place, copies carry their own schedule
+        Cipher inline_cipher(cipher_key, backend);
+        Cipher copy = inline_cipher;
+        BOOST_CHECK(!inline_cipher.key() && !copy.key());
+        BOOST_CHECK(copy.backend() == both->backend());
+        BOOST_CHECK(copy.encrypt(block) == expected);
+        BOOST_CHECK(copy.decrypt(expected) == block);
+    }
+}
+
+// FIPS-197, C.1 - C.3
+BOOST_AUTO_TEST_CASE(aes_128_expanded_key) {
+    check_expanded_key<aes<128>>("000102030405060708090a0b0c0d0e0f", "00112233445566778899aabbccddeeff",
+                                 "69c4e0d86a7b0430d8cdb78070b4c55a");
+}
+
+BOOST_AUTO_TEST_CASE(aes_192_expanded_key) {
+    check_expanded_key<aes<192>>("000102030405060708090a0b0c0d0e0f1011121314151617",
+                                 "00112233445566778899aabbccddeeff", "dda97ca4864cdfe06eaf70a0ec0d7191");
+}
+
+BOOST_AUTO_TEST_CASE(aes_256_expanded_key) {
+    check_expanded_key<aes<256>>("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+                                 "00112233445566778899aabbccddeeff", "8ea2b7ca516745bfeafc49904b496089");
+}
+
+BOOST_AUTO_TEST_CASE(aes_128_expanded_key_shared_across_threads) {
+    typedef aes<128> cipher_type;
+
+    byte_string k("2b7e151628aed2a6abf7158809cf4f3c");
+    cipher_type::key_type key;
+    std::copy(k.begin(), k.end(), key.begin());
+
+    std::shared_ptr<const cipher_type::expanded_key> schedule =
+        std::make_shared<const cipher_type::expanded_key>(key, key_usage::encryption);
+
+    std::vector<cipher_type::block_type> expected(64);
+    for (std::size_t i = 0; i != expected.size(); ++i) {
+        cipher_type::block_type block;
+        block.fill(static_cast<std::uint8_t>(i));
+        expected[i] = cipher_type(key).encrypt(block);
+    }
+
+    std::vector<std::vector<cipher_type::block_type>> results(4);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t != results.size(); ++t) {
+        workers.emplace_back([&schedule, &results, t]() {
+            cipher_type cipher(schedule);
+            for (std::size_t i = 0; i != 64; ++i) {
+                cipher_type::block_type block;
+                block.fill(static_cast<std::uint8_t>(i));
+                results[t].push_back(cipher.encrypt(block));
+            }
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+
+    for (const std::vector<cipher_type::block_type> &result : results) {
+        BOOST_CHECK(result == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 /*
 BOOST_AUTO_TEST_SUITE(aes_various_containers_test_suite)
 
@@ -10,6 +10,9 @@
 #define BOOST_TEST_MODULE shacal2_cipher_test
 
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -46,4 +49,82 @@ BOOST_AUTO_TEST_CASE(shacal2_single_block_encrypt1) {
     BOOST_CHECK_EQUAL(plaintext, new_plaintext);
 }
 
+BOOST_AUTO_TEST_CASE(shacal2_inplace) {
+    // Blocks of 32-bit words are packed into a batch and back, words are little-endian octets
+    typedef block::shacal2<256> bct;
+
+    std::vector<std::uint8_t> buffer(3 * 32), key(64);
+    for (std::size_t i = 0; i != buffer.size(); ++i) {
+        buffer[i] = static_cast<std::uint8_t>(i * 7 + 1);
+    }
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i * 13 + 5);
+    }
+    std::vector<std::uint8_t> plaintext = buffer;
+
+    auto word = [](const std::vector<std::uint8_t> &v, std::size_t i) {
+        return std::uint32_t(v[4 * i]) | std::uint32_t(v[4 * i + 1]) << 8 | std::uint32_t(v[4 * i + 2]) << 16 |
+               std::uint32_t(v[4 * i + 3]) << 24;
+    };
+
+    bct::key_type k;
+    for (std::size_t i = 0; i != k.size(); ++i) {
+        k[i] = word(key, i);
+    }
+    bct cipher(k);
+
+    encrypt_inplace<bct>(buffer, key);
+    for (std::size_t b = 0; b != 3; ++b) {
+        bct::block_type p, c;
+        for (std::size_t i = 0; i != p.size(); ++i) {
+            p[i] = word(plaintext, b * 8 + i);
+            c[i] = word(buffer, b * 8 + i);
+        }
+        BOOST_CHECK_EQUAL(cipher.encrypt(p), c);
+    }
+
+    decrypt_inplace<bct>(buffer, key);
+    BOOST_CHECK(buffer == plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(shacal2_range) {
+    // Every block of 32-bit words is output as 32 octets, not as 8
+    typedef block::shacal2<256> bct;
+
+    std::vector<std::uint8_t> plaintext(5 * 32), key(64);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        plaintext[i] = static_cast<std::uint8_t>(i * 7 + 1);
+    }
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i * 13 + 5);
+    }
+
+    std::vector<std::uint8_t> expected = plaintext;
+    encrypt_inplace<bct>(expected, key);
+
+    std::vector<std::uint8_t> ciphertext = encrypt<bct>(plaintext, key);
+    BOOST_CHECK(ciphertext == expected);
+
+    std::vector<std::uint8_t> decrypted = decrypt<bct>(ciphertext, key);
+    BOOST_CHECK(decrypted == plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(shacal2_expanded_key) {
+    typedef block::shacal2<256> bct;
+
+    bct::block_type plaintext = {
+        {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19}};
+    bct::key_type key = {{0x80000000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
+    bct::block_type expected_ciphertext = {
+        {0x79a6dddb, 0xdd946d8f, 0x5e8d0156, 0xf41fc3ea, 0xd69fef65, 0xc9962ac0, 0x8511bf70, 0x1c71eb3c}};
+
+    std::shared_ptr<const bct::expanded_key> schedule = std::make_shared<const bct::expanded_key>(key);
+    bct first(schedule), second(schedule);
+
+    BOOST_CHECK(first.key() == schedule && second.key() == schedule);
+    BOOST_CHECK_EQUAL(first.encrypt(plaintext), expected_ciphertext);
+    BOOST_CHECK_EQUAL(second.decrypt(expected_ciphertext), plaintext);
+    BOOST_CHECK_THROW(bct(std::shared_ptr<const bct::expanded_key>()), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,249 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE xts_cipher_mode_test
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+
+#include <boost/crypto3/block/aes.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+template<typename Cipher>
+struct xts_types {
+    typedef block::modes::xts<Cipher> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type xts_mode;
+    typedef typename Cipher::block_type block_type;
+};
+
+/*!
+ * @brief Mode keyed with the concatenation of the data and the tweak keys
+ */
+template<typename Cipher>
+typename xts_types<Cipher>::xts_mode make_mode(const std::string &key, std::size_t threads = 1) {
+    return typename xts_types<Cipher>::xts_mode(make_cipher<Cipher>(key.substr(0, key.size() / 2)),
+                                                make_cipher<Cipher>(key.substr(key.size() / 2)), threads);
+}
+
+/*!
+ * @brief Encrypts a single data unit and checks that it decrypts back
+ */
+template<typename Cipher>
+std::string xts_encrypt(const std::string &key, std::uint64_t sector, const std::string &plaintext) {
+    typename xts_types<Cipher>::xts_mode mode = make_mode<Cipher>(key);
+
+    std::vector<std::uint8_t> data = from_hex(plaintext);
+    mode.encrypt_sectors(sector, data.size(), data.data(), data.data(), 1);
+    std::string ciphertext = to_hex(data);
+
+    mode.decrypt_sectors(sector, data.size(), data.data(), data.data(), 1);
+    BOOST_CHECK_EQUAL(to_hex(data), plaintext);
+
+    return ciphertext;
+}
+
+std::string counting_octets(std::size_t n) {
+    std::vector<std::uint8_t> out(n);
+    for (std::size_t i = 0; i != n; ++i) {
+        out[i] = static_cast<std::uint8_t>(i);
+    }
+    return to_hex(out);
+}
+
+BOOST_AUTO_TEST_SUITE(xts_ieee1619_test_suite)
+
+BOOST_AUTO_TEST_CASE(xts_aes128_vectors_1_3) {
+    BOOST_CHECK_EQUAL(xts_encrypt<block::aes<128>>(std::string(64, '0'), 0, std::string(64, '0')),
+                      "917cf69ebd68b2ec9b9fe9a3eadda692cd43d2f59598ed858c02c2652fbf922e");
+    BOOST_CHECK_EQUAL(xts_encrypt<block::aes<128>>("11111111111111111111111111111111"
+                                                   "22222222222222222222222222222222",
+                                                   0x3333333333, std::string(64, '4')),
+                      "c454185e6a16936e39334038acef838bfb186fff7480adc4289382ecd6d394f0");
+    BOOST_CHECK_EQUAL(xts_encrypt<block::aes<128>>("fffefdfcfbfaf9f8f7f6f5f4f3f2f1f0"
+                                                   "22222222222222222222222222222222",
+                                                   0x3333333333, std::string(64, '4')),
+                      "af85336b597afc1a900b2eb21ec949d292df4c047e0b21532186a5971a227a89");
+}
+
+BOOST_AUTO_TEST_CASE(xts_aes128_vector_4) {
+    BOOST_CHECK_EQUAL(xts_encrypt<block::aes<128>>("27182818284590452353602874713526"
+                                                   "31415926535897932384626433832795",
+                                                   0, counting_octets(256) + counting_octets(256)),
+                      "27a7479befa1d476489f308cd4cfa6e2a96e4bbe3208ff25287dd3819616e89cc78cf7f5e543445f8333d8fa7f560000"
+                      "05279fa5d8b5e4ad40e736ddb4d35412328063fd2aab53e5ea1e0a9f332500a5df9487d07a5c92cc512c8866c7e860ce"
+                      "93fdf166a24912b422976146ae20ce846bb7dc9ba94a767aaef20c0d61ad02655ea92dc4c4e41a8952c651d33174be51"
+                      "a10c421110e6d81588ede82103a252d8a750e8768defffed9122810aaeb99f9172af82b604dc4b8e51bcb08235a6f434"
+                      "1332e4ca60482a4ba1a03b3e65008fc5da76b70bf1690db4eae29c5f1badd03c5ccf2a55d705ddcd86d449511ceb7ec3"
+                      "0bf12b1fa35b913f9f747a8afd1b130e94bff94effd01a91735ca1726acd0b197c4e5b03393697e126826fb6bbde8ecc"
+                      "1e08298516e2c9ed03ff3c1b7860f6de76d4cecd94c8119855ef5297ca67e9f3e7ff72b1e99785ca0a7e7720c5b36dc6"
+                      "d72cac9574c8cbbc2f801e23e56fd344b07f22154beba0f08ce8891e643ed995c94d9a69c9f1b5f499027a78572aeebd"
+                      "74d20cc39881c213ee770b1010e4bea718846977ae119f7a023ab58cca0ad752afe656bb3c17256a9f6e9bf19fdd5a38"
+                      "fc82bbe872c5539edb609ef4f79c203ebb140f2e583cb2ad15b4aa5b655016a8449277dbd477ef2c8d6c017db738b18d"
+                      "eb4a427d1923ce3ff262735779a418f20a282df920147beabe421ee5319d0568");
+}
+
+BOOST_AUTO_TEST_CASE(xts_aes256_vector_10) {
+    BOOST_CHECK_EQUAL(xts_encrypt<block::aes<256>>("2718281828459045235360287471352662497757247093699959574966967627"
+                                                   "3141592653589793238462643383279502884197169399375105820974944592",
+                                                   0xff, counting_octets(256) + counting_octets(256)),
+                      "1c3b3a102f770386e4836c99e370cf9bea00803f5e482357a4ae12d414a3e63b5d31e276f8fe4a8d66b317f9ac683f44"
+                      "680a86ac35adfc3345befecb4bb188fd5776926c49a3095eb108fd1098baec70aaa66999a72a82f27d848b21d4a741b0"
+                      "c5cd4d5fff9dac89aeba122961d03a757123e9870f8acf1000020887891429ca2a3e7a7d7df7b10355165c8b9a6d0a7d"
+                      "e8b062c4500dc4cd120c0f7418dae3d0b5781c34803fa75421c790dfe1de1834f280d7667b327f6c8cd7557e12ac3a0f"
+                      "93ec05c52e0493ef31a12d3d9260f79a289d6a379bc70c50841473d1a8cc81ec583e9645e07b8d9670655ba5bbcfecc6"
+                      "dc3966380ad8fecb17b6ba02469a020a84e18e8f84252070c13e9f1f289be54fbc481457778f616015e1327a02b140f1"
+                      "505eb309326d68378f8374595c849d84f4c333ec4423885143cb47bd71c5edae9be69a2ffeceb1bec9de244fbe15992b"
+                      "11b77c040f12bd8f6a975a44a0f90c29a9abc3d4d893927284c58754cce294529f8614dcd2aba991925fedc4ae74ffac"
+                      "6e333b93eb4aff0479da9a410e4450e0dd7ae4c6e2910900575da401fc07059f645e8b7e9bfdef33943054ff84011493"
+                      "c27b3429eaedb4ed5376441a77ed43851ad77f16f541dfd269d50d6a5f14fb0aab1cbb4c1550be97f7ab4066193c4caa"
+                      "773dad38014bd2092fa755c824bb5e54c4f36ffda9fcea70b9c6e693e148c151");
+}
+
+BOOST_AUTO_TEST_CASE(xts_aes128_vectors_15_18) {
+    // Ciphertext stealing, the sectors are not a multiple of the block length
+    const std::string key = "fffefdfcfbfaf9f8f7f6f5f4f3f2f1f0bfbebdbcbbbab9b8b7b6b5b4b3b2b1b0";
+
+    BOOST_CHECK_EQUAL(xts_encrypt<block::aes<128>>(key, 0x123456789a, counting_octets(17)),
+                      "6c1625db4671522d3d7599601de7ca09ed");
+    BOOST_CHECK_EQUAL(xts_encrypt<block::aes<128>>(key, 0x123456789a, counting_octets(18)),
+                      "d069444b7a7e0cab09e24447d24deb1fedbf");
+    BOOST_CHECK_EQUAL(xts_encrypt<block::aes<128>>(key, 0x123456789a, counting_octets(19)),
+                      "e5df1351c0544ba1350b3363cd8ef4beedbf9d");
+    BOOST_CHECK_EQUAL(xts_encrypt<block::aes<128>>(key, 0x123456789a, counting_octets(20)),
+                      "9d84c813f719aa2c7be3f66171c7c5c2edbf9dac");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(xts_sectors_test_suite)
+
+BOOST_AUTO_TEST_CASE(xts_aes128_sector_runs) {
+    // A run of sectors is the same as the sectors one by one, whatever the thread count
+    const std::string key = "2718281828459045235360287471352631415926535897932384626433832795";
+    const std::size_t sector_sizes[] = {16, 100, 512, 4096 + 7};
+
+    for (std::size_t sector_size : sector_sizes) {
+        const std::size_t n = 37;
+        std::vector<std::uint8_t> plaintext(sector_size * n);
+        for (std::size_t i = 0; i != plaintext.size(); ++i) {
+            plaintext[i] = static_cast<std::uint8_t>(i * 31 + 7);
+        }
+
+        xts_types<block::aes<128>>::xts_mode mode = make_mode<block::aes<128>>(key);
+        std::vector<std::uint8_t> expected(plaintext.size());
+        for (std::size_t i = 0; i != n; ++i) {
+            mode.encrypt_sectors(1000 + i, sector_size, plaintext.data() + i * sector_size,
+                                 expected.data() + i * sector_size, 1);
+        }
+
+        const std::size_t thread_counts[] = {1, 3, 0};
+        for (std::size_t threads : thread_counts) {
+            xts_types<block::aes<128>>::xts_mode parallel = make_mode<block::aes<128>>(key, threads);
+            std::vector<std::uint8_t> data = plaintext;
+            parallel.encrypt_sectors(1000, sector_size, data.data(), data.data(), n);
+            BOOST_CHECK(data == expected);
+            parallel.decrypt_sectors(1000, sector_size, data.data(), data.data(), n);
+            BOOST_CHECK(data == plaintext);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(xts_aes128_sector_runs_on_executor) {
+    const std::string key = "2718281828459045235360287471352631415926535897932384626433832795";
+    const std::size_t sector_size = 4096, n = 16;
+    std::vector<std::uint8_t> plaintext(sector_size * n);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        plaintext[i] = static_cast<std::uint8_t>(i * 13 + 5);
+    }
+
+    std::vector<std::uint8_t> expected(plaintext.size());
+    make_mode<block::aes<128>>(key).encrypt_sectors(7, sector_size, plaintext.data(), expected.data(), n);
+
+    // Runs the parts backwards on the calling thread, no threads are started by the mode
+    std::size_t calls = 0;
+    bulk_executor executor = [&calls](std::size_t parts, const std::function<void(std::size_t)> &task) {
+        ++calls;
+        for (std::size_t i = parts; i != 0; --i) {
+            task(i - 1);
+        }
+    };
+
+    xts_types<block::aes<128>>::xts_mode mode(make_cipher<block::aes<128>>(key.substr(0, key.size() / 2)),
+                                              make_cipher<block::aes<128>>(key.substr(key.size() / 2)), executor, 4);
+    std::vector<std::uint8_t> data = plaintext;
+    mode.encrypt_sectors(7, sector_size, data.data(), data.data(), n);
+    BOOST_CHECK(data == expected);
+    mode.decrypt_sectors(7, sector_size, data.data(), data.data(), n);
+    BOOST_CHECK(data == plaintext);
+    BOOST_CHECK_EQUAL(calls, 2);
+
+    // Runs too short to be split do not reach the executor
+    mode.encrypt_sectors(7, sector_size, data.data(), data.data(), 1);
+    BOOST_CHECK_EQUAL(calls, 2);
+}
+
+BOOST_AUTO_TEST_CASE(xts_aes128_sector_size_out_of_range) {
+    xts_types<block::aes<128>>::xts_mode mode =
+        make_mode<block::aes<128>>("fffefdfcfbfaf9f8f7f6f5f4f3f2f1f0bfbebdbcbbbab9b8b7b6b5b4b3b2b1b0");
+    std::vector<std::uint8_t> data(32);
+
+    BOOST_CHECK_THROW(mode.encrypt_sectors(0, 15, data.data(), data.data(), 2), std::invalid_argument);
+    BOOST_CHECK_THROW(mode.decrypt_sectors(0, 0, data.data(), data.data(), 1), std::invalid_argument);
+}
+
+#ifdef CRYPTO3_BLOCK_HAS_XTS_TWEAK_SSE2
+BOOST_AUTO_TEST_CASE(xts_tweak_sse2_against_portable) {
+    typedef block::detail::xts_tweak_portable_impl::block_type block_type;
+
+    if (!block::detail::xts_tweak_sse2_impl::is_available()) {
+        return;
+    }
+
+    // Tweaks with every combination of the lane carries set
+    for (unsigned pattern = 0; pattern != 16; ++pattern) {
+        block_type t, u;
+        for (std::size_t i = 0; i != t.size(); ++i) {
+            t[i] = static_cast<std::uint8_t>(i * 29 + 1);
+        }
+        for (std::size_t lane = 0; lane != 4; ++lane) {
+            t[lane * 4 + 3] = (pattern >> lane & 1) ? 0xc0 : 0x40;
+        }
+        u = t;
+
+        const std::size_t n = 67;
+        std::vector<std::uint8_t> in(n * 16), unwhitened(in.size());
+        for (std::size_t i = 0; i != in.size(); ++i) {
+            in[i] = static_cast<std::uint8_t>(i * 7);
+        }
+
+        std::vector<block_type> out1(n), out2(n), tweaks1(n), tweaks2(n);
+        block::detail::xts_tweak_portable_impl::whiten(t, in.data(), out1.data(), tweaks1.data(), n);
+        block::detail::xts_tweak_sse2_impl::whiten(u, in.data(), out2.data(), tweaks2.data(), n);
+        BOOST_CHECK(t == u);
+        BOOST_CHECK(out1 == out2);
+        BOOST_CHECK(tweaks1 == tweaks2);
+
+        block::detail::xts_tweak_sse2_impl::unwhiten(out2.data(), tweaks2.data(), unwhitened.data(), n);
+        BOOST_CHECK(unwhitened == in);
+        block::detail::xts_tweak_portable_impl::unwhiten(out1.data(), tweaks1.data(), unwhitened.data(), n);
+        BOOST_CHECK(unwhitened == in);
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,12 +10,17 @@
 
 #define BOOST_TEST_MODULE base_codec_test
 
+#include <cstdlib>
+#include <new>
 #include <iostream>
 #include <string>
 #include <vector>
 #include <array>
 #include <iterator>
 #include <algorithm>
+#include <list>
+#include <random>
+#include <stdexcept>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -30,9 +35,30 @@
 
 #include <boost/crypto3/codec/base.hpp>
 
+#include <fixtures.hpp>
+
 using namespace boost::crypto3::codec;
 using namespace boost::crypto3;
 
+// Heap allocations made so far, to check the codecs that promise none
+std::size_t allocations = 0;
+
+void *operator new(std::size_t size) {
+    ++allocations;
+    if (void *p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
 namespace boost {
     namespace test_tools {
         namespace tt_detail {
@@ -409,6 +435,95 @@ BOOST_DATA_TEST_CASE(base58_single_range_random_encode_decode,
     BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), arr.begin(), arr.end());
 }
 
+BOOST_AUTO_TEST_CASE(base58_long_input) {
+    // Inputs spanning many limbs, with leading zeros, against an independent big integer implementation
+    std::vector<std::uint8_t> counting(32), zero_led(66, 0), saturated(100, 0xff);
+    for (std::size_t i = 0; i != counting.size(); ++i) {
+        counting[i] = static_cast<std::uint8_t>(i);
+    }
+    for (std::size_t i = 0; i != 64; ++i) {
+        zero_led[i + 2] = static_cast<std::uint8_t>(i * 37 + 11);
+    }
+
+    std::string encoded_counting = encode<base58>(counting), encoded_zero_led = encode<base58>(zero_led),
+                encoded_saturated = encode<base58>(saturated);
+    BOOST_CHECK_EQUAL(encoded_counting, "1thX6LZfHDZZKUs92febYZhYRcXddmzfzF2NvTkPNE");
+    BOOST_CHECK_EQUAL(encoded_zero_led,
+                      "11DyXZZCSiBREJ8YZ5cULd7PVdKpbkhHvHJ7otbJmLJajJtRsyq1irMMqKimYeKvRmZ8Sc2qWLhKjYR4ekM8RSzk"
+                      "V");
+    BOOST_CHECK_EQUAL(encoded_saturated,
+                      "Ax4Cst39tDs1YtZYrvAiERa7TNeGUce5k5pBqM9AkvS29vSeM6zPSYyFZ3gftD8m4AVRyRe32piB8Pw5hvBZU9WGTkN"
+                      "XfKpPzSkuUVV3HDTieA3CEhPKWCBHNjVjyYYtyBqcf6mWv");
+
+    for (const std::vector<std::uint8_t> &v : {counting, zero_led, saturated}) {
+        std::string encoded = encode<base58>(v);
+        std::vector<std::uint8_t> out = decode<base58>(encoded);
+        BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), v.begin(), v.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base58_random_lengths) {
+    // Zero values and lengths beyond the stack buffer of the limb arithmetic
+    std::mt19937 rng(5858);
+    for (std::size_t n : {1, 2, 3, 4, 5, 7, 8, 9, 33, 255, 512, 513, 1024}) {
+        std::vector<std::uint8_t> zeros(n, 0), random(n);
+        for (std::uint8_t &c : random) {
+            c = static_cast<std::uint8_t>(rng());
+        }
+
+        std::string encoded_zeros = encode<base58>(zeros);
+        BOOST_CHECK_EQUAL(encoded_zeros, std::string(n, '1'));
+
+        for (const std::vector<std::uint8_t> &v : {zeros, random}) {
+            std::string encoded = encode<base58>(v);
+            std::vector<std::uint8_t> out = decode<base58>(encoded);
+            BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), v.begin(), v.end());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base58_allocations) {
+    // Address, key identifier and signature sizes, then lengths up to the stack buffer of the limb arithmetic
+    typedef codec::detail::base_policy<58> base58_policy_type;
+
+    std::mt19937 rng(2558);
+    for (std::size_t n : {20, 25, 33, 65, 82, 128, 300, 512}) {
+        std::vector<std::uint8_t> v(n);
+        for (std::uint8_t &c : v) {
+            c = static_cast<std::uint8_t>(rng());
+        }
+        v[0] = v[1] = 0;
+        std::string expected = encode<base58>(v);
+
+        std::array<std::uint8_t, base58::encoded_size(512)> encoded;
+        std::array<std::uint8_t, 512> decoded;
+
+        std::size_t before = allocations;
+        std::uint8_t *encoded_end = base58::encode(v.data(), v.size(), encoded.data());
+        std::uint8_t *decoded_end = base58::decode(encoded.data(), encoded_end - encoded.data(), decoded.data());
+        BOOST_CHECK_EQUAL(allocations, before);
+
+        BOOST_CHECK_EQUAL(std::string(encoded.data(), encoded_end), expected);
+        BOOST_CHECK_EQUAL_COLLECTIONS(decoded.data(), decoded_end, v.begin(), v.end());
+
+        if (n <= base58_policy_type::inline_octets) {
+            base58_policy_type::decoded_block_type block(v.begin() + 2, v.end());
+
+            before = allocations;
+            base58_policy_type::encoded_block_type encoded_block = base58_policy_type::encode_block(block);
+            std::reverse(encoded_block.begin(), encoded_block.end());
+            base58_policy_type::decoded_block_type decoded_block = base58_policy_type::decode_block(encoded_block);
+            BOOST_CHECK_EQUAL(allocations, before);
+
+            // The block functions produce the least significant value first
+            BOOST_CHECK_EQUAL_COLLECTIONS(decoded_block.rbegin(), decoded_block.rend(), block.begin(), block.end());
+        }
+    }
+
+    std::uint8_t invalid[] = {'1', '1', '0', 'z'}, out[sizeof(invalid)];
+    BOOST_CHECK_THROW(base58::decode(invalid, sizeof(invalid), out), base_decode_error<58>);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(base64_codec_random_data_test_suite)
@@ -427,3 +542,112 @@ BOOST_DATA_TEST_CASE(base64_single_range_random_encode_decode,
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(base64_codec_bulk_test_suite)
+
+typedef codec::detail::base_policy<64> base64_policy_type;
+
+const base64_backend base64_backends[] = {base64_backend::portable, base64_backend::ssse3, base64_backend::avx2};
+
+BOOST_AUTO_TEST_CASE(base64_bulk_backends_agree) {
+    // Every amount of blocks up to several AVX2 steps and a tail, against the single block codec
+    std::mt19937 rng(4648);
+
+    for (std::size_t n = 0; n <= 40; ++n) {
+        std::vector<std::uint8_t> plaintext = random_octets(n * 3, rng);
+
+        std::vector<std::uint8_t> expected;
+        for (std::size_t i = 0; i != n; ++i) {
+            base64::decoded_block_type block;
+            std::copy(plaintext.begin() + i * 3, plaintext.begin() + i * 3 + 3, block.begin());
+            base64::encoded_block_type encoded = base64::encode(block);
+            expected.insert(expected.end(), encoded.begin(), encoded.end());
+        }
+
+        for (base64_backend backend : base64_backends) {
+            if (!boost::crypto3::detail::is_simd_backend_available(backend)) {
+                continue;
+            }
+
+            std::vector<std::uint8_t> encoded(n * 4);
+            base64_policy_type::encode_blocks(plaintext.data(), encoded.data(), n, backend);
+            BOOST_CHECK(encoded == expected);
+
+            std::vector<std::uint8_t> decoded(n * 3);
+            base64_policy_type::decode_blocks(encoded.data(), decoded.data(), n, backend);
+            BOOST_CHECK(decoded == plaintext);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base64_bulk_unavailable_backend) {
+    std::vector<std::uint8_t> plaintext(12), encoded(16);
+    for (base64_backend backend : base64_backends) {
+        if (!boost::crypto3::detail::is_simd_backend_available(backend)) {
+            BOOST_CHECK_THROW(base64_policy_type::encode_blocks(plaintext.data(), encoded.data(), 4, backend),
+                              std::invalid_argument);
+            BOOST_CHECK_THROW(base64_policy_type::decode_blocks(encoded.data(), plaintext.data(), 4, backend),
+                              std::invalid_argument);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base64_bulk_decode_fallback) {
+    // Padding and invalid symbols anywhere in a bulk range behave as with the single block codec
+    std::mt19937 rng(4648);
+    std::vector<std::uint8_t> plaintext = random_octets(40 * 3, rng);
+    std::vector<std::uint8_t> encoded(40 * 4);
+    base64_policy_type::encode_blocks(plaintext.data(), encoded.data(), 40, base64_backend::portable);
+
+    for (base64_backend backend : base64_backends) {
+        if (!boost::crypto3::detail::is_simd_backend_available(backend)) {
+            continue;
+        }
+
+        for (std::size_t i = 0; i != encoded.size(); ++i) {
+            std::vector<std::uint8_t> padded(encoded);
+            padded[i] = '=';
+
+            std::vector<std::uint8_t> expected(plaintext);
+            base64::encoded_block_type block;
+            std::copy(padded.begin() + i / 4 * 4, padded.begin() + i / 4 * 4 + 4, block.begin());
+            base64::decoded_block_type decoded_block = base64::decode(block);
+            std::copy(decoded_block.begin(), decoded_block.end(), expected.begin() + i / 4 * 3);
+
+            std::vector<std::uint8_t> decoded(plaintext.size());
+            base64_policy_type::decode_blocks(padded.data(), decoded.data(), 40, backend);
+            BOOST_CHECK(decoded == expected);
+
+            std::vector<std::uint8_t> invalid(encoded);
+            invalid[i] = '?';
+            BOOST_CHECK_THROW(base64_policy_type::decode_blocks(invalid.data(), decoded.data(), 40, backend),
+                              base_decode_error<64>);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base64_bulk_large_payload) {
+    // Contiguous input takes the bulk path, a list is coded value by value, both agree
+    std::mt19937 rng(4648);
+    for (std::size_t size : {1000, 65536, 100001, 100002}) {
+        std::vector<std::uint8_t> plaintext = random_octets(size, rng);
+        plaintext.back() |= 1;    // Trailing zero octets are not preserved by the decoder
+
+        std::string encoded = encode<base64>(plaintext);
+        std::list<std::uint8_t> list_plaintext(plaintext.begin(), plaintext.end());
+        std::string list_encoded = encode<base64>(list_plaintext.begin(), list_plaintext.end());
+        BOOST_CHECK_EQUAL(encoded.size(), (size + 2) / 3 * 4);
+        BOOST_CHECK(encoded == list_encoded);
+
+        std::vector<std::uint8_t> decoded = decode<base64>(encoded);
+        std::list<char> list_encoded_chars(encoded.begin(), encoded.end());
+        std::vector<std::uint8_t> list_decoded = decode<base64>(list_encoded_chars.begin(), list_encoded_chars.end());
+        BOOST_CHECK(decoded == plaintext);
+        BOOST_CHECK(list_decoded == plaintext);
+
+        encoded[encoded.size() / 2] = '?';
+        BOOST_CHECK_THROW(decode<base64>(encoded), base_decode_error<64>);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
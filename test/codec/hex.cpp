@@ -14,10 +14,16 @@
 #include <array>
 #include <iterator>
 #include <algorithm>
+#include <list>
+#include <random>
+#include <sstream>
+#include <stdexcept>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 
+#include <boost/exception/get_error_info.hpp>
+
 #include <boost/filesystem/path.hpp>
 
 #include <boost/property_tree/ptree.hpp>
@@ -30,6 +36,10 @@
 
 #include <boost/crypto3/codec/hex.hpp>
 
+#include <boost/crypto3/detail/static_digest.hpp>
+
+#include <fixtures.hpp>
+
 using namespace boost::crypto3;
 using namespace boost::crypto3::codec;
 
@@ -208,4 +218,155 @@ BOOST_AUTO_TEST_SUITE_END()
 //
 //BOOST_AUTO_TEST_SUITE_END()
 
-#endif
\ No newline at end of file
+#endif
+
+BOOST_AUTO_TEST_SUITE(hex_codec_bulk_test_suite)
+
+typedef codec::detail::hex_policy<mode::upper> hex_upper_policy_type;
+typedef codec::detail::hex_policy<mode::lower> hex_lower_policy_type;
+
+const hex_backend hex_backends[] = {hex_backend::portable, hex_backend::ssse3, hex_backend::avx2};
+
+BOOST_AUTO_TEST_CASE(hex_bulk_backends_agree) {
+    // Every length up to several AVX2 steps and a tail, against the single block codec
+    std::mt19937 rng(4648);
+
+    for (std::size_t n = 0; n <= 100; ++n) {
+        std::vector<std::uint8_t> plaintext = random_octets(n, rng);
+
+        std::vector<std::uint8_t> expected;
+        for (std::uint8_t c : plaintext) {
+            hex<mode::upper>::encoded_block_type encoded = hex<mode::upper>::encode({{c}});
+            expected.insert(expected.end(), encoded.begin(), encoded.end());
+        }
+        std::vector<std::uint8_t> expected_lower(expected);
+        std::transform(expected.begin(), expected.end(), expected_lower.begin(), ::tolower);
+
+        for (hex_backend backend : hex_backends) {
+            if (!boost::crypto3::detail::is_simd_backend_available(backend)) {
+                continue;
+            }
+
+            std::vector<std::uint8_t> encoded(n * 2), encoded_lower(n * 2);
+            hex_upper_policy_type::encode_blocks(plaintext.data(), encoded.data(), n, backend);
+            hex_lower_policy_type::encode_blocks(plaintext.data(), encoded_lower.data(), n, backend);
+            BOOST_CHECK(encoded == expected);
+            BOOST_CHECK(encoded_lower == expected_lower);
+
+            // Decoding accepts both cases whatever the mode is
+            std::vector<std::uint8_t> decoded(n), decoded_lower(n);
+            BOOST_CHECK_EQUAL(hex_upper_policy_type::decode_blocks(encoded.data(), decoded.data(), n, backend), n);
+            BOOST_CHECK_EQUAL(
+                hex_upper_policy_type::decode_blocks(encoded_lower.data(), decoded_lower.data(), n, backend), n);
+            BOOST_CHECK(decoded == plaintext);
+            BOOST_CHECK(decoded_lower == plaintext);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hex_bulk_unavailable_backend) {
+    std::vector<std::uint8_t> plaintext(4), encoded(8);
+    for (hex_backend backend : hex_backends) {
+        if (!boost::crypto3::detail::is_simd_backend_available(backend)) {
+            BOOST_CHECK_THROW(hex_upper_policy_type::encode_blocks(plaintext.data(), encoded.data(), 4, backend),
+                              std::invalid_argument);
+            BOOST_CHECK_THROW(hex_upper_policy_type::decode_blocks(encoded.data(), plaintext.data(), 4, backend),
+                              std::invalid_argument);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hex_bulk_decode_invalid) {
+    // Every symbol outside of the alphabet is caught at any position and reported as the single block codec does
+    std::mt19937 rng(4648);
+    std::vector<std::uint8_t> plaintext = random_octets(100, rng);
+    std::vector<std::uint8_t> encoded(200);
+    hex_upper_policy_type::encode_blocks(plaintext.data(), encoded.data(), 100, hex_backend::portable);
+
+    for (hex_backend backend : hex_backends) {
+        if (!boost::crypto3::detail::is_simd_backend_available(backend)) {
+            continue;
+        }
+
+        for (std::size_t i = 0; i < encoded.size(); i += 3) {
+            for (unsigned symbol = 0; symbol != 256; ++symbol) {
+                if (std::isxdigit(symbol)) {
+                    continue;
+                }
+
+                std::vector<std::uint8_t> invalid(encoded), decoded(100);
+                invalid[i] = static_cast<std::uint8_t>(symbol);
+                BOOST_CHECK_EQUAL(hex_upper_policy_type::decode_blocks(invalid.data(), decoded.data(), 100, backend),
+                                  i / 2);
+                BOOST_CHECK(std::equal(decoded.begin(), decoded.begin() + i / 2, plaintext.begin()));
+            }
+
+            std::vector<std::uint8_t> invalid(encoded), decoded(100);
+            invalid[i] = 'g';
+            try {
+                hex<mode::upper>::decode_blocks(invalid.data(), decoded.data(), 100);
+                BOOST_ERROR("non_hex_input is not thrown");
+            } catch (const non_hex_input &e) {
+                BOOST_REQUIRE(boost::get_error_info<bad_char>(e));
+                BOOST_CHECK_EQUAL(*boost::get_error_info<bad_char>(e), 'g');
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hex_bulk_large_payload) {
+    // Contiguous input takes the bulk path, a list is coded value by value, both agree
+    std::mt19937 rng(4648);
+    for (std::size_t size : {1000, 65536, 100001}) {
+        std::vector<std::uint8_t> plaintext = random_octets(size, rng);
+        plaintext.back() |= 1;
+
+        std::string encoded = encode<hex<mode::lower>>(plaintext);
+        std::list<std::uint8_t> list_plaintext(plaintext.begin(), plaintext.end());
+        std::string list_encoded = encode<hex<mode::lower>>(list_plaintext.begin(), list_plaintext.end());
+        BOOST_CHECK_EQUAL(encoded.size(), 2 * size);
+        BOOST_CHECK(encoded == list_encoded);
+
+        std::vector<std::uint8_t> decoded = decode<hex<mode::lower>>(encoded);
+        std::list<char> list_encoded_chars(encoded.begin(), encoded.end());
+        std::vector<std::uint8_t> list_decoded =
+            decode<hex<mode::lower>>(list_encoded_chars.begin(), list_encoded_chars.end());
+        BOOST_CHECK(decoded == plaintext);
+        BOOST_CHECK(list_decoded == plaintext);
+
+        encoded[encoded.size() / 2] = 'x';
+        BOOST_CHECK_THROW(decode<hex<mode::lower>>(encoded), non_hex_input);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hex_static_digest) {
+    static_digest<256> d;
+    for (std::size_t i = 0; i != d.size(); ++i) {
+        d[i] = static_cast<std::uint8_t>(i * 37 + 11);
+    }
+
+    std::string expected;
+    for (std::uint8_t c : d) {
+        expected.push_back("0123456789abcdef"[c >> 4]);
+        expected.push_back("0123456789abcdef"[c & 0x0f]);
+    }
+
+    std::ostringstream stream;
+    stream << d;
+    BOOST_CHECK_EQUAL(std::to_string(d), expected);
+    BOOST_CHECK_EQUAL(stream.str(), expected);
+    BOOST_CHECK(d == expected.c_str());
+
+    static_digest<256> parsed;
+    BOOST_CHECK(boost::crypto3::detail::from_ascii(expected.c_str(), parsed));
+    BOOST_CHECK(parsed == d);
+
+    std::transform(expected.begin(), expected.end(), expected.begin(), ::toupper);
+    BOOST_CHECK(boost::crypto3::detail::from_ascii(expected.c_str(), parsed));
+    BOOST_CHECK(parsed == d);
+
+    expected[17] = 'z';
+    BOOST_CHECK(!boost::crypto3::detail::from_ascii(expected.c_str(), parsed));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
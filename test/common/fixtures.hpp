@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_TEST_FIXTURES_HPP
+#define CRYPTO3_TEST_FIXTURES_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*!
+ * @brief Octets written as a hex string, as test vectors are
+ */
+inline std::vector<std::uint8_t> from_hex(const std::string &hex) {
+    std::vector<std::uint8_t> out(hex.size() / 2);
+    for (std::size_t i = 0; i != out.size(); ++i) {
+        out[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+    }
+    return out;
+}
+
+/*!
+ * @brief Lowercase hex string of a range of octets
+ */
+template<typename Range>
+std::string to_hex(const Range &r) {
+    static const char digits[] = "0123456789abcdef";
+    std::string out;
+    for (std::uint8_t c : r) {
+        out += digits[c >> 4];
+        out += digits[c & 0x0f];
+    }
+    return out;
+}
+
+/*!
+ * @brief Fixed-size octet array, i.e. a block, a key or a nonce, from a hex string of its size
+ * @throws std::invalid_argument if the string holds more or fewer octets than the array
+ */
+template<typename Array>
+Array make_array(const std::string &hex) {
+    Array a{};
+    std::vector<std::uint8_t> v = from_hex(hex);
+    if (v.size() != a.size()) {
+        throw std::invalid_argument("hex string does not match the array size");
+    }
+    std::copy(v.begin(), v.end(), a.begin());
+    return a;
+}
+
+/*!
+ * @brief Octets drawn from a random number generator
+ */
+template<typename Generator>
+std::vector<std::uint8_t> random_octets(std::size_t size, Generator &rng) {
+    std::vector<std::uint8_t> v(size);
+    for (std::uint8_t &c : v) {
+        c = static_cast<std::uint8_t>(rng());
+    }
+    return v;
+}
+
+/*!
+ * @brief Cipher keyed with a hex string of its key size
+ */
+template<typename Cipher>
+Cipher make_cipher(const std::string &key) {
+    return Cipher(make_array<typename Cipher::key_type>(key));
+}
+
+#endif    // CRYPTO3_TEST_FIXTURES_HPP
@@ -11,6 +11,7 @@
 #define BOOST_TEST_MODULE blake2b_test
 
 #include <iostream>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -536,3 +537,32 @@ BOOST_AUTO_TEST_CASE(blake2b_512_preprocessor2) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(blake2b_hardware_test_suite)
+
+BOOST_AUTO_TEST_CASE(blake2b_512_hardware_portable_consistency) {
+    std::string input;
+    for (std::size_t i = 0; i != 1031; ++i) {
+        input.push_back(static_cast<char>(i * 7 + 1));
+    }
+
+    std::vector<std::string> avx2;
+    for (std::size_t n = 0; n <= input.size(); n += 13) {
+        avx2.push_back(hash<hashes::blake2b<512>>(input.begin(), input.begin() + n));
+    }
+
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_AVX2_BIT);
+    for (std::size_t n = 0, i = 0; n <= input.size(); n += 13, ++i) {
+        std::string sse41 = hash<hashes::blake2b<512>>(input.begin(), input.begin() + n);
+        BOOST_CHECK_EQUAL(avx2[i], sse41);
+    }
+
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_SSE41_BIT);
+    for (std::size_t n = 0, i = 0; n <= input.size(); n += 13, ++i) {
+        std::string portable = hash<hashes::blake2b<512>>(input.begin(), input.begin() + n);
+        BOOST_CHECK_EQUAL(avx2[i], portable);
+    }
+    boost::crypto3::cpuid::initialize();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,170 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE blake2b_tree_test
+
+#include <cstdint>
+#include <iomanip>
+#include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+
+#include <boost/crypto3/hash/blake2b.hpp>
+#include <boost/crypto3/hash/blake2b_tree.hpp>
+
+using namespace boost::crypto3;
+
+// Reference digests are produced by chaining single nodes of Python's hashlib.blake2b
+// with the corresponding tree parameters over messages of message(n)
+
+std::vector<std::uint8_t> message(std::size_t n) {
+    std::vector<std::uint8_t> m(n);
+    for (std::size_t i = 0; i != n; ++i) {
+        m[i] = static_cast<std::uint8_t>(i * 7 + 3);
+    }
+    return m;
+}
+
+template<typename Digest>
+std::string to_hex(const Digest &d) {
+    std::ostringstream os;
+    for (std::uint8_t c : d) {
+        os << std::hex << std::setw(2) << std::setfill('0') << int(c);
+    }
+    return os.str();
+}
+
+BOOST_AUTO_TEST_SUITE(blake2bp_test_suite)
+
+BOOST_AUTO_TEST_CASE(blake2bp_reference_vectors) {
+    const std::pair<std::size_t, const char *> vectors[] = {
+        {0, "b5ef811a8038f70b628fa8b294daae7492b1ebe343a80eaabbf1f6ae664dd67b"
+            "9d90b0120791eab81dc96985f28849f6a305186a85501b405114bfa678df9380"},
+        {1, "5e577b6f2b9e5f312d87b127d7710f6b1959b16407390899e74cd6305a16c1b4"
+            "047350e0c9afce19c8563efed2010be288452123fec2da068cc1867aa330c633"},
+        {128, "06082f4b297bb7152c9a626c80fe32a35e172dc7d967b97a27180f2c4ce5046c"
+              "b83639963ce166107c980f8d564f900d489b09e88411af54aa50c6c8fb869d08"},
+        {513, "32d4a74bba6f70f46e572c1aa94a4470bc754dffdcf8e82b4ef95a097bf6af0c"
+              "39df37453c434588ad6a60beddbdd2f501341016ba2ab33688a6d38862445d7d"},
+        {1000, "29ca0ff4d384d8f68803bc93b98cd5dda4bd2368105c9644d9158fbc093c85de"
+               "367d74618cee42f741a0c6b4b9090a15f17460f1ab9c1cc94b91117aed929983"},
+        {100000, "9e5491feefd3f99bce531e6b6749ddd4ba07108c4e672b4ac7041f3b358dcdf1"
+                 "04bb89e31dafc76f96d88269740c65f06894abcaff5a8e96c0e29be86b3f7c84"}};
+
+    for (const auto &v : vectors) {
+        std::vector<std::uint8_t> m = message(v.first);
+        for (std::size_t threads = 1; threads <= 4; ++threads) {
+            BOOST_CHECK_EQUAL(to_hex(hashes::blake2bp<512>(threads)(m)), v.second);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(blake2bp_non_contiguous_input) {
+    std::vector<std::uint8_t> m = message(1000);
+    std::list<std::uint8_t> l(m.begin(), m.end());
+
+    BOOST_CHECK_EQUAL(to_hex(hashes::blake2bp<512>(2)(l)), to_hex(hashes::blake2bp<512>(2)(m)));
+}
+
+BOOST_AUTO_TEST_CASE(blake2bp_thread_count_independence) {
+    std::vector<std::uint8_t> m = message(1 << 20);
+    std::string expected = to_hex(hashes::blake2bp<256>(1)(m));
+
+    BOOST_CHECK_EQUAL(to_hex(hashes::blake2bp<256>(2)(m)), expected);
+    BOOST_CHECK_EQUAL(to_hex(hashes::blake2bp<256>(4)(m)), expected);
+    BOOST_CHECK_EQUAL(to_hex(hashes::blake2bp<256>()(m)), expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(blake2b_tree_test_suite)
+
+struct tree_vector {
+    std::size_t fanout;
+    std::size_t depth;
+    std::uint32_t leaf_length;
+    std::size_t size;
+    const char *digest;
+};
+
+BOOST_AUTO_TEST_CASE(blake2b_tree_reference_vectors) {
+    const tree_vector vectors[] = {
+        {2, 255, 1024, 5000,
+         "926c59ff299e635aa2eeba3d99264c4ca67546f27af1dba33d8bed75ad4f47ca"
+         "13795a5dc3e355023da7fb950260c42914413edeb6e7897fabfdb3cc7c81ed04"},
+        {4, 3, 256, 100000,
+         "41a3cc7f5e05da7c8a1b3b7c0fb2ff8d83ba529694bbad7870e70ef89fcbc214"
+         "28bf683f6417bab5b4dc70d839645773b65a85cb252cfc14e25bff81983bfade"},
+        {8, 2, 4096, 100000,
+         "95f68d0b8ce087df054c2bd606ff218c830f391247e81d3d1564fe4a10868bde"
+         "a842f2ef9ce2fa8e1190b9bf8b3ccc226a73dc970372c7b590ed785929f3a555"},
+        {0, 2, 1000, 5000,
+         "cb1b1bc643a9a8da5c46946ca2f4f2495603198ae3b708e1764d375bef94c0ac"
+         "f246d85b7b9b198aabb456c170cdd2e421bb01c68a6c91bb92cac055dbd3b991"},
+        {3, 255, 128, 4097,
+         "c93fa25d7db725ded19fa61be1d75be1158f6441a9c67dfcbb3363c3b0e86722"
+         "873b1261b88e4990d810cc06afaff0f06c2ac760f8f2fcd9ea0edf4f701d945f"},
+        {4, 255, 0, 1000,
+         "754d88a31ef1fa270ab578144e5177a2edd6d80aa0f6a79f7ce48b0969d7a59d"
+         "473698c2db921c207b218db355527676b2fe9edecf668322c53efab78e028c5d"},
+        {2, 4, 100, 5000,
+         "30479dc142ba463e1a718334b1fd3b367a198eb89b4b06b62ba2ce105efa7e3e"
+         "84d907687fe8c90efa8453e72d506d3f0b98aa39db2dc8029b102ecf0d997b71"}};
+
+    for (const tree_vector &v : vectors) {
+        std::vector<std::uint8_t> m = message(v.size);
+        for (std::size_t threads = 1; threads <= 4; ++threads) {
+            hashes::blake2b_tree<512> tree(v.fanout, v.depth, v.leaf_length, threads);
+            BOOST_CHECK_EQUAL(to_hex(tree(m)), v.digest);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(blake2b_tree_sequential_mode) {
+    std::string m = "abc";
+
+    BOOST_CHECK_EQUAL(to_hex(hashes::blake2b_tree<512>(1, 1, 0)(m)),
+                      "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d1"
+                      "7d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923");
+
+    std::vector<std::uint8_t> v = message(1000);
+    std::string expected = hash<hashes::blake2b<256>>(v);
+    BOOST_CHECK_EQUAL(to_hex(hashes::blake2b_tree<256>(1, 1, 0)(v)), expected);
+}
+
+BOOST_AUTO_TEST_CASE(blake2b_tree_thread_count_independence) {
+    std::vector<std::uint8_t> m = message((1 << 20) + 17);
+    std::string expected = to_hex(hashes::blake2b_tree<384>(4, 255, 4096, 1)(m));
+
+    BOOST_CHECK_EQUAL(to_hex(hashes::blake2b_tree<384>(4, 255, 4096, 3)(m)), expected);
+    BOOST_CHECK_EQUAL(to_hex(hashes::blake2b_tree<384>(4, 255, 4096, 8)(m)), expected);
+    BOOST_CHECK_EQUAL(to_hex(hashes::blake2b_tree<384>(4, 255, 4096)(m)), expected);
+}
+
+BOOST_AUTO_TEST_CASE(blake2b_tree_invalid_parameters) {
+    typedef hashes::blake2b_tree<512> tree_type;
+
+    BOOST_CHECK_THROW(tree_type(256, 2, 64), std::invalid_argument);
+    BOOST_CHECK_THROW(tree_type(4, 0, 64), std::invalid_argument);
+    BOOST_CHECK_THROW(tree_type(4, 256, 64), std::invalid_argument);
+    BOOST_CHECK_THROW(tree_type(4, 2, 64, 1, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(tree_type(4, 2, 64, 1, 65), std::invalid_argument);
+    // A level of fanout 1 never shrinks, only a limited depth stops it
+    BOOST_CHECK_THROW(tree_type(1, tree_type::unlimited_depth, 64, 1), std::invalid_argument);
+
+    BOOST_CHECK_NO_THROW(tree_type(255, 255, 64, 1, 64));
+    BOOST_CHECK_NO_THROW(tree_type(1, 3, 64, 1, 1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,188 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE hash_checkpoint_test
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+#include <boost/crypto3/hash/hash_checkpoint.hpp>
+
+#include <boost/crypto3/hash/blake2b.hpp>
+#include <boost/crypto3/hash/keccak.hpp>
+#include <boost/crypto3/hash/md4.hpp>
+#include <boost/crypto3/hash/md5.hpp>
+#include <boost/crypto3/hash/ripemd.hpp>
+#include <boost/crypto3/hash/sha1.hpp>
+#include <boost/crypto3/hash/sha2.hpp>
+#include <boost/crypto3/hash/sha3.hpp>
+#include <boost/crypto3/hash/tiger.hpp>
+
+using namespace boost::crypto3;
+
+template<typename Hash>
+std::string extract_digest(const accumulator_set<Hash> &acc) {
+    typename Hash::digest_type d = accumulators::extract::hash<Hash>(acc);
+    return std::to_string(d);
+}
+
+/*!
+ * @brief Hashes the message up to every offset, saves the state, resumes it in a fresh accumulator
+ * set and hashes the rest there. A copy of the set taken at the same offset is fed the rest as well.
+ */
+template<typename Hash>
+void check_split(const std::string &message, const std::string &expected) {
+    for (std::size_t i = 0; i <= message.size(); ++i) {
+        accumulator_set<Hash> acc;
+        hash<Hash>(message.begin(), message.begin() + i, acc);
+
+        std::vector<std::uint8_t> state = save_state<Hash>(acc);
+        BOOST_REQUIRE_EQUAL(state.size(), saved_state_size<Hash>());
+
+        accumulator_set<Hash> resumed;
+        hash<Hash>(std::string("discarded"), resumed);
+        load_state<Hash>(resumed, state);
+        hash<Hash>(message.begin() + i, message.end(), resumed);
+        BOOST_CHECK_EQUAL(extract_digest<Hash>(resumed), expected);
+
+        accumulator_set<Hash> forked = acc;
+        hash<Hash>(message.begin() + i, message.end(), forked);
+        BOOST_CHECK_EQUAL(extract_digest<Hash>(forked), expected);
+
+        // The original is left as it was at the offset
+        std::vector<std::uint8_t> again = save_state<Hash>(acc);
+        BOOST_CHECK(again == state);
+    }
+}
+
+/*!
+ * @brief Checks every message of a child of the test data, or of the whole file if child_name is empty
+ */
+template<typename Hash>
+void check_data(const char *file_name, const std::string &child_name = std::string()) {
+    std::string path = (boost::filesystem::path(__FILE__).parent_path() / "data" / file_name).string();
+    boost::property_tree::ptree root_data;
+    boost::property_tree::read_json(path, root_data);
+
+    const boost::property_tree::ptree &vectors =
+        child_name.empty() ? root_data : root_data.get_child(child_name);
+    for (const auto &v : vectors) {
+        check_split<Hash>(v.first, v.second.data());
+    }
+}
+
+/*!
+ * @brief Checks a message spanning a few blocks against the digest of the whole of it
+ */
+template<typename Hash>
+void check_long() {
+    std::string message(3 * Hash::construction::type::block_bits / 8 + 11, 0);
+    for (std::size_t i = 0; i != message.size(); ++i) {
+        message[i] = static_cast<char>('a' + i % 26);
+    }
+    typename Hash::digest_type d = hash<Hash>(message);
+    check_split<Hash>(message, std::to_string(d));
+}
+
+BOOST_AUTO_TEST_SUITE(hash_checkpoint_test_suite)
+
+#ifndef CRYPTO3_CI_DATA_DRIVEN_TESTS_DISABLED
+
+BOOST_AUTO_TEST_CASE(merkle_damgard_checkpoint_data) {
+    check_data<hashes::md4>("md4.json");
+    check_data<hashes::md5>("md5.json");
+    check_data<hashes::sha1>("sha1.json");
+    check_data<hashes::sha2<224>>("sha2.json", "data_224");
+    check_data<hashes::sha2<256>>("sha2.json", "data_256");
+    check_data<hashes::sha2<384>>("sha2.json", "data_384");
+    check_data<hashes::sha2<512>>("sha2.json", "data_512");
+    check_data<hashes::ripemd<160>>("ripemd.json", "data_160");
+    check_data<hashes::tiger<192>>("tiger.json", "data_192");
+}
+
+BOOST_AUTO_TEST_CASE(sponge_checkpoint_data) {
+    check_data<hashes::sha3<224>>("sha3.json", "data_224");
+    check_data<hashes::sha3<256>>("sha3.json", "data_256");
+    check_data<hashes::sha3<512>>("sha3.json", "data_512");
+    check_data<hashes::keccak_1600<256>>("keccak.json", "data_256");
+}
+
+BOOST_AUTO_TEST_CASE(haifa_checkpoint_data) {
+    check_data<hashes::blake2b<224>>("blake2b.json", "data_224");
+    check_data<hashes::blake2b<256>>("blake2b.json", "data_256");
+    check_data<hashes::blake2b<512>>("blake2b.json", "data_512");
+}
+
+#endif
+
+BOOST_AUTO_TEST_CASE(checkpoint_long_messages) {
+    check_long<hashes::md5>();
+    check_long<hashes::sha2<256>>();
+    check_long<hashes::sha2<512>>();
+    check_long<hashes::sha3<256>>();
+    check_long<hashes::blake2b<512>>();
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_forks) {
+    accumulator_set<hashes::sha2<256>> acc;
+    hash<hashes::sha2<256>>(std::string("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmno"), acc);
+
+    accumulator_set<hashes::sha2<256>> first = acc, second = acc;
+    hash<hashes::sha2<256>>(std::string("mnopnopq"), first);
+    hash<hashes::sha2<256>>(std::string("xyz"), second);
+
+    hashes::sha2<256>::digest_type a = hash<hashes::sha2<256>>(
+        std::string("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"));
+    hashes::sha2<256>::digest_type b = hash<hashes::sha2<256>>(
+        std::string("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnoxyz"));
+    BOOST_CHECK_EQUAL(extract_digest<hashes::sha2<256>>(first), std::to_string(a));
+    BOOST_CHECK_EQUAL(extract_digest<hashes::sha2<256>>(second), std::to_string(b));
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_rejects_bad_state) {
+    accumulator_set<hashes::sha2<256>> acc;
+    hash<hashes::sha2<256>>(std::string("abc"), acc);
+    std::vector<std::uint8_t> state = save_state<hashes::sha2<256>>(acc);
+
+    accumulator_set<hashes::sha2<256>> target;
+    hash<hashes::sha2<256>>(std::string("a"), target);
+    const std::string untouched = extract_digest<hashes::sha2<256>>(target);
+
+    std::vector<std::uint8_t> truncated(state.begin(), state.end() - 1);
+    BOOST_CHECK_THROW(load_state<hashes::sha2<256>>(target, truncated), hashes::bad_hash_state);
+
+    std::vector<std::uint8_t> future = state;
+    future[4] = 2;
+    BOOST_CHECK_THROW(load_state<hashes::sha2<256>>(target, future), hashes::bad_hash_state);
+
+    std::vector<std::uint8_t> bad_flag = state;
+    bad_flag[22] = 1;
+    BOOST_CHECK_THROW(load_state<hashes::sha2<256>>(target, bad_flag), hashes::bad_hash_state);
+
+    BOOST_CHECK_EQUAL(extract_digest<hashes::sha2<256>>(target), untouched);
+
+    // Same state and block sizes, but another construction
+    accumulator_set<hashes::blake2b<512>> blake;
+    BOOST_CHECK_THROW(load_state<hashes::blake2b<512>>(blake, save_state<hashes::sha2<512>>(
+                                                                     accumulator_set<hashes::sha2<512>>())),
+                      hashes::bad_hash_state);
+
+    accumulator_set<hashes::sha2<224>> truncated_digest;
+    BOOST_CHECK_THROW(load_state<hashes::sha2<224>>(truncated_digest, state), hashes::bad_hash_state);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE hash_file_test
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+#include <boost/crypto3/hash/algorithm/hash_file.hpp>
+
+#include <boost/crypto3/hash/blake2b.hpp>
+#include <boost/crypto3/hash/md5.hpp>
+#include <boost/crypto3/hash/sha2.hpp>
+#include <boost/crypto3/hash/sha3.hpp>
+
+using namespace boost::crypto3;
+
+std::vector<std::uint8_t> message(std::size_t n) {
+    std::vector<std::uint8_t> m(n);
+    for (std::size_t i = 0; i != n; ++i) {
+        m[i] = static_cast<std::uint8_t>(i * 7 + i / 253);
+    }
+    return m;
+}
+
+/*!
+ * @brief Writes a message into a temporary file, removed on destruction
+ */
+struct temporary_file {
+    explicit temporary_file(const std::vector<std::uint8_t> &m) :
+        path(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()) {
+        std::FILE *f = std::fopen(path.c_str(), "wb");
+        BOOST_REQUIRE(f);
+        BOOST_REQUIRE_EQUAL(std::fwrite(m.data(), 1, m.size(), f), m.size());
+        std::fclose(f);
+    }
+
+    ~temporary_file() {
+        boost::filesystem::remove(path);
+    }
+
+    boost::filesystem::path path;
+};
+
+template<typename Hash>
+void check_file(std::size_t n) {
+    std::vector<std::uint8_t> m = message(n);
+    temporary_file f(m);
+
+    hashes::file_hash_stats stats;
+    typename Hash::digest_type expected = hash<Hash>(m);
+    BOOST_CHECK(hash_file<Hash>(f.path.string(), stats) == expected);
+    BOOST_CHECK_EQUAL(stats.bytes, n);
+    BOOST_CHECK_EQUAL(stats.mapped, n != 0);
+}
+
+BOOST_AUTO_TEST_SUITE(hash_file_test_suite)
+
+BOOST_AUTO_TEST_CASE(hash_file_matches_range) {
+    // Around block and 2 MiB chunk boundaries, for 64, 128 and 136 octet blocks
+    const std::size_t chunk = std::size_t(2) << 20;
+    for (std::size_t n : {std::size_t(0), std::size_t(1), std::size_t(64), std::size_t(136), std::size_t(1000),
+                          chunk - 1, chunk, chunk + 1, 3 * chunk + 77}) {
+        check_file<hashes::sha2<256>>(n);
+        check_file<hashes::md5>(n);
+        check_file<hashes::blake2b<512>>(n);
+        check_file<hashes::sha3<256>>(n);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_fd_pipe) {
+    // Pipes can not be mapped nor pread, so they are read until the writer closes its end
+    std::vector<std::uint8_t> m = message((std::size_t(5) << 20) + 3);
+
+    int fds[2];
+    BOOST_REQUIRE_EQUAL(::pipe(fds), 0);
+    std::thread writer([&]() {
+        for (std::size_t i = 0; i < m.size();) {
+            ssize_t r = ::write(fds[1], m.data() + i, std::min(m.size() - i, std::size_t(10000)));
+            if (r <= 0) {
+                break;
+            }
+            i += static_cast<std::size_t>(r);
+        }
+        ::close(fds[1]);
+    });
+
+    hashes::file_hash_stats stats;
+    hashes::sha2<256>::digest_type d = hash_fd<hashes::sha2<256>>(fds[0], stats);
+    writer.join();
+    ::close(fds[0]);
+
+    BOOST_CHECK(d == static_cast<hashes::sha2<256>::digest_type>(hash<hashes::sha2<256>>(m)));
+    BOOST_CHECK_EQUAL(stats.bytes, m.size());
+    BOOST_CHECK(!stats.mapped);
+}
+
+BOOST_AUTO_TEST_CASE(hash_file_missing) {
+    boost::filesystem::path p = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    BOOST_CHECK_THROW(hash_file<hashes::sha2<256>>(p.string()), std::system_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,7 @@
 #define BOOST_TEST_MODULE sha1_test
 
 #include <iostream>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -251,4 +252,27 @@ BOOST_AUTO_TEST_CASE(sha1_preprocessor3) {
     BOOST_CHECK_EQUAL("34aa973cd4c4daa4f61eeb2bdbad27316534016f", std::to_string(s).data());
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sha1_hardware_test_suite)
+
+BOOST_AUTO_TEST_CASE(sha1_hardware_portable_consistency) {
+    std::string input;
+    for (std::size_t i = 0; i != 1031; ++i) {
+        input.push_back(static_cast<char>(i * 7 + 1));
+    }
+
+    std::vector<std::string> hardware;
+    for (std::size_t n = 0; n <= input.size(); n += 13) {
+        hardware.push_back(hash<hashes::sha1>(input.begin(), input.begin() + n));
+    }
+
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_SHA_BIT);
+    for (std::size_t n = 0, i = 0; n <= input.size(); n += 13, ++i) {
+        std::string portable = hash<hashes::sha1>(input.begin(), input.begin() + n);
+        BOOST_CHECK_EQUAL(hardware[i], portable);
+    }
+    boost::crypto3::cpuid::initialize();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
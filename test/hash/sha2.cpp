@@ -10,6 +10,7 @@
 #define BOOST_TEST_MODULE sha2_test
 
 #include <iostream>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -21,10 +22,14 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <boost/crypto3/hash/algorithm/hash.hpp>
+#include <boost/crypto3/hash/algorithm/hash_many.hpp>
 #include <boost/crypto3/hash/adaptor/hashed.hpp>
 
 #include <boost/crypto3/hash/sha2.hpp>
 
+#include <boost/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <boost/crypto3/hash/detail/state_adder.hpp>
+
 using namespace boost::crypto3;
 using namespace boost::crypto3::accumulators;
 
@@ -631,4 +636,123 @@ BOOST_AUTO_TEST_CASE(sha224_range_hash) {
     BOOST_CHECK_EQUAL("23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7", std::to_string(h).data());
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sha2_hardware_test_suite)
+
+BOOST_AUTO_TEST_CASE(sha2_224_hardware_portable_consistency) {
+    std::string input;
+    for (std::size_t i = 0; i != 1031; ++i) {
+        input.push_back(static_cast<char>(i * 7 + 1));
+    }
+
+    std::vector<std::string> hardware;
+    for (std::size_t n = 0; n <= input.size(); n += 13) {
+        hardware.push_back(hash<hashes::sha2<224>>(input.begin(), input.begin() + n));
+    }
+
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_SHA_BIT);
+    for (std::size_t n = 0, i = 0; n <= input.size(); n += 13, ++i) {
+        std::string portable = hash<hashes::sha2<224>>(input.begin(), input.begin() + n);
+        BOOST_CHECK_EQUAL(hardware[i], portable);
+    }
+    boost::crypto3::cpuid::initialize();
+}
+
+BOOST_AUTO_TEST_CASE(sha2_256_hardware_portable_consistency) {
+    std::string input;
+    for (std::size_t i = 0; i != 1031; ++i) {
+        input.push_back(static_cast<char>(i * 7 + 1));
+    }
+
+    std::vector<std::string> hardware;
+    for (std::size_t n = 0; n <= input.size(); n += 13) {
+        hardware.push_back(hash<hashes::sha2<256>>(input.begin(), input.begin() + n));
+    }
+
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_SHA_BIT);
+    for (std::size_t n = 0, i = 0; n <= input.size(); n += 13, ++i) {
+        std::string portable = hash<hashes::sha2<256>>(input.begin(), input.begin() + n);
+        BOOST_CHECK_EQUAL(hardware[i], portable);
+    }
+    boost::crypto3::cpuid::initialize();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sha2_compressor_test_suite)
+
+template<std::size_t Version>
+void check_compressor_consistency() {
+    typedef hashes::detail::sha2_compressor<Version> compressor_type;
+    typedef hashes::davies_meyer_compressor<block::shacal2<Version>, hashes::detail::state_adder> reference_type;
+
+    typename compressor_type::state_type state = {}, reference = {};
+    typename compressor_type::block_type block;
+    for (std::size_t i = 0; i != 5; ++i) {
+        for (std::size_t j = 0; j != compressor_type::block_words; ++j) {
+            block[j] = typename compressor_type::word_type((i + 1) * 0x9e3779b97f4a7c15ULL >> j);
+        }
+        compressor_type::process_block(state, block);
+        reference_type::process_block(reference, block);
+        BOOST_CHECK(state == reference);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha2_256_compressor_davies_meyer_consistency) {
+    check_compressor_consistency<256>();
+}
+
+BOOST_AUTO_TEST_CASE(sha2_512_compressor_davies_meyer_consistency) {
+    check_compressor_consistency<512>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sha2_hash_many_test_suite)
+
+template<std::size_t Version>
+void check_hash_many_consistency() {
+    typedef hashes::sha2<Version> hash_t;
+
+    // 35 messages of lengths around the padding boundaries, groups of 8 and 16 end incomplete
+    std::vector<std::string> messages;
+    for (std::size_t n = 0; n <= 300; n += 9) {
+        std::string message;
+        for (std::size_t i = 0; i != n; ++i) {
+            message.push_back(static_cast<char>(i * 7 + n));
+        }
+        messages.push_back(message);
+    }
+
+    std::vector<typename hash_t::digest_type> expected;
+    for (const std::string &message : messages) {
+        expected.push_back(hash<hash_t>(message));
+    }
+
+    std::vector<typename hash_t::digest_type> out(messages.size());
+    BOOST_CHECK(hash_many<hash_t>(messages, out.begin()) == out.end());
+    BOOST_CHECK(out == expected);
+
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_AVX512F_BIT);
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_SHA_BIT);
+    std::fill(out.begin(), out.end(), typename hash_t::digest_type());
+    hash_many<hash_t>(messages.begin(), messages.end(), out.begin());
+    BOOST_CHECK(out == expected);
+
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_AVX2_BIT);
+    std::fill(out.begin(), out.end(), typename hash_t::digest_type());
+    hash_many<hash_t>(messages.begin(), messages.end(), out.begin());
+    BOOST_CHECK(out == expected);
+    boost::crypto3::cpuid::initialize();
+}
+
+BOOST_AUTO_TEST_CASE(sha2_224_hash_many_consistency) {
+    check_hash_many_consistency<224>();
+}
+
+BOOST_AUTO_TEST_CASE(sha2_256_hash_many_consistency) {
+    check_hash_many_consistency<256>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -21,6 +21,7 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <boost/crypto3/hash/algorithm/hash.hpp>
+#include <boost/crypto3/hash/algorithm/hash_many.hpp>
 
 #include <boost/crypto3/hash/sha3.hpp>
 #include <boost/crypto3/hash/hash_state.hpp>
@@ -793,4 +794,58 @@ BOOST_AUTO_TEST_CASE(sha3_512_preprocessor3) {
         std::to_string(s).data());
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE(sha3_hash_many_test_suite)
+
+template<std::size_t Size>
+void check_hash_many_consistency() {
+    typedef hashes::sha3<Size> hash_t;
+
+    // 19 messages, so the groups of 4 and 8 states end with incomplete ones
+    std::vector<std::string> messages;
+    for (std::size_t n = 0; n <= 360; n += 19) {
+        std::string message;
+        for (std::size_t i = 0; i != n; ++i) {
+            message.push_back(static_cast<char>(i * 7 + n));
+        }
+        messages.push_back(message);
+    }
+
+    std::vector<typename hash_t::digest_type> expected;
+    for (const std::string &message : messages) {
+        expected.push_back(hash<hash_t>(message));
+    }
+
+    std::vector<typename hash_t::digest_type> out(messages.size());
+    BOOST_CHECK(hash_many<hash_t>(messages, out.begin()) == out.end());
+    BOOST_CHECK(out == expected);
+
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_AVX512F_BIT);
+    std::fill(out.begin(), out.end(), typename hash_t::digest_type());
+    hash_many<hash_t>(messages.begin(), messages.end(), out.begin());
+    BOOST_CHECK(out == expected);
+
+    boost::crypto3::cpuid::clear_cpuid_bit(boost::crypto3::cpuid::CPUID_AVX2_BIT);
+    std::fill(out.begin(), out.end(), typename hash_t::digest_type());
+    hash_many<hash_t>(messages.begin(), messages.end(), out.begin());
+    BOOST_CHECK(out == expected);
+    boost::crypto3::cpuid::initialize();
+}
+
+BOOST_AUTO_TEST_CASE(sha3_224_hash_many_consistency) {
+    check_hash_many_consistency<224>();
+}
+
+BOOST_AUTO_TEST_CASE(sha3_256_hash_many_consistency) {
+    check_hash_many_consistency<256>();
+}
+
+BOOST_AUTO_TEST_CASE(sha3_384_hash_many_consistency) {
+    check_hash_many_consistency<384>();
+}
+
+BOOST_AUTO_TEST_CASE(sha3_512_hash_many_consistency) {
+    check_hash_many_consistency<512>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,249 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE shake_test
+
+#include <iostream>
+#include <iomanip>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/data/monomorphic.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <boost/crypto3/hash/algorithm/hash.hpp>
+
+#include <boost/crypto3/hash/shake.hpp>
+
+using namespace boost::crypto3;
+
+namespace boost {
+    namespace test_tools {
+        namespace tt_detail {
+            template<template<typename, typename> class P, typename K, typename V>
+            struct print_log_value<P<K, V>> {
+                void operator()(std::ostream &, P<K, V> const &) {
+                }
+            };
+        }    // namespace tt_detail
+    }        // namespace test_tools
+}    // namespace boost
+
+template<typename Xof>
+std::string squeeze_hex(Xof &xof, std::size_t n) {
+    std::vector<std::uint8_t> out(n);
+    xof.squeeze(out.begin(), n);
+
+    std::ostringstream os;
+    for (std::uint8_t c : out) {
+        os << std::hex << std::setw(2) << std::setfill('0') << int(c);
+    }
+    return os.str();
+}
+
+#ifndef CRYPTO3_CI_DATA_DRIVEN_TESTS_DISABLED
+
+const char *construct_file(const char *path) {
+    return (boost::filesystem::path(path).parent_path() / "data" / "shake.json").c_str();
+}
+
+boost::property_tree::ptree string_data(const char *child_name) {
+    boost::property_tree::ptree root_data;
+    boost::property_tree::read_json(construct_file(BOOST_PP_STRINGIZE(__FILE__)), root_data);
+
+    return root_data.get_child(child_name);
+}
+
+BOOST_AUTO_TEST_SUITE(shake_stream_processor_data_driven_test_suite)
+
+BOOST_DATA_TEST_CASE(shake_128_range_hash, string_data("data_128"), array_element) {
+    std::string out = hash<hashes::shake<128>>(array_element.first);
+
+    BOOST_CHECK_EQUAL(out, array_element.second.data());
+}
+
+BOOST_DATA_TEST_CASE(shake_256_range_hash, string_data("data_256"), array_element) {
+    std::string out = hash<hashes::shake<256>>(array_element.first);
+
+    BOOST_CHECK_EQUAL(out, array_element.second.data());
+}
+
+BOOST_DATA_TEST_CASE(shake_128_xof, string_data("data_128"), array_element) {
+    hashes::shake_xof<128> xof;
+    xof.update(array_element.first);
+
+    BOOST_CHECK_EQUAL(squeeze_hex(xof, 32), array_element.second.data());
+}
+
+BOOST_DATA_TEST_CASE(shake_256_xof, string_data("data_256"), array_element) {
+    hashes::shake_xof<256> xof;
+    xof.update(array_element.first);
+
+    BOOST_CHECK_EQUAL(squeeze_hex(xof, 64), array_element.second.data());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
+
+BOOST_AUTO_TEST_SUITE(shake_stream_processor_test_suite)
+
+BOOST_AUTO_TEST_CASE(shake_128_empty) {
+    // https://csrc.nist.gov/CSRC/media/Projects/Cryptographic-Standards-and-Guidelines/documents/examples/SHAKE128_Msg0.pdf
+    std::string out = hash<hashes::shake<128>>(std::string());
+
+    BOOST_CHECK_EQUAL("7f9c2ba4e88f827d616045507605853ed73b8093f6efbc88eb1a6eacfa66ef26", out);
+}
+
+BOOST_AUTO_TEST_CASE(shake_256_empty) {
+    // https://csrc.nist.gov/CSRC/media/Projects/Cryptographic-Standards-and-Guidelines/documents/examples/SHAKE256_Msg0.pdf
+    std::string out = hash<hashes::shake<256>>(std::string());
+
+    BOOST_CHECK_EQUAL("46b9dd2b0ba88d13233b3feb743eeb243fcd52ea62b81b82b50c27646ed5762f"
+                      "d75dc4ddd8c0f200cb05019d67b592f6fc821c49479ab48640292eacb3b7c4be",
+                      out);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(shake_xof_test_suite)
+
+BOOST_AUTO_TEST_CASE(shake_128_xof_long_output) {
+    hashes::shake_xof<128> xof;
+    xof.update(std::string("abc"));
+
+    BOOST_CHECK_EQUAL(squeeze_hex(xof, 500),
+                      "5881092dd818bf5cf8a3ddb793fbcba74097d5c526a6d35f97b83351940f2cc8"
+                      "44c50af32acd3f2cdd066568706f509bc1bdde58295dae3f891a9a0fca578378"
+                      "9a41f8611214ce612394df286a62d1a2252aa94db9c538956c717dc2bed4f232"
+                      "a0294c857c730aa16067ac1062f1201fb0d377cfb9cde4c63599b27f3462bba4"
+                      "a0ed296c801f9ff7f57302bb3076ee145f97a32ae68e76ab66c48d51675bd49a"
+                      "cc29082f5647584e6aa01b3f5af057805f973ff8ecb8b226ac32ada6f01c1fcd"
+                      "4818cb006aa5b4cdb3611eb1e533c8964cacfdf31012cd3fb744d02225b988b4"
+                      "75375faad996eb1b9176ecb0f8b2871723d6dbb804e23357e50732f5cfc904b1"
+                      "319795000d7361d9e5e1b77b4b8f5774aa1482cfa58f83096bdb2e06a3eed543"
+                      "a38919b57ecbec737f4086be007f8ef80094ceea8807193d46e9be540b6e99b4"
+                      "c1c71507095028a024e8d39aa8f4c5854cedd50d30a223e7d54e9a24f0a2526b"
+                      "31002afbd1b4ebea69c8400c3deb4c1c35d6dbb75651b284076f5fde47b4a058"
+                      "6ee173e30bd4d08f2bc59c6114bdd745d20876bee2bf800bd7d8b5e51536c844"
+                      "c73256f7d1ada1870c7bbaf83af10a6fdd7c02967811815459cfd02d67b936e9"
+                      "75c6007c63ea7ae087f0a6b0a1319668bb61788eaa3d3b78e3f2061adcdead40"
+                      "7085901803ec6f17f0ec650a292198275211a56b");
+}
+
+BOOST_AUTO_TEST_CASE(shake_xof_incremental_squeeze) {
+    std::string input;
+    for (std::size_t i = 0; i != 1000; ++i) {
+        input.push_back(static_cast<char>(i * 7 + 1));
+    }
+
+    for (std::size_t n : {0, 1, 135, 136, 137, 168, 1000}) {
+        hashes::shake_xof<256> whole, pieces;
+        whole.update(input.begin(), input.begin() + n);
+        pieces.update(input.begin(), input.begin() + n / 3);
+        pieces.update(input.begin() + n / 3, input.begin() + n);
+
+        std::string expected = squeeze_hex(whole, 700);
+        std::string out;
+        for (std::size_t chunk : {1, 7, 8, 129, 136, 419}) {
+            out += squeeze_hex(pieces, chunk);
+        }
+        BOOST_CHECK_EQUAL(out, expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(shake_xof_matches_shake) {
+    // Long enough for several bulk batches of whole blocks, absorbed contiguously and octet by octet
+    std::string input;
+    for (std::size_t i = 0; i != 168 * 19 + 5; ++i) {
+        input.push_back(static_cast<char>(i * 13 + 5));
+    }
+    std::list<char> listed(input.begin(), input.end());
+
+    for (std::size_t n : {0, 167, 168, 169, 168 * 8, 168 * 17 + 1, 168 * 19 + 5}) {
+        std::string expected = hash<hashes::shake<128>>(input.begin(), input.begin() + n);
+
+        hashes::shake_xof<128> contiguous, octets;
+        contiguous.update(input.begin(), input.begin() + n);
+        octets.update(listed.begin(), std::next(listed.begin(), n));
+
+        BOOST_CHECK_EQUAL(squeeze_hex(contiguous, 32), expected);
+        BOOST_CHECK_EQUAL(squeeze_hex(octets, 32), expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(shake_xof_reset) {
+    hashes::shake_xof<128> xof;
+    xof.update(std::string("abc"));
+    std::string first = squeeze_hex(xof, 64);
+
+    xof.reset();
+    xof.update(std::string("abc"));
+    BOOST_CHECK_EQUAL(squeeze_hex(xof, 64), first);
+}
+
+BOOST_AUTO_TEST_CASE(cshake_128_sample1) {
+    // https://csrc.nist.gov/CSRC/media/Projects/Cryptographic-Standards-and-Guidelines/documents/examples/cSHAKE_samples.pdf
+    std::vector<std::uint8_t> input = {0x00, 0x01, 0x02, 0x03};
+    hashes::shake_xof<128> xof(std::string(), std::string("Email Signature"));
+    xof.update(input);
+
+    BOOST_CHECK_EQUAL(squeeze_hex(xof, 32), "c1c36925b6409a04f1b504fcbca9d82b4017277cb5ed2b2065fc1d3814d5aaf5");
+}
+
+BOOST_AUTO_TEST_CASE(cshake_128_sample2) {
+    std::vector<std::uint8_t> input(200);
+    for (std::size_t i = 0; i != input.size(); ++i) {
+        input[i] = static_cast<std::uint8_t>(i);
+    }
+    hashes::shake_xof<128> xof(std::string(), std::string("Email Signature"));
+    xof.update(input);
+
+    BOOST_CHECK_EQUAL(squeeze_hex(xof, 32), "c5221d50e4f822d96a2e8881a961420f294b7b24fe3d2094baed2c6524cc166b");
+}
+
+BOOST_AUTO_TEST_CASE(cshake_256_sample3) {
+    std::vector<std::uint8_t> input = {0x00, 0x01, 0x02, 0x03};
+    hashes::shake_xof<256> xof(std::string(), std::string("Email Signature"));
+    xof.update(input);
+
+    BOOST_CHECK_EQUAL(squeeze_hex(xof, 64),
+                      "d008828e2b80ac9d2218ffee1d070c48b8e4c87bff32c9699d5b6896eee0edd1"
+                      "64020e2be0560858d9c00c037e34a96937c561a74c412bb4c746469527281c8c");
+}
+
+BOOST_AUTO_TEST_CASE(cshake_256_sample4) {
+    std::vector<std::uint8_t> input(200);
+    for (std::size_t i = 0; i != input.size(); ++i) {
+        input[i] = static_cast<std::uint8_t>(i);
+    }
+    hashes::shake_xof<256> xof(std::string(), std::string("Email Signature"));
+    xof.update(input);
+
+    BOOST_CHECK_EQUAL(squeeze_hex(xof, 64),
+                      "07dc27b11e51fbac75bc7b3c1d983e8b4b85fb1defaf218912ac86430273091727"
+                      "f42b17ed1df63e8ec118f04b23633c1dfb1574c8fb55cb45da8e25afb092bb");
+}
+
+BOOST_AUTO_TEST_CASE(cshake_empty_customization_is_shake) {
+    hashes::shake_xof<128> cshake(std::string(""), std::string("")), shake;
+    cshake.update(std::string("abc"));
+    shake.update(std::string("abc"));
+
+    BOOST_CHECK_EQUAL(squeeze_hex(cshake, 200), squeeze_hex(shake, 200));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,247 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE chacha20_cipher_test
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+#include <boost/crypto3/block/algorithm/decrypt.hpp>
+
+#include <boost/crypto3/stream/chacha20.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+typedef stream::modes::keystream<stream::chacha20> mode_type;
+typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+
+const stream::chacha20_backend all_backends[] = {stream::chacha20_backend::portable, stream::chacha20_backend::sse2,
+                                                 stream::chacha20_backend::avx2};
+
+const char *const rfc8439_key = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f";
+
+// RFC 8439, 2.4.2
+const char *const sunscreen =
+    "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be "
+    "it.";
+const char *const sunscreen_ciphertext =
+    "6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0bf91b65c5524733ab8f593dabcd62b3571639d624e65152"
+    "ab8f530c359f0861d807ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab77937365af90bbf74a35be6b40b8eedf278"
+    "5e42874d";
+
+BOOST_AUTO_TEST_SUITE(chacha20_test_suite)
+
+BOOST_AUTO_TEST_CASE(chacha20_block_function) {
+    // RFC 8439, 2.3.2 and A.1 test vectors 1 and 2
+    for (stream::chacha20_backend backend : all_backends) {
+        if (!stream::chacha20::is_available(backend)) {
+            continue;
+        }
+
+        stream::chacha20 cipher(make_array<stream::chacha20::key_type>(rfc8439_key), backend);
+        stream::chacha20::nonce_type nonce = make_array<stream::chacha20::nonce_type>("000000090000004a00000000");
+        BOOST_CHECK_EQUAL(to_hex(cipher.keystream(nonce, 1)),
+                          "10f1e7e4d13b5915500fdd1fa32071c4c7d1f4c733c068030422aa9ac3d46c4e"
+                          "d2826446079faa0914c2d705d98b02a2b5129cd1de164eb9cbd083e8a2503c4e");
+
+        stream::chacha20 zero(stream::chacha20::key_type(), backend);
+        BOOST_CHECK_EQUAL(to_hex(zero.keystream(stream::chacha20::nonce_type(), 0)),
+                          "76b8e0ada0f13d90405d6ae55386bd28bdd219b8a08ded1aa836efcc8b770dc7"
+                          "da41597c5157488d7724e03fb8d84a376a43b8f41518a11cc387b669b2ee6586");
+        BOOST_CHECK_EQUAL(to_hex(zero.keystream(stream::chacha20::nonce_type(), 1)),
+                          "9f07e7be5551387a98ba977c732d080dcb0f29a048e3656912c6533e32ee7aed"
+                          "29b721769ce64e43d57133b074d839d531ed1f28510afb45ace10a1f4b794d6f");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_unavailable_backend) {
+    for (stream::chacha20_backend backend : all_backends) {
+        if (!stream::chacha20::is_available(backend)) {
+            BOOST_CHECK_THROW(stream::chacha20(stream::chacha20::key_type(), backend), std::invalid_argument);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_poly1305_key_generation) {
+    // RFC 8439, 2.6.2, the one-time key is the first half of the keystream block 0
+    stream::chacha20 cipher(
+        make_array<stream::chacha20::key_type>("808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"));
+    stream::chacha20::block_type block =
+        cipher.keystream(make_array<stream::chacha20::nonce_type>("000000000001020304050607"), 0);
+
+    BOOST_CHECK_EQUAL(to_hex(block).substr(0, 64), "8ad5a08b905f81cc815040274ab29471a833b637e3fd0da508dbb8e2fdd1a646");
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_accumulator) {
+    // RFC 8439, 2.4.2 through the block accumulator
+    std::string plaintext(sunscreen);
+    std::vector<std::uint8_t> nonce = from_hex("000000000000004a00000000");
+    stream::chacha20 cipher(make_array<stream::chacha20::key_type>(rfc8439_key));
+
+    block::accumulator_set<encryption_mode> acc(encryption_mode(cipher, nonce, 1));
+    encrypt<stream::chacha20>(plaintext, acc);
+    auto ciphertext = accumulators::extract::block<encryption_mode>(acc);
+    BOOST_CHECK_EQUAL(to_hex(ciphertext), sunscreen_ciphertext);
+
+    block::accumulator_set<decryption_mode> dec(decryption_mode(cipher, nonce, 1));
+    decrypt<stream::chacha20>(ciphertext, dec);
+    auto decrypted = accumulators::extract::block<decryption_mode>(dec);
+    BOOST_CHECK(std::string(decrypted.begin(), decrypted.end()) == plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_inplace) {
+    // RFC 8439, 2.4.2 in place, split into whole blocks and the rest
+    std::string plaintext(sunscreen);
+    std::vector<std::uint8_t> nonce = from_hex("000000000000004a00000000");
+    stream::chacha20 cipher(make_array<stream::chacha20::key_type>(rfc8439_key));
+
+    for (std::size_t length = 0; length <= plaintext.size(); ++length) {
+        std::vector<std::uint8_t> buffer(plaintext.begin(), plaintext.begin() + length);
+
+        encryption_mode encryption(cipher, nonce, 1);
+        std::size_t whole = length / 64 * 64;
+        encrypt_inplace<stream::chacha20>(buffer.data(), buffer.data() + whole, encryption);
+        encrypt_inplace<stream::chacha20>(buffer.data() + whole, buffer.data() + length, encryption);
+        BOOST_CHECK_EQUAL(to_hex(buffer), std::string(sunscreen_ciphertext).substr(0, 2 * length));
+
+        decryption_mode decryption(cipher, nonce, 1);
+        decrypt_inplace<stream::chacha20>(buffer, decryption);
+        BOOST_CHECK(std::string(buffer.begin(), buffer.end()) == plaintext.substr(0, length));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_backends_agree) {
+    // Every amount of blocks up to three AVX2 batches and a tail, counters wrapping modulo 2^32
+    typedef stream::chacha20::block_type block_type;
+
+    std::mt19937 rng(8439);
+    stream::chacha20::key_type key;
+    stream::chacha20::nonce_type nonce;
+    for (std::uint8_t &b : key) {
+        b = static_cast<std::uint8_t>(rng());
+    }
+    for (std::uint8_t &b : nonce) {
+        b = static_cast<std::uint8_t>(rng());
+    }
+
+    std::vector<block_type> input(29);
+    for (block_type &b : input) {
+        for (std::uint8_t &c : b) {
+            c = static_cast<std::uint8_t>(rng());
+        }
+    }
+
+    stream::chacha20 reference(key, stream::chacha20_backend::portable);
+    const std::uint32_t counters[] = {0, 1, 0xfffffffa};
+    for (std::uint32_t counter : counters) {
+        for (std::size_t n = 0; n <= input.size(); ++n) {
+            std::vector<block_type> expected(n);
+            reference.process_blocks(nonce, counter, input.data(), expected.data(), n);
+            for (std::size_t i = 0; i != n; ++i) {
+                block_type k = reference.keystream(nonce, counter + static_cast<std::uint32_t>(i));
+                for (std::size_t j = 0; j != k.size(); ++j) {
+                    k[j] ^= input[i][j];
+                }
+                BOOST_REQUIRE(expected[i] == k);
+            }
+
+            for (stream::chacha20_backend backend : all_backends) {
+                if (!stream::chacha20::is_available(backend)) {
+                    continue;
+                }
+                stream::chacha20 cipher(key, backend);
+                std::vector<block_type> out(input.begin(), input.begin() + n);
+                cipher.process_blocks(nonce, counter, out.data(), out.data(), n);
+                BOOST_CHECK(out == expected);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_streaming_consistency) {
+    // Blocks passed one at a time, in runs of any length or all at once give the same output
+    typedef encryption_mode::block_type block_type;
+
+    stream::chacha20 cipher(make_array<stream::chacha20::key_type>(rfc8439_key));
+    std::vector<std::uint8_t> nonce = from_hex("000000000000004a00000000");
+
+    std::vector<block_type> plaintext(41);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        plaintext[i].fill(static_cast<std::uint8_t>(i));
+    }
+
+    std::vector<block_type> expected(plaintext.size());
+    encryption_mode reference(cipher, nonce);
+    reference.encrypt_blocks(plaintext.data(), expected.data(), plaintext.size());
+
+    const std::size_t splits[] = {1, 3, 7, 8, 9, 16, 17};
+    for (std::size_t split : splits) {
+        encryption_mode mode(cipher, nonce);
+        std::vector<block_type> out(plaintext.size());
+        for (std::size_t i = 0; i < plaintext.size(); i += split) {
+            std::size_t n = std::min(split, plaintext.size() - i);
+            mode.encrypt_blocks(plaintext.data() + i, out.data() + i, n);
+        }
+        BOOST_CHECK(out == expected);
+    }
+
+    encryption_mode mode(cipher, nonce);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        BOOST_CHECK(mode.process_block(plaintext[i], 0) == expected[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_counter_exhausted) {
+    // The last counter value takes one block, anything past it would wrap around to block 0
+    typedef encryption_mode::block_type block_type;
+
+    stream::chacha20 cipher(make_array<stream::chacha20::key_type>(rfc8439_key));
+    stream::chacha20::nonce_type nonce = make_array<stream::chacha20::nonce_type>("000000000000004a00000000");
+
+    BOOST_CHECK_EQUAL(encryption_mode(cipher, nonce).available_blocks(), std::uint64_t(1) << 32);
+
+    std::vector<block_type> blocks(9);
+    encryption_mode mode(cipher, nonce, 0xffffffff);
+    BOOST_CHECK_EQUAL(mode.available_blocks(), 1);
+    BOOST_CHECK_THROW(mode.encrypt_blocks(blocks.data(), blocks.data(), 2), stream::counter_exhausted);
+    BOOST_CHECK_THROW(mode.encrypt_blocks(blocks.data(), blocks.data(), blocks.size()), stream::counter_exhausted);
+
+    BOOST_CHECK(mode.process_block(blocks[0], 0) == cipher.keystream(nonce, 0xffffffff));
+    BOOST_CHECK_EQUAL(mode.available_blocks(), 0);
+    BOOST_CHECK_THROW(mode.process_block(blocks[0], 0), stream::counter_exhausted);
+    BOOST_CHECK_THROW(mode.end_message(blocks[0], 8), stream::counter_exhausted);
+
+    std::vector<std::uint8_t> buffer(65);
+    encryption_mode inplace(cipher, nonce, 0xffffffff);
+    BOOST_CHECK_THROW(encrypt_inplace<stream::chacha20>(buffer, inplace), stream::counter_exhausted);
+
+    block::accumulator_set<encryption_mode> acc(encryption_mode(cipher, nonce, 0xffffffff));
+    encrypt<stream::chacha20>(std::string(65, 'a'), acc);
+    BOOST_CHECK_THROW(accumulators::extract::block<encryption_mode>(acc), stream::counter_exhausted);
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_invalid_nonce_length) {
+    // Nonces are exactly 12 octets, anything else would overflow or leave octets unset
+    stream::chacha20 cipher(make_array<stream::chacha20::key_type>(rfc8439_key));
+
+    BOOST_CHECK_THROW(encryption_mode(cipher, from_hex("0000000000000000004a00")), std::invalid_argument);
+    BOOST_CHECK_THROW(encryption_mode(cipher, from_hex("000000000000004a0000000000")), std::invalid_argument);
+    BOOST_CHECK_THROW(encryption_mode(cipher, std::vector<std::uint8_t>()), std::invalid_argument);
+    BOOST_CHECK_NO_THROW(encryption_mode(cipher, from_hex("000000000000004a00000000")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
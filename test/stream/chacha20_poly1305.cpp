@@ -0,0 +1,193 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE chacha20_poly1305_test
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/crypto3/block/algorithm/encrypt.hpp>
+#include <boost/crypto3/block/algorithm/decrypt.hpp>
+
+#include <boost/crypto3/stream/chacha20_poly1305.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+typedef stream::chacha20_poly1305::bind<stream::chacha20_poly1305::encryption_policy>::type encryption_mode;
+typedef stream::chacha20_poly1305::bind<stream::chacha20_poly1305::decryption_policy>::type decryption_mode;
+typedef encryption_mode::block_type block_type;
+
+// RFC 8439, 2.8.2
+const char *const aead_key = "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f";
+const char *const aead_nonce = "070000004041424344454647";
+const char *const aead_aad = "50515253c0c1c2c3c4c5c6c7";
+const char *const sunscreen =
+    "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be "
+    "it.";
+const char *const sunscreen_ciphertext =
+    "d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d63dbea45e8ca9671282fafb69da92728b1a71de0a9e060b"
+    "2905d6a5b67ecd3b3692ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc3ff4def08e4b7a9de576d26586ce"
+    "c64b6116";
+const char *const sunscreen_tag = "1ae10b594f09e26a7e902ecbd0600691";
+
+/*!
+ * @brief Encrypts through the block accumulator, returns the ciphertext followed by the tag
+ */
+std::string aead_encrypt(const std::string &aad, const std::string &plaintext) {
+    encryption_mode mode(make_cipher<stream::chacha20>(aead_key), from_hex(aead_nonce));
+    mode.process_aad(from_hex(aad));
+
+    block::accumulator_set<encryption_mode> acc(mode);
+    encrypt<stream::chacha20>(plaintext, acc);
+
+    return to_hex(accumulators::extract::block<encryption_mode>(acc));
+}
+
+/*!
+ * @brief Decrypts through the block accumulator, verifying the tag
+ */
+std::string aead_decrypt(const std::string &aad, const std::string &ciphertext, const std::string &tag) {
+    decryption_mode mode(make_cipher<stream::chacha20>(aead_key), from_hex(aead_nonce), from_hex(tag));
+    mode.process_aad(from_hex(aad));
+
+    block::accumulator_set<decryption_mode> acc(mode);
+    decrypt<stream::chacha20>(from_hex(ciphertext), acc);
+
+    auto plaintext = accumulators::extract::block<decryption_mode>(acc);
+    return std::string(plaintext.begin(), plaintext.end());
+}
+
+BOOST_AUTO_TEST_SUITE(chacha20_poly1305_test_suite)
+
+BOOST_AUTO_TEST_CASE(chacha20_poly1305_rfc8439) {
+    BOOST_CHECK_EQUAL(aead_encrypt(aead_aad, sunscreen), std::string(sunscreen_ciphertext) + sunscreen_tag);
+    BOOST_CHECK_EQUAL(aead_decrypt(aead_aad, sunscreen_ciphertext, sunscreen_tag), sunscreen);
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_poly1305_empty_payload) {
+    // Associated data only, the tag authenticates it alone
+    BOOST_CHECK_EQUAL(aead_encrypt(aead_aad, ""), "e622e5647a38d967a7ecbcb46c7f675c");
+    BOOST_CHECK_EQUAL(aead_decrypt(aead_aad, "", "e622e5647a38d967a7ecbcb46c7f675c"), "");
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_poly1305_tampered_message) {
+    std::string bad_ciphertext = sunscreen_ciphertext;
+    bad_ciphertext[bad_ciphertext.size() - 1] = '7';
+    std::string bad_tag = sunscreen_tag;
+    bad_tag[0] = '2';
+
+    BOOST_CHECK_THROW(aead_decrypt(aead_aad, bad_ciphertext, sunscreen_tag), block::authentication_error);
+    BOOST_CHECK_THROW(aead_decrypt(aead_aad, sunscreen_ciphertext, bad_tag), block::authentication_error);
+    BOOST_CHECK_THROW(aead_decrypt("50515253c0c1c2c3c4c5c6c8", sunscreen_ciphertext, sunscreen_tag),
+                      block::authentication_error);
+
+    decryption_mode mode(make_cipher<stream::chacha20>(aead_key), from_hex(aead_nonce));
+    mode.process_aad(from_hex(aead_aad));
+    std::vector<std::uint8_t> tag = from_hex(sunscreen_tag);
+    tag.pop_back();
+    // Truncated tags are rejected
+    BOOST_CHECK(!mode.verify(tag));
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_poly1305_inplace) {
+    // RFC 8439, 2.8.2 in place, the whole blocks, then the rest through the tag
+    std::string plaintext(sunscreen);
+    std::vector<std::uint8_t> buffer(plaintext.begin(), plaintext.end());
+    std::size_t whole = buffer.size() / sizeof(block_type) * sizeof(block_type);
+
+    encryption_mode mode(make_cipher<stream::chacha20>(aead_key), from_hex(aead_nonce));
+    mode.process_aad(from_hex(aead_aad));
+    encrypt_inplace<stream::chacha20>(buffer.data(), buffer.data() + whole, mode);
+
+    block_type last = block_type();
+    std::copy(buffer.begin() + whole, buffer.end(), last.begin());
+    BOOST_CHECK_EQUAL(to_hex(mode.tag(last, buffer.size() * 8)), sunscreen_tag);
+
+    block_type tail = mode.end_message(last, buffer.size() * 8);
+    std::copy(tail.begin(), tail.begin() + (buffer.size() - whole), buffer.begin() + whole);
+    BOOST_CHECK_EQUAL(to_hex(buffer), sunscreen_ciphertext);
+
+    // A partial block can not be authenticated in place
+    std::vector<std::uint8_t> odd(65);
+    encryption_mode other(make_cipher<stream::chacha20>(aead_key), from_hex(aead_nonce));
+    BOOST_CHECK_THROW(encrypt_inplace<stream::chacha20>(odd, other), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_poly1305_streaming_consistency) {
+    // Any split of the associated data and the payload yields the same ciphertext and tag
+    stream::chacha20 cipher = make_cipher<stream::chacha20>(aead_key);
+    std::vector<std::uint8_t> nonce = from_hex(aead_nonce);
+
+    std::vector<std::uint8_t> aad(77);
+    for (std::size_t i = 0; i != aad.size(); ++i) {
+        aad[i] = static_cast<std::uint8_t>(i * 7 + 3);
+    }
+
+    std::vector<block_type> plaintext(37);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        plaintext[i].fill(static_cast<std::uint8_t>(i));
+    }
+
+    encryption_mode reference(cipher, nonce);
+    reference.process_aad(aad);
+    std::vector<block_type> expected(plaintext.size());
+    reference.encrypt_blocks(plaintext.data(), expected.data(), plaintext.size());
+    encryption_mode::tag_type expected_tag = reference.tag();
+
+    const std::size_t splits[] = {1, 3, 7, 8, 9, 16, 17};
+    for (std::size_t split : splits) {
+        encryption_mode mode(cipher, nonce);
+        for (std::size_t i = 0; i < aad.size(); i += split) {
+            mode.process_aad(aad.begin() + i, aad.begin() + std::min(aad.size(), i + split));
+        }
+
+        std::vector<block_type> out(plaintext.size());
+        for (std::size_t i = 0; i < plaintext.size(); i += split) {
+            std::size_t n = std::min(split, plaintext.size() - i);
+            mode.encrypt_blocks(plaintext.data() + i, out.data() + i, n);
+        }
+        BOOST_CHECK(out == expected);
+        BOOST_CHECK(mode.tag() == expected_tag);
+
+        decryption_mode decryption(cipher, nonce);
+        decryption.process_aad(aad);
+        std::vector<block_type> decrypted(out);
+        for (std::size_t i = 0; i < decrypted.size(); i += split) {
+            std::size_t n = std::min(split, decrypted.size() - i);
+            decryption.decrypt_blocks(decrypted.data() + i, decrypted.data() + i, n);
+        }
+        BOOST_CHECK(decrypted == plaintext);
+        BOOST_CHECK(decryption.verify(expected_tag));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(chacha20_poly1305_invalid_lengths) {
+    stream::chacha20 cipher = make_cipher<stream::chacha20>(aead_key);
+    std::vector<std::uint8_t> nonce = from_hex(aead_nonce);
+    std::vector<std::uint8_t> tag = from_hex(sunscreen_tag);
+
+    std::vector<std::uint8_t> short_nonce(nonce.begin(), nonce.end() - 1), long_nonce(nonce);
+    long_nonce.push_back(0);
+    BOOST_CHECK_THROW(encryption_mode(cipher, short_nonce), std::invalid_argument);
+    BOOST_CHECK_THROW(encryption_mode(cipher, long_nonce), std::invalid_argument);
+    BOOST_CHECK_THROW(decryption_mode(cipher, long_nonce, tag), std::invalid_argument);
+
+    std::vector<std::uint8_t> short_tag(tag.begin(), tag.end() - 1), long_tag(tag);
+    long_tag.push_back(0);
+    BOOST_CHECK_THROW(decryption_mode(cipher, nonce, short_tag), std::invalid_argument);
+    BOOST_CHECK_THROW(decryption_mode(cipher, nonce, long_tag), std::invalid_argument);
+    BOOST_CHECK_NO_THROW(decryption_mode(cipher, nonce, tag));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
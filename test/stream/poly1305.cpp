@@ -0,0 +1,110 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE poly1305_test
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/data/monomorphic.hpp>
+
+#include <boost/crypto3/stream/poly1305.hpp>
+
+#include <fixtures.hpp>
+
+using namespace boost::crypto3;
+
+struct poly1305_vector {
+    const char *key;
+    const char *message;
+    const char *tag;
+};
+
+std::ostream &operator<<(std::ostream &os, const poly1305_vector &v) {
+    return os << v.tag;
+}
+
+BOOST_TEST_DONT_PRINT_LOG_VALUE(poly1305_vector)
+
+// RFC 8439, 2.5.2 and A.3, the latter exercising the final reduction modulo 2^130 - 5
+const poly1305_vector poly1305_vectors[] = {
+    {"85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b",
+     "43727970746f6772617068696320466f72756d2052657365617263682047726f7570", "a8061dc1305136c6c22b8baf0c0127a9"},
+    {"0000000000000000000000000000000000000000000000000000000000000000",
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000",
+     "00000000000000000000000000000000"},
+    {"0200000000000000000000000000000000000000000000000000000000000000", "ffffffffffffffffffffffffffffffff",
+     "03000000000000000000000000000000"},
+    {"02000000000000000000000000000000ffffffffffffffffffffffffffffffff", "02000000000000000000000000000000",
+     "03000000000000000000000000000000"},
+    {"0100000000000000000000000000000000000000000000000000000000000000",
+     "fffffffffffffffffffffffffffffffff0ffffffffffffffffffffffffffffff11000000000000000000000000000000",
+     "05000000000000000000000000000000"},
+    {"0100000000000000000000000000000000000000000000000000000000000000",
+     "fffffffffffffffffffffffffffffffffbfefefefefefefefefefefefefefefe01010101010101010101010101010101",
+     "00000000000000000000000000000000"},
+    {"0100000000000000000000000000000000000000000000000000000000000000", "fdffffffffffffffffffffffffffffff",
+     "fdffffffffffffffffffffffffffffff"}};
+
+BOOST_AUTO_TEST_SUITE(poly1305_test_suite)
+
+BOOST_DATA_TEST_CASE(poly1305_rfc8439, boost::unit_test::data::make(poly1305_vectors), v) {
+    stream::poly1305 mac(make_array<stream::poly1305::key_type>(v.key));
+    std::vector<std::uint8_t> message = from_hex(v.message);
+    mac.update(message.data(), message.size());
+
+    BOOST_CHECK_EQUAL(to_hex(mac.digest()), v.tag);
+}
+
+BOOST_AUTO_TEST_CASE(poly1305_long_message) {
+    // RFC 8439, A.3 test vector 2
+    const std::string text =
+        "Any submission to the IETF intended by the Contributor for publication as all or part of an IETF "
+        "Internet-Draft or RFC and any statement made within the context of an IETF activity is considered an "
+        "\"IETF Contribution\". Such statements include oral statements in IETF sessions, as well as written and "
+        "electronic communications made at any time or place, which are addressed to";
+
+    stream::poly1305 mac(make_array<stream::poly1305::key_type>("0000000000000000000000000000000036e5f6b5c5e06070f0efca96227a863e"));
+    mac.update(text);
+    BOOST_CHECK_EQUAL(to_hex(mac.digest()), "36e5f6b5c5e06070f0efca96227a863e");
+}
+
+BOOST_AUTO_TEST_CASE(poly1305_streaming_consistency) {
+    // Any split of the message gives the same tag, digest leaves the state as it is
+    stream::poly1305::key_type key = make_array<stream::poly1305::key_type>("85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b");
+    std::vector<std::uint8_t> message(301);
+    for (std::size_t i = 0; i != message.size(); ++i) {
+        message[i] = static_cast<std::uint8_t>(i * 13 + 5);
+    }
+
+    stream::poly1305 reference(key);
+    reference.update(message.data(), message.size());
+    stream::poly1305::tag_type expected = reference.digest();
+    BOOST_CHECK(reference.digest() == expected);
+
+    const std::size_t splits[] = {1, 3, 15, 16, 17, 64, 100};
+    for (std::size_t split : splits) {
+        stream::poly1305 mac(key);
+        for (std::size_t i = 0; i < message.size(); i += split) {
+            std::size_t n = std::min(split, message.size() - i);
+            mac.update(message.data() + i, n);
+            mac.digest();
+        }
+        BOOST_CHECK(mac.digest() == expected);
+
+        stream::poly1305 iterators(key);
+        iterators.update(message.begin(), message.end());
+        BOOST_CHECK(iterators.digest() == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()